@@ -28,17 +28,12 @@ namespace UKControllerPlugin {
         */
         const AirfieldModel& AirfieldCollection::FetchAirfieldByIcao(std::string icao) const
         {
-            if (!this->IsHomeAirfield(icao) || this->GetSize() == 0) {
+            if (!this->IsHomeAirfield(icao)) {
                 throw std::out_of_range("Airfield not found");
             }
 
-            auto iterator = std::find_if(this->airfieldMap.begin(), this->airfieldMap.end(),
-                [icao](std::pair<std::string, const std::unique_ptr<AirfieldModel> &> airfield) -> bool {
-
-                return airfield.second->GetIcao().compare(icao) == 0;
-            });
-
-            if (iterator == this->airfieldMap.end()) {
+            AirfieldMap::const_iterator iterator = this->airfieldMap.find(icao);
+            if (iterator == this->airfieldMap.cend()) {
                 throw std::out_of_range("Airfield not found");
             }
 
@@ -11,14 +11,20 @@ namespace UKControllerPlugin {
         class AirfieldCollection
         {
             public:
+                typedef std::map<std::string, std::unique_ptr<UKControllerPlugin::Airfield::AirfieldModel>>
+                    AirfieldMap;
+                typedef AirfieldMap::const_iterator const_iterator;
+
                 void AddAirfield(std::unique_ptr<UKControllerPlugin::Airfield::AirfieldModel> airfield);
                 const AirfieldModel & FetchAirfieldByIcao(std::string icao) const;
                 size_t GetSize(void) const;
+                const_iterator cbegin(void) const { return this->airfieldMap.cbegin(); }
+                const_iterator cend(void) const { return this->airfieldMap.cend(); }
             private:
                 bool IsHomeAirfield(std::string icao) const;
 
                 // A map of ICAO code to airfield.
-                std::map<std::string, std::unique_ptr<UKControllerPlugin::Airfield::AirfieldModel>> airfieldMap;
+                AirfieldMap airfieldMap;
         };
     }  // namespace Airfield
 }  // namespace UKControllerPlugin
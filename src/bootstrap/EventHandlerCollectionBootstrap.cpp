@@ -14,6 +14,7 @@
 #include "plugin/UKPlugin.h"
 #include "command/CommandHandlerCollection.h"
 #include "controller/HandoffEventHandlerCollection.h"
+#include "performance/HandlerMetricsCollection.h"
 
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Tag::TagItemCollection;
@@ -28,6 +29,7 @@ using UKControllerPlugin::Euroscope::UserSettingAwareCollection;
 using UKControllerPlugin::Command::CommandHandlerCollection;
 using UKControllerPlugin::Euroscope::RunwayDialogAwareCollection;
 using UKControllerPlugin::Controller::HandoffEventHandlerCollection;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
 
 namespace UKControllerPlugin {
     namespace Bootstrap {
@@ -37,11 +39,12 @@ namespace UKControllerPlugin {
         */
         void EventHandlerCollectionBootstrap::BoostrapPlugin(PersistenceContainer & persistence)
         {
-            persistence.tagHandler.reset(new TagItemCollection);
-            persistence.radarTargetHandler.reset(new RadarTargetEventHandlerCollection);
-            persistence.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
+            persistence.handlerMetrics = std::make_shared<HandlerMetricsCollection>();
+            persistence.tagHandler.reset(new TagItemCollection(persistence.handlerMetrics));
+            persistence.radarTargetHandler.reset(new RadarTargetEventHandlerCollection(persistence.handlerMetrics));
+            persistence.flightplanHandler.reset(new FlightPlanEventHandlerCollection(persistence.handlerMetrics));
             persistence.controllerHandler.reset(new ControllerStatusEventHandlerCollection);
-            persistence.timedHandler.reset(new TimedEventCollection);
+            persistence.timedHandler.reset(new TimedEventCollection(persistence.handlerMetrics));
             persistence.pluginFunctionHandlers.reset(new FunctionCallEventHandler);
             persistence.metarEventHandler.reset(new MetarEventHandlerCollection);
             persistence.deferredHandlers.reset(new DeferredEventHandler);
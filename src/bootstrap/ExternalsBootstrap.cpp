@@ -1,14 +1,14 @@
 #include "pch/stdafx.h"
 #include "bootstrap/ExternalsBootstrap.h"
 #include "bootstrap/PersistenceContainer.h"
-#include "curl/CurlApi.h"
+#include "curl/PooledCurlApi.h"
 #include "windows/WinApi.h"
 #include "graphics/GdiplusBrushes.h"
 #include "graphics/GdiGraphicsWrapper.h"
 #include "euroscope/GeneralSettingsDialog.h"
 #include "dialog/DialogManager.h"
 
-using UKControllerPlugin::Curl::CurlApi;
+using UKControllerPlugin::Curl::PooledCurlApi;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Windows::WinApi;
 using UKControllerPlugin::Windows::WinApiInterface;
@@ -26,7 +26,7 @@ namespace UKControllerPlugin {
         */
         void ExternalsBootstrap::Bootstrap(PersistenceContainer & persistence, HINSTANCE instance)
         {
-            persistence.curl.reset(new CurlApi());
+            persistence.curl.reset(new PooledCurlApi());
             std::unique_ptr<WinApi> winApi = std::make_unique<WinApi>(
                 instance,
                 GetPluginFileRoot()
@@ -44,10 +44,13 @@
 #include "navaids/NavaidModule.h"
 #include "releases/ReleaseModule.h"
 #include "stands/StandModule.h"
+#include "stands/StandSerializer.h"
 #include "integration/IntegrationModule.h"
 #include "bootstrap/CopyFilesToNewFolder.h"
+#include "bootstrap/ModuleBootstrapper.h"
 #include "notifications/NotificationsModule.h"
 #include "flightinformationservice/FlightInformatioNServiceModule.h"
+#include "performance/PerformanceModule.h"
 
 using UKControllerPlugin::Api::ApiAuthChecker;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
@@ -56,6 +59,7 @@ using UKControllerPlugin::Log::LoggerBootstrap;
 using UKControllerPlugin::Bootstrap::HelperBootstrap;
 using UKControllerPlugin::Bootstrap::CollectionBootstrap;
 using UKControllerPlugin::Bootstrap::EventHandlerCollectionBootstrap;
+using UKControllerPlugin::Bootstrap::ModuleBootstrapper;
 using UKControllerPlugin::Bootstrap::UkPluginBootstrap;
 using UKControllerPlugin::InitialAltitude::InitialAltitudeModule;
 using UKControllerPlugin::IntentionCode::IntentionCodeModule;
@@ -200,38 +204,64 @@ namespace UKControllerPlugin {
         }
 
         // Dependency loading can happen regardless of plugin version or API status.
-        Dependency::UpdateDependencies(
-            *this->container->api,
-            *this->container->windows
-        );
         DependencyLoader loader(
-            *this->container->windows
+            *this->container->windows,
+            Dependency::UpdateDependencies(
+                *this->container->api,
+                *this->container->windows
+            )
         );
 
-        Integration::BootstrapPlugin(*this->container, duplicatePlugin->Duplicate());
+        // Bootstrap all the modules, in order, timing each one
+        ModuleBootstrapper modules;
+        modules.AddModule("Integration", [this]() {
+            Integration::BootstrapPlugin(*this->container, this->duplicatePlugin->Duplicate());
+        });
 
         // Boostrap all the modules at a plugin level
-        Controller::BootstrapPlugin(*this->container, loader);
-        CollectionBootstrap::BootstrapPlugin(*this->container, loader);
-        FlightplanStorageBootstrap::BootstrapPlugin(*this->container);
-        AirfieldOwnershipModule::BootstrapPlugin(*this->container, loader);
-        Navaids::BootstrapPlugin(*this->container, loader);
-        Releases::BootstrapPlugin(*this->container, loader);
-        Stands::BootstrapPlugin(*this->container, loader);
-        Notifications::BootstrapPlugin(*this->container);
-        FlightInformationService::BootstrapPlugin(*this->container);
-
-        Wake::BootstrapPlugin(*this->container, loader);
-        LoginModule::BootstrapPlugin(*this->container);
-        DeferredEventBootstrap(*this->container->timedHandler);
-        SectorFile::BootstrapPlugin(*this->container);
+        modules.AddModule("Controller", [this, &loader]() { Controller::BootstrapPlugin(*this->container, loader); });
+        modules.AddModule("Collections", [this, &loader]() {
+            CollectionBootstrap::BootstrapPlugin(*this->container, loader);
+        });
+        modules.AddModule("FlightplanStorage", [this]() {
+            FlightplanStorageBootstrap::BootstrapPlugin(*this->container);
+        });
+        modules.AddModule("AirfieldOwnership", [this, &loader]() {
+            AirfieldOwnershipModule::BootstrapPlugin(*this->container, loader);
+        });
+        modules.AddModule("Navaids", [this, &loader]() { Navaids::BootstrapPlugin(*this->container, loader); });
+        modules.AddModule("Releases", [this, &loader]() { Releases::BootstrapPlugin(*this->container, loader); });
+
+        // Stands only need the dependency to build, so load and parse it in the background whilst other modules
+        // bootstrap. The loader is safe to share, and outlives the warm-up as bootstrapping waits for it.
+        modules.AddWarmedModule(
+            "Stands",
+            [this, &loader]() {
+                std::set<Stands::Stand, Stands::CompareStands> stands;
+                Stands::from_json(loader.LoadDependency(Stands::standDependency, nlohmann::json::object()), stands);
+                return [this, stands = std::move(stands)]() mutable {
+                    Stands::BootstrapPlugin(*this->container, std::move(stands));
+                };
+            }
+        );
+        modules.AddModule("Notifications", [this]() { Notifications::BootstrapPlugin(*this->container); });
+        modules.AddModule("FlightInformationService", [this]() {
+            FlightInformationService::BootstrapPlugin(*this->container);
+        });
+
+        modules.AddModule("Wake", [this, &loader]() { Wake::BootstrapPlugin(*this->container, loader); });
+        modules.AddModule("Login", [this]() { LoginModule::BootstrapPlugin(*this->container); });
+        modules.AddModule("DeferredEvents", [this]() { DeferredEventBootstrap(*this->container->timedHandler); });
+        modules.AddModule("SectorFile", [this]() { SectorFile::BootstrapPlugin(*this->container); });
 
         // General settings config bootstrap
-        GeneralSettingsConfigurationBootstrap::BootstrapPlugin(
-            *this->container->dialogManager,
-            *this->container->pluginUserSettingHandler,
-            *this->container->userSettingHandlers
-        );
+        modules.AddModule("GeneralSettings", [this]() {
+            GeneralSettingsConfigurationBootstrap::BootstrapPlugin(
+                *this->container->dialogManager,
+                *this->container->pluginUserSettingHandler,
+                *this->container->userSettingHandlers
+            );
+        });
 
         // Bootstrap the modules
 
@@ -241,45 +271,59 @@ namespace UKControllerPlugin {
             this->updateStatus == PluginUpdateChecker::versionAllowed &&
             !this->duplicatePlugin->Duplicate()
         ) {
-            InitialAltitudeModule::BootstrapPlugin(loader, *this->container);
+            modules.AddModule("InitialAltitude", [this, &loader]() {
+                InitialAltitudeModule::BootstrapPlugin(loader, *this->container);
+            });
         }
 
-        Srd::BootstrapPlugin(*this->container);
-        IntentionCodeModule::BootstrapPlugin(*this->container);
-        HistoryTrailModule::BootstrapPlugin(*this->container);
-        CountdownModule::BootstrapPlugin(*this->container);
-        MinStackModule::BootstrapPlugin(
-            this->container->minStack,
-            *this->container->taskRunner,
-            *this->container->api,
-            *this->container->websocketProcessors,
-            *this->container->dialogManager
-        );
-        RegionalPressureModule::BootstrapPlugin(
-            this->container->regionalPressureManager,
-            *this->container->taskRunner,
-            *this->container->api,
-            *this->container->websocketProcessors,
-            *this->container->dialogManager,
-            loader
-        );
-        Hold::BootstrapPlugin(
-            loader,
-            *this->container,
-            *this->container->userMessager
-        );
+        modules.AddModule("Srd", [this]() { Srd::BootstrapPlugin(*this->container); });
+        modules.AddModule("IntentionCode", [this]() { IntentionCodeModule::BootstrapPlugin(*this->container); });
+        modules.AddModule("HistoryTrail", [this]() { HistoryTrailModule::BootstrapPlugin(*this->container); });
+        modules.AddModule("Countdown", [this]() { CountdownModule::BootstrapPlugin(*this->container); });
+        modules.AddModule("MinStack", [this]() {
+            MinStackModule::BootstrapPlugin(
+                this->container->minStack,
+                *this->container->taskRunner,
+                *this->container->api,
+                *this->container->websocketProcessors,
+                *this->container->dialogManager
+            );
+        });
+        modules.AddModule("RegionalPressure", [this, &loader]() {
+            RegionalPressureModule::BootstrapPlugin(
+                this->container->regionalPressureManager,
+                *this->container->taskRunner,
+                *this->container->api,
+                *this->container->websocketProcessors,
+                *this->container->dialogManager,
+                loader
+            );
+        });
+        modules.AddModule("Hold", [this, &loader]() {
+            Hold::BootstrapPlugin(
+                loader,
+                *this->container,
+                *this->container->userMessager
+            );
+        });
 
         // Due to flightplan modifications and API interactions, only enable the squawk module
         // if the API is authorised and the plugin is an allowed version. Also, dont allow automatic
         // squawk assignment if the plugin is deemed to be a duplicate
-        SquawkModule::BootstrapPlugin(
-            *this->container,
-            this->updateStatus != PluginUpdateChecker::versionAllowed,
-            this->duplicatePlugin->Duplicate()
-        );
+        modules.AddModule("Squawk", [this]() {
+            SquawkModule::BootstrapPlugin(
+                *this->container,
+                this->updateStatus != PluginUpdateChecker::versionAllowed,
+                this->duplicatePlugin->Duplicate()
+            );
+        });
 
-        PrenoteModule::BootstrapPlugin(*this->container, loader);
-        Handoff::BootstrapPlugin(*this->container, loader);
+        modules.AddModule("Prenote", [this, &loader]() { PrenoteModule::BootstrapPlugin(*this->container, loader); });
+        modules.AddModule("Handoff", [this, &loader]() { Handoff::BootstrapPlugin(*this->container, loader); });
+        modules.Bootstrap();
+
+        // Every dependency has been loaded, so update the snapshot for next time if anything has changed
+        loader.SaveSnapshot();
 
         // Bootstrap other things
         ActualOffBlockTimeBootstrap::BootstrapPlugin(*this->container);
@@ -289,6 +333,9 @@ namespace UKControllerPlugin {
         // Pressure monitor
         Metar::PressureMonitorBootstrap(*this->container);
 
+        // Handler performance reporting
+        Performance::BootstrapPlugin(*this->container);
+
         // Do post-init and final setup, which involves running tasks that need to happen on load.
         PostInit::Process(*this->container);
         LogInfo("Plugin loaded successfully");
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Bootstrap {
+
+        /*
+            How long a module took to bootstrap. The warm-up happens on a background thread, so only
+            the time spent waiting for it holds up the EuroScope thread.
+        */
+        typedef struct ModuleBootstrapTiming
+        {
+            // The name of the module
+            std::string name;
+
+            // Whether the module had a warm-up
+            bool warmed;
+
+            // How long the warm-up took on its background thread
+            std::chrono::microseconds warmup;
+
+            // How long the bootstrapping thread waited for the warm-up to finish
+            std::chrono::microseconds waited;
+
+            // How long the rest of the bootstrap took on the bootstrapping thread
+            std::chrono::microseconds bootstrap;
+        } ModuleBootstrapTiming;
+    }  // namespace Bootstrap
+}  // namespace UKControllerPlugin
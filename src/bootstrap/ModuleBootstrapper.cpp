@@ -0,0 +1,116 @@
+#include "pch/stdafx.h"
+#include "bootstrap/ModuleBootstrapper.h"
+
+namespace UKControllerPlugin {
+    namespace Bootstrap {
+
+        void ModuleBootstrapper::AddModule(std::string name, BootstrapFunction bootstrap)
+        {
+            this->names.push_back(name);
+            this->warmups.push_back(nullptr);
+            this->bootstraps.push_back(bootstrap);
+        }
+
+        void ModuleBootstrapper::AddWarmedModule(std::string name, WarmupFunction warmup)
+        {
+            this->names.push_back(name);
+            this->warmups.push_back(warmup);
+            this->bootstraps.push_back(nullptr);
+        }
+
+        /*
+            Start every warm-up, then bootstrap each module in turn. If a warm-up throws, the exception
+            comes out here when it is that module's turn.
+        */
+        void ModuleBootstrapper::Bootstrap(void)
+        {
+            this->timings.clear();
+            for (size_t module = 0; module < this->names.size(); module++) {
+                this->timings.push_back(
+                    {
+                        this->names[module],
+                        static_cast<bool>(this->warmups[module]),
+                        std::chrono::microseconds::zero(),
+                        std::chrono::microseconds::zero(),
+                        std::chrono::microseconds::zero()
+                    }
+                );
+            }
+
+            std::vector<std::future<BootstrapFunction>> warmedModules(this->names.size());
+            for (size_t module = 0; module < this->names.size(); module++) {
+                if (!this->warmups[module]) {
+                    continue;
+                }
+
+                // Each warm-up only writes to its own timing, which is read once its future is ready
+                std::chrono::microseconds & warmupTime = this->timings[module].warmup;
+                WarmupFunction warmup = this->warmups[module];
+                warmedModules[module] = std::async(std::launch::async, [warmup, &warmupTime]() {
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    BootstrapFunction bootstrap = warmup();
+                    warmupTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start
+                    );
+                    return bootstrap;
+                });
+            }
+
+            std::chrono::steady_clock::time_point allStart = std::chrono::steady_clock::now();
+            for (size_t module = 0; module < this->names.size(); module++) {
+                ModuleBootstrapTiming & timing = this->timings[module];
+                BootstrapFunction bootstrap = this->bootstraps[module];
+
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                if (timing.warmed) {
+                    bootstrap = warmedModules[module].get();
+                    timing.waited = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start
+                    );
+                    start = std::chrono::steady_clock::now();
+                }
+
+                if (bootstrap) {
+                    bootstrap();
+                }
+
+                timing.bootstrap = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start
+                );
+                LogInfo(FormatTiming(timing));
+            }
+
+            LogInfo(
+                "Bootstrapped " + std::to_string(this->names.size()) + " modules in " +
+                std::to_string(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - allStart
+                    ).count()
+                ) + "ms"
+            );
+        }
+
+        size_t ModuleBootstrapper::CountModules(void) const
+        {
+            return this->names.size();
+        }
+
+        const std::vector<ModuleBootstrapTiming> & ModuleBootstrapper::GetTimings(void) const
+        {
+            return this->timings;
+        }
+
+        std::string ModuleBootstrapper::FormatTiming(const ModuleBootstrapTiming & timing)
+        {
+            std::string message = "Bootstrapped module " + timing.name + " in " +
+                std::to_string(timing.bootstrap.count()) + "us";
+
+            if (timing.warmed) {
+                message += " after a " + std::to_string(timing.warmup.count()) + "us warm-up, waited " +
+                    std::to_string(timing.waited.count()) + "us";
+            }
+
+            return message;
+        }
+    }  // namespace Bootstrap
+}  // namespace UKControllerPlugin
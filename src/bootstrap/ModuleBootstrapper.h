@@ -0,0 +1,46 @@
+#pragma once
+#include "bootstrap/ModuleBootstrapTiming.h"
+
+namespace UKControllerPlugin {
+    namespace Bootstrap {
+
+        /*
+            Bootstraps the plugin modules in the order that they are added, logging how long
+            each one takes.
+
+            A module may instead be added with a warm-up, which builds its data structures on a
+            background thread as soon as bootstrapping starts. The warm-up returns the rest of the
+            bootstrap, which runs on the bootstrapping thread in the module's turn. This means that
+            modules still register with the event handler collections in order and on the EuroScope
+            thread. Warm-ups must not touch anything that another module might be using.
+        */
+        class ModuleBootstrapper
+        {
+            public:
+                typedef std::function<void(void)> BootstrapFunction;
+                typedef std::function<BootstrapFunction(void)> WarmupFunction;
+
+                void AddModule(std::string name, BootstrapFunction bootstrap);
+                void AddWarmedModule(std::string name, WarmupFunction warmup);
+                void Bootstrap(void);
+                size_t CountModules(void) const;
+                const std::vector<ModuleBootstrapTiming> & GetTimings(void) const;
+
+            private:
+
+                static std::string FormatTiming(const ModuleBootstrapTiming & timing);
+
+                // The names of the modules, in bootstrap order
+                std::vector<std::string> names;
+
+                // The warm-up for each module, empty if the module doesn't have one
+                std::vector<WarmupFunction> warmups;
+
+                // The bootstrap for each module, empty if it comes from the warm-up
+                std::vector<BootstrapFunction> bootstraps;
+
+                // How long each module took, last time round
+                std::vector<ModuleBootstrapTiming> timings;
+        };
+    }  // namespace Bootstrap
+}  // namespace UKControllerPlugin
@@ -7,6 +7,7 @@
 #include "airfield/AirfieldCollection.h"
 #include "ownership/AirfieldOwnershipManager.h"
 #include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/CallsignRegistry.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "controller/ControllerStatusEventHandlerCollection.h"
 #include "euroscope/RadarTargetEventHandlerCollection.h"
@@ -55,6 +56,7 @@
 #include "hold/PublishedHoldCollection.h"
 #include "controller/HandoffEventHandlerCollection.h"
 #include "integration/ExternalMessageEventHandler.h"
+#include "performance/HandlerMetricsCollection.h"
 
 namespace UKControllerPlugin {
     namespace Bootstrap {
@@ -75,6 +77,7 @@ namespace UKControllerPlugin {
             std::unique_ptr<UKControllerPlugin::TaskManager::TaskRunnerInterface> taskRunner;
             std::unique_ptr<UKControllerPlugin::Controller::ActiveCallsignCollection> activeCallsigns;
             std::unique_ptr<UKControllerPlugin::Flightplan::StoredFlightplanCollection> flightplans;
+            std::shared_ptr<UKControllerPlugin::Flightplan::CallsignRegistry> callsignRegistry;
             std::unique_ptr<UKControllerPlugin::Message::UserMessager> userMessager;
             std::unique_ptr<UKControllerPlugin::Euroscope::UserSetting> pluginUserSettingHandler;
             std::shared_ptr<UKControllerPlugin::Controller::Login> login;
@@ -83,6 +86,7 @@ namespace UKControllerPlugin {
             std::shared_ptr<UKControllerPlugin::Datablock::DisplayTime> timeFormatting;
 
             // Collections of event handlers
+            std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> handlerMetrics;
             std::unique_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection> flightplanHandler;
             std::unique_ptr<UKControllerPlugin::Controller::ControllerStatusEventHandlerCollection> controllerHandler;
             std::unique_ptr<UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection> radarTargetHandler;
@@ -109,7 +113,7 @@ namespace UKControllerPlugin {
             std::shared_ptr<UKControllerPlugin::Regional::RegionalPressureManager> regionalPressureManager;
             std::unique_ptr<UKControllerPlugin::Squawk::SquawkAssignment> squawkAssignmentRules;
             std::shared_ptr<UKControllerPlugin::Squawk::SquawkEventHandler> squawkEvents;
-            std::unique_ptr<UKControllerPlugin::Squawk::SquawkGenerator> squawkGenerator;
+            std::shared_ptr<UKControllerPlugin::Squawk::SquawkGenerator> squawkGenerator;
             std::unique_ptr<UKControllerPlugin::Hold::HoldManager> holdManager;
             std::shared_ptr<UKControllerPlugin::Hold::HoldSelectionMenu> holdSelectionMenu;
             std::unique_ptr<UKControllerPlugin::Hold::HoldDisplayFactory> holdDisplayFactory;
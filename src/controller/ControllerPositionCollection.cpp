@@ -13,7 +13,27 @@ namespace UKControllerPlugin {
         */
         bool ControllerPositionCollection::AddPosition(std::unique_ptr<ControllerPosition> position)
         {
-            return this->positions.insert({ position->GetCallsign(), std::move(position) }).second;
+            const ControllerPosition * added = position.get();
+            if (!this->positions.insert({ position->GetCallsign(), std::move(position) }).second) {
+                return false;
+            }
+
+            std::vector<const ControllerPosition *> & frequencyPositions = this->frequencyIndex[
+                FacilityTypeKey(added->GetUnit(), added->GetType())
+            ][FrequencyKhz(added->GetFrequency())];
+
+            frequencyPositions.insert(
+                std::upper_bound(
+                    frequencyPositions.begin(),
+                    frequencyPositions.end(),
+                    added,
+                    [](const ControllerPosition * first, const ControllerPosition * second) -> bool {
+                        return first->GetCallsign() < second->GetCallsign();
+                    }
+                ),
+                added
+            );
+            return true;
         }
 
         /*
@@ -38,24 +58,58 @@ namespace UKControllerPlugin {
             double frequency
         ) const {
 
-            facility = TranslateFrequencyAbbreviation(facility);
+            auto byFrequency = this->frequencyIndex.find(
+                FacilityTypeKey(TranslateFrequencyAbbreviation(facility), type)
+            );
+            if (byFrequency == this->frequencyIndex.cend()) {
+                throw std::out_of_range("Position not found.");
+            }
 
-            // Iterate through the positions and try to match.
-            auto position = std::find_if(this->positions.begin(), this->positions.end(),
-                [facility, frequency, type]
-                (std::pair<std::string, const std::unique_ptr<ControllerPosition> &> position) -> bool {
+            // Frequency matching is done to 4dp, because floating points, so anything that matches
+            // is in the kHz either side. Where several match, the first callsign wins.
+            const ControllerPosition * match = nullptr;
+            int frequencyKhz = FrequencyKhz(frequency);
+            for (int candidateKhz = frequencyKhz - 1; candidateKhz <= frequencyKhz + 1; candidateKhz++) {
+                auto candidates = byFrequency->second.find(candidateKhz);
+                if (candidates == byFrequency->second.cend()) {
+                    continue;
+                }
 
-                // Frequency matching is done to 4dp, because floating points.
-                return fabs(frequency - position.second->GetFrequency()) < 0.001 &&
-                    position.second->GetUnit() == facility &&
-                    position.second->GetType() == type;
-            });
+                for (const ControllerPosition * candidate : candidates->second) {
+                    if (fabs(frequency - candidate->GetFrequency()) >= 0.001) {
+                        continue;
+                    }
 
-            if (position == this->positions.end()) {
+                    if (match == nullptr || candidate->GetCallsign() < match->GetCallsign()) {
+                        match = candidate;
+                    }
+                    break;
+                }
+            }
+
+            if (match == nullptr) {
                 throw std::out_of_range("Position not found.");
             }
 
-            return *position->second;
+            return *match;
+        }
+
+        /*
+            The key for the facility and type part of the index.
+        */
+        std::string ControllerPositionCollection::FacilityTypeKey(
+            const std::string & facility,
+            const std::string & type
+        ) {
+            return facility + " " + type;
+        }
+
+        /*
+            Frequencies to the nearest kHz, for the frequency part of the index.
+        */
+        int ControllerPositionCollection::FrequencyKhz(double frequency)
+        {
+            return static_cast<int>(frequency * 1000 + 0.5);
         }
 
         /*
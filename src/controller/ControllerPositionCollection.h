@@ -10,6 +10,10 @@ namespace UKControllerPlugin {
         /*
             A collection of all the UK Controller Positions, which can be searched
             to retrieve a specific controller position.
+
+            As positions are added, they are indexed by facility and type, then by frequency
+            in kHz, so that matching online controllers to positions doesn't need to look at
+            every position.
         */
         class ControllerPositionCollection
         {
@@ -25,9 +29,18 @@ namespace UKControllerPlugin {
             bool HasPosition(std::string callsign) const;
 
         private:
+            static std::string FacilityTypeKey(const std::string & facility, const std::string & type);
+            static int FrequencyKhz(double frequency);
+
             std::map<std::string, std::unique_ptr<ControllerPosition>> positions;
             bool IsPossibleAirfieldPosition(std::string facility) const;
             bool IsPossibleAreaPosition(std::string facility) const;
+
+            // Positions by facility and type, then frequency in kHz, each list in callsign order
+            std::unordered_map<
+                std::string,
+                std::unordered_map<int, std::vector<const ControllerPosition *>>
+            > frequencyIndex;
         };
     }  // namespace Controller
 }  // namespace UKControllerPlugin
@@ -9,6 +9,18 @@ using UKControllerPlugin::Curl::CurlResponse;
 namespace UKControllerPlugin {
     namespace Curl {
 
+        CurlApi::CurlApi(void)
+            : CurlApi("")
+        {
+
+        }
+
+        CurlApi::CurlApi(std::string certificateAuthority)
+            : certificateAuthority(certificateAuthority)
+        {
+
+        }
+
         /*
             Performs a CURL request to the specified URL with the specified post params.
         */
@@ -39,6 +51,10 @@ namespace UKControllerPlugin {
             curl_easy_setopt(curlObject, CURLOPT_WRITEDATA, &outBuffer);
             curl_easy_setopt(curlObject, CURLOPT_WRITEFUNCTION, &CurlApi::WriteFunction);
 
+            if (!this->certificateAuthority.empty()) {
+                curl_easy_setopt(curlObject, CURLOPT_CAINFO, this->certificateAuthority.c_str());
+            }
+
             result = curl_easy_perform(curlObject);
 
             // If we get an error, then throw an exception.
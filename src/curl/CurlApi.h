@@ -9,12 +9,17 @@ namespace UKControllerPlugin {
         class CurlApi : public CurlInterface
         {
             public:
+                CurlApi(void);
+                explicit CurlApi(std::string certificateAuthority);
                 UKControllerPlugin::Curl::CurlResponse MakeCurlRequest(
                     const UKControllerPlugin::Curl::CurlRequest & request
                 );
 
             private:
                 static size_t WriteFunction(void *ptr, size_t size, size_t nmemb, void * notused);
+
+                // A certificate authority bundle to use instead of the default, if not empty
+                const std::string certificateAuthority;
             };
     }  // namespace Curl
 }  // namespace UKControllerPlugin
@@ -0,0 +1,166 @@
+#include "pch/stdafx.h"
+#include "curl/PooledCurlApi.h"
+#include "curl/CurlRequest.h"
+
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+
+namespace UKControllerPlugin {
+    namespace Curl {
+
+        PooledCurlApi::PooledCurlApi(void)
+            : PooledCurlApi(true, defaultMaxIdleHandles, "")
+        {
+
+        }
+
+        PooledCurlApi::PooledCurlApi(bool useHttp2, size_t maxIdleHandles, std::string certificateAuthority)
+            : useHttp2(useHttp2 && Http2Supported()), maxIdleHandles(maxIdleHandles),
+            certificateAuthority(certificateAuthority)
+        {
+            if (useHttp2 && !this->useHttp2) {
+                LogInfo("libcurl does not support HTTP/2, using HTTP/1.1");
+            }
+
+            this->share = curl_share_init();
+            curl_share_setopt(this->share, CURLSHOPT_LOCKFUNC, &PooledCurlApi::LockShare);
+            curl_share_setopt(this->share, CURLSHOPT_UNLOCKFUNC, &PooledCurlApi::UnlockShare);
+            curl_share_setopt(this->share, CURLSHOPT_USERDATA, this);
+            curl_share_setopt(this->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(this->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        }
+
+        /*
+            Every request must have finished by now, so all of the handles are idle.
+        */
+        PooledCurlApi::~PooledCurlApi(void)
+        {
+            for (CURL * handle : this->idleHandles) {
+                curl_easy_cleanup(handle);
+            }
+
+            curl_share_cleanup(this->share);
+        }
+
+        size_t PooledCurlApi::CountIdleHandles(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->idleHandlesLock);
+            return this->idleHandles.size();
+        }
+
+        /*
+            Performs a CURL request to the specified URL with the specified post params, using a pooled handle.
+        */
+        CurlResponse PooledCurlApi::MakeCurlRequest(const CurlRequest & request)
+        {
+            CURL * curlObject = this->TakeHandle();
+            struct curl_slist * curlHeaders = NULL;
+
+            curl_easy_setopt(curlObject, CURLOPT_URL, request.GetUri());
+            curl_easy_setopt(curlObject, CURLOPT_CUSTOMREQUEST, request.GetMethod());
+
+            // Add headers
+            for (CurlRequest::HttpHeaders::const_iterator it = request.cbegin(); it != request.cend(); ++it) {
+                curlHeaders = curl_slist_append(curlHeaders, std::string(it->first + ": " + it->second).c_str());
+            }
+            curl_easy_setopt(curlObject, CURLOPT_HTTPHEADER, curlHeaders);
+            curl_easy_setopt(curlObject, CURLOPT_POSTFIELDS, request.GetBody());
+
+            std::string outBuffer;
+            curl_easy_setopt(curlObject, CURLOPT_FOLLOWLOCATION, 1L);
+            curl_easy_setopt(curlObject, CURLOPT_CONNECTTIMEOUT, 4);
+            curl_easy_setopt(curlObject, CURLOPT_TIMEOUT, request.GetMaxRequestTime());
+            curl_easy_setopt(curlObject, CURLOPT_WRITEDATA, &outBuffer);
+            curl_easy_setopt(curlObject, CURLOPT_WRITEFUNCTION, &PooledCurlApi::WriteFunction);
+
+            if (this->useHttp2) {
+                curl_easy_setopt(curlObject, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+            }
+
+            if (!this->certificateAuthority.empty()) {
+                curl_easy_setopt(curlObject, CURLOPT_CAINFO, this->certificateAuthority.c_str());
+            }
+
+            CURLcode result = curl_easy_perform(curlObject);
+            curl_slist_free_all(curlHeaders);
+
+            if (result != CURLE_OK) {
+                LogError("cURL Error (" + std::to_string(result) +")");
+                this->ReturnHandle(curlObject);
+                return CurlResponse("", true, -1);
+            }
+
+            uint64_t responseCode = 0;
+            curl_easy_getinfo(curlObject, CURLINFO_RESPONSE_CODE, &responseCode);
+            this->ReturnHandle(curlObject);
+
+            return CurlResponse(outBuffer, false, responseCode);
+        }
+
+        bool PooledCurlApi::UsingHttp2(void) const
+        {
+            return this->useHttp2;
+        }
+
+        /*
+            Take an idle handle if there is one, otherwise make a new one that uses the share. Resetting
+            the handle clears its options but keeps its connections and caches.
+        */
+        CURL * PooledCurlApi::TakeHandle(void)
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->idleHandlesLock);
+                if (!this->idleHandles.empty()) {
+                    CURL * handle = this->idleHandles.back();
+                    this->idleHandles.pop_back();
+                    curl_easy_reset(handle);
+                    return handle;
+                }
+            }
+
+            CURL * handle = curl_easy_init();
+            curl_easy_setopt(handle, CURLOPT_SHARE, this->share);
+            return handle;
+        }
+
+        /*
+            Put a handle back in the pool, or clean it up if there are already enough idle handles.
+        */
+        void PooledCurlApi::ReturnHandle(CURL * handle)
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->idleHandlesLock);
+                if (this->idleHandles.size() < this->maxIdleHandles) {
+                    this->idleHandles.push_back(handle);
+                    return;
+                }
+            }
+
+            curl_easy_cleanup(handle);
+        }
+
+        bool PooledCurlApi::Http2Supported(void)
+        {
+            return (curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP2) != 0;
+        }
+
+        void PooledCurlApi::LockShare(CURL * handle, curl_lock_data data, curl_lock_access access, void * api)
+        {
+            reinterpret_cast<PooledCurlApi *>(api)->shareLocks[data].lock();
+        }
+
+        void PooledCurlApi::UnlockShare(CURL * handle, curl_lock_data data, void * api)
+        {
+            reinterpret_cast<PooledCurlApi *>(api)->shareLocks[data].unlock();
+        }
+
+        /*
+            This function is called by Curl once it has received data, to store it in the output buffer.
+        */
+        size_t PooledCurlApi::WriteFunction(void * contents, size_t size, size_t nmemb, void * outString)
+        {
+            reinterpret_cast<std::string *>(outString)->append(reinterpret_cast<char *>(contents), size * nmemb);
+            return size * nmemb;
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
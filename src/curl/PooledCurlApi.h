@@ -0,0 +1,63 @@
+#pragma once
+#include "curl/CurlInterface.h"
+#include "curl/curl.h"
+
+namespace UKControllerPlugin {
+    namespace Curl {
+
+        /*
+            An API to the CURL library that keeps its easy handles between requests, rather than
+            creating a new one for every request.
+
+            A reused handle keeps its connections open, so further requests to the same host skip the
+            TCP and TLS handshakes. DNS lookups and TLS sessions are shared between all the handles, so
+            a handle connecting for the first time can resume a session rather than doing a full
+            handshake. HTTP/2 is negotiated with the server if libcurl supports it.
+        */
+        class PooledCurlApi : public CurlInterface
+        {
+            public:
+                PooledCurlApi(void);
+                PooledCurlApi(bool useHttp2, size_t maxIdleHandles, std::string certificateAuthority);
+                ~PooledCurlApi(void);
+                UKControllerPlugin::Curl::CurlResponse MakeCurlRequest(
+                    const UKControllerPlugin::Curl::CurlRequest & request
+                ) override;
+                size_t CountIdleHandles(void) const;
+                bool UsingHttp2(void) const;
+
+                // How many idle handles to keep by default, a few more than there are task runner threads
+                static const size_t defaultMaxIdleHandles = 8;
+
+            private:
+
+                CURL * TakeHandle(void);
+                void ReturnHandle(CURL * handle);
+                static bool Http2Supported(void);
+                static void LockShare(CURL * handle, curl_lock_data data, curl_lock_access access, void * api);
+                static void UnlockShare(CURL * handle, curl_lock_data data, void * api);
+                static size_t WriteFunction(void * contents, size_t size, size_t nmemb, void * outString);
+
+                // Whether to ask for HTTP/2
+                const bool useHttp2;
+
+                // The most handles to keep hold of when they aren't in use
+                const size_t maxIdleHandles;
+
+                // A certificate authority bundle to use instead of the default, if not empty
+                const std::string certificateAuthority;
+
+                // Shares the DNS and TLS session caches between handles
+                CURLSH * share;
+
+                // Locks for each type of data in the share
+                std::mutex shareLocks[CURL_LOCK_DATA_LAST];
+
+                // Protects the idle handles
+                mutable std::mutex idleHandlesLock;
+
+                // Handles that aren't currently making a request
+                std::vector<CURL *> idleHandles;
+        };
+    }  // namespace Curl
+}  // namespace UKControllerPlugin
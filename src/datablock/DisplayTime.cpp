@@ -9,12 +9,24 @@ using UKControllerPlugin::Euroscope::GeneralSettingsEntries;
 namespace UKControllerPlugin {
     namespace Datablock {
 
+        /*
+            Format every minute of the day, the epoch being midnight.
+        */
+        DisplayTime::DisplayTime(void)
+        {
+            std::chrono::system_clock::time_point midnight;
+            this->minuteStrings.reserve(this->minutesPerDay);
+            for (int minute = 0; minute < this->minutesPerDay; minute++) {
+                this->minuteStrings.push_back(date::format(this->timeFormat, midnight + std::chrono::minutes(minute)));
+            }
+        }
+
         /*
             Converts a timestamp to its Zulu string representation for display.
         */
         std::string DisplayTime::FromTimestamp(time_t time) const
         {
-            return date::format(this->timeFormat, std::chrono::system_clock::from_time_t(time));
+            return this->GetTimeString(std::chrono::system_clock::from_time_t(time));
         }
 
         /*
@@ -23,7 +35,7 @@ namespace UKControllerPlugin {
         */
         std::string DisplayTime::FromSystemTime(void) const
         {
-            return date::format(this->timeFormat, std::chrono::system_clock::now());
+            return this->GetTimeString(std::chrono::system_clock::now());
         }
 
         /*
@@ -32,7 +44,19 @@ namespace UKControllerPlugin {
         */
         std::string DisplayTime::FromTimePoint(std::chrono::system_clock::time_point tp) const
         {
-            return date::format(this->timeFormat, tp);
+            return this->GetTimeString(tp);
+        }
+
+        /*
+            Returns the Zulu string representation of a time point without formatting
+            or copying, for use when filling tag items.
+        */
+        const std::string & DisplayTime::GetTimeString(std::chrono::system_clock::time_point tp) const
+        {
+            int minute = static_cast<int>(
+                date::floor<std::chrono::minutes>(tp).time_since_epoch().count() % this->minutesPerDay
+            );
+            return this->minuteStrings[minute < 0 ? minute + this->minutesPerDay : minute];
         }
 
         /*
@@ -8,14 +8,20 @@ namespace UKControllerPlugin {
             A class for converting times to string representations, providing
             a wrapper for Howard Hinnant's date library. Also provides format
             for "missing times" - blank or --:--.
+
+            Times are only displayed to the minute, so every possible string is formatted
+            once up front and looked up by minute of the day, rather than formatting
+            on every tag refresh.
         */
         class DisplayTime : public UKControllerPlugin::Euroscope::UserSettingAwareInterface
         {
             public:
+                DisplayTime(void);
                 std::string FromTimestamp(time_t time) const;
                 std::string FromSystemTime(void) const;
                 std::string FromTimePoint(std::chrono::system_clock::time_point tp) const;
-                inline std::string GetUnknownTimeFormat(void) const
+                const std::string & GetTimeString(std::chrono::system_clock::time_point tp) const;
+                inline const std::string & GetUnknownTimeFormat(void) const
                 {
                     return this->useBlankTimeForUnknown
                         ? this->unknownTimeFormatBlank
@@ -34,8 +40,14 @@ namespace UKControllerPlugin {
                 // The format to use for unknown times when the user has specifically stated that they want it blank
                 const std::string unknownTimeFormatBlank = "";
 
+                // How many different times there are to display
+                static const int minutesPerDay = 1440;
+
             private:
 
+                // The formatted time for each minute of the day
+                std::vector<std::string> minuteStrings;
+
                 // Whether or not blank times should be used for unknown times.
                 bool useBlankTimeForUnknown = false;
         };
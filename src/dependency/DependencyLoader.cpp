@@ -1,14 +1,26 @@
 #include "pch/stdafx.h"
 #include "dependency/DependencyLoader.h"
+#include "dependency/DependencySnapshot.h"
 #include "helper/HelperFunctions.h"
 
 namespace UKControllerPlugin {
     namespace Dependency {
 
         DependencyLoader::DependencyLoader(UKControllerPlugin::Windows::WinApiInterface& filesystem)
-            : filesystem(filesystem)
+            : DependencyLoader(filesystem, {})
         {
+
+        }
+
+        DependencyLoader::DependencyLoader(
+            UKControllerPlugin::Windows::WinApiInterface& filesystem,
+            std::map<std::string, nlohmann::json> downloadedDependencies
+        )
+            : filesystem(filesystem), loadedDependencies(std::move(downloadedDependencies))
+        {
+            this->snapshotStale = !this->loadedDependencies.empty();
             this->LoadDependencyMap();
+            this->LoadSnapshot();
         }
 
         /*
@@ -16,6 +28,29 @@ namespace UKControllerPlugin {
         */
         nlohmann::json DependencyLoader::LoadDependency(std::string key, nlohmann::json defaultValue) noexcept
         {
+            std::lock_guard<std::mutex> lock(this->loadLock);
+            return this->LoadDependencyWithLockHeld(key, std::move(defaultValue));
+        }
+
+        /*
+            Loads a dependency from memory, or failing that, the filesystem. The load lock must be held.
+        */
+        nlohmann::json DependencyLoader::LoadDependencyWithLockHeld(
+            const std::string & key,
+            nlohmann::json defaultValue
+        ) {
+            std::map<std::string, nlohmann::json>::iterator loaded = this->loadedDependencies.find(key);
+            if (loaded != this->loadedDependencies.end()) {
+                // If there's no snapshot to write, nothing else needs it, so hand it over rather than copy
+                if (this->snapshotStale) {
+                    return loaded->second;
+                }
+
+                nlohmann::json dependency = std::move(loaded->second);
+                this->loadedDependencies.erase(loaded);
+                return dependency;
+            }
+
             if (!this->fileMap.count(key)) {
                 LogWarning("Dependency " + key + " does not exist in file map");
                 return defaultValue;
@@ -30,9 +65,16 @@ namespace UKControllerPlugin {
 
             try
             {
-                return nlohmann::json::parse(
+                nlohmann::json dependency = nlohmann::json::parse(
                     this->filesystem.ReadFromFile(this->DEPENDENCY_FOLDER + L"/" + wideKey)
                 );
+
+                // Keep hold of it for the next snapshot
+                if (this->updatedAt.count(key)) {
+                    this->loadedDependencies[key] = dependency;
+                }
+
+                return dependency;
             } catch (nlohmann::json::exception) {
                 LogWarning("Unable to load dependency " + key + ", it is not valid JSON");
             }
@@ -40,6 +82,83 @@ namespace UKControllerPlugin {
             return defaultValue;
         }
 
+        /*
+            Take every dependency that the snapshot has the current version of.
+        */
+        void DependencyLoader::LoadSnapshot(void)
+        {
+            if (this->updatedAt.empty()) {
+                return;
+            }
+
+            if (!this->filesystem.FileExists(this->SNAPSHOT_FILE)) {
+                LogInfo("No dependency snapshot found");
+                this->snapshotStale = true;
+                return;
+            }
+
+            DependencySnapshot snapshot;
+            try {
+                snapshot = DependencySnapshot::Deserialise(this->filesystem.ReadBinaryFromFile(this->SNAPSHOT_FILE));
+            } catch (std::invalid_argument exception) {
+                LogWarning("Unable to use dependency snapshot: " + std::string(exception.what()));
+                this->snapshotStale = true;
+                return;
+            }
+
+            size_t fromSnapshot = 0;
+            for (
+                std::map<std::string, int>::const_iterator it = this->updatedAt.cbegin();
+                it != this->updatedAt.cend();
+                ++it
+            ) {
+                if (this->loadedDependencies.count(it->first)) {
+                    continue;
+                }
+
+                if (!snapshot.HasDependency(it->first, it->second)) {
+                    this->snapshotStale = true;
+                    continue;
+                }
+
+                this->loadedDependencies[it->first] = std::move(snapshot.GetDependency(it->first));
+                fromSnapshot++;
+            }
+
+            LogInfo("Loaded " + std::to_string(fromSnapshot) + " dependencies from snapshot");
+        }
+
+        /*
+            If the snapshot is out of date, write a new one with every dependency in the dependency list.
+        */
+        void DependencyLoader::SaveSnapshot(void)
+        {
+            std::lock_guard<std::mutex> lock(this->loadLock);
+            if (!this->snapshotStale || this->updatedAt.empty()) {
+                return;
+            }
+
+            DependencySnapshot snapshot;
+            for (
+                std::map<std::string, int>::const_iterator it = this->updatedAt.cbegin();
+                it != this->updatedAt.cend();
+                ++it
+            ) {
+                // Dependencies that no module asked for still need to be in the snapshot
+                if (!this->loadedDependencies.count(it->first)) {
+                    this->LoadDependencyWithLockHeld(it->first, nullptr);
+                }
+
+                if (this->loadedDependencies.count(it->first)) {
+                    snapshot.AddDependency(it->first, it->second, this->loadedDependencies.at(it->first));
+                }
+            }
+
+            this->filesystem.WriteBinaryToFile(this->SNAPSHOT_FILE, snapshot.Serialise());
+            this->snapshotStale = false;
+            LogInfo("Saved dependency snapshot with " + std::to_string(snapshot.Count()) + " dependencies");
+        }
+
         /*
             Creates the dependency filemap based on the dependency list.
         */
@@ -69,6 +188,11 @@ namespace UKControllerPlugin {
                 }
 
                 this->fileMap[it->at("key")] = it->at("local_file");
+
+                // Only dependencies with an updated_at stamp can go in the snapshot
+                if (it->contains("updated_at") && it->at("updated_at").is_number_integer()) {
+                    this->updatedAt[it->at("key")] = it->at("updated_at");
+                }
             }
 
             LogInfo("Loaded local dependency file map");
@@ -9,6 +9,12 @@ namespace UKControllerPlugin {
         /*
             A class that is responsible for loading dependencies
             off of the filesystem.
+
+            Dependencies that have just been downloaded can be handed over directly, in which case
+            they are returned as-is rather than being read back from the filesystem. Anything else
+            is taken from the binary snapshot if it is up to date, falling back to the JSON files.
+
+            Dependencies may be loaded from several threads at once, such as by module warm-ups.
         */
         class DependencyLoader : public DependencyLoaderInterface
         {
@@ -16,14 +22,23 @@ namespace UKControllerPlugin {
                 DependencyLoader(
                     UKControllerPlugin::Windows::WinApiInterface& filesystem
                 );
+                DependencyLoader(
+                    UKControllerPlugin::Windows::WinApiInterface& filesystem,
+                    std::map<std::string, nlohmann::json> downloadedDependencies
+                );
 
                 nlohmann::json LoadDependency(std::string key , nlohmann::json defaultValue) noexcept override;
+                void SaveSnapshot(void);
 
                 const std::wstring DEPENDENCY_FOLDER = L"dependencies";
 
+                const std::wstring SNAPSHOT_FILE = L"dependencies/dependency-snapshot.bin";
+
             private:
 
+                nlohmann::json LoadDependencyWithLockHeld(const std::string & key, nlohmann::json defaultValue);
                 void LoadDependencyMap(void);
+                void LoadSnapshot(void);
                 bool ValidDependency(const nlohmann::json& dependency) const;
 
                 // The filesystem.
@@ -32,6 +47,19 @@ namespace UKControllerPlugin {
 
                 // A map of dependency to files.
                 std::map<std::string, std::string> fileMap;
+
+                // A map of dependency to its updated_at stamp in the dependency list.
+                std::map<std::string, int> updatedAt;
+
+                // Dependencies that are already in memory, because they were downloaded this session,
+                // came from the snapshot or have already been read from disk.
+                std::map<std::string, nlohmann::json> loadedDependencies;
+
+                // Whether the snapshot on disk is missing something or out of date
+                bool snapshotStale = false;
+
+                // Protects the loaded dependencies whilst loading and saving
+                std::mutex loadLock;
         };
     }  // namespace Dependency
 }  // namespace UKControllerPlugin
@@ -0,0 +1,83 @@
+#include "pch/stdafx.h"
+#include "dependency/DependencySnapshot.h"
+
+namespace UKControllerPlugin {
+    namespace Dependency {
+
+        const std::string DependencySnapshot::magic = "UKCPDEPS";
+
+        void DependencySnapshot::AddDependency(std::string key, int updatedAt, nlohmann::json data)
+        {
+            this->dependencies[key] = {
+                { "updated_at", updatedAt },
+                { "data", std::move(data) }
+            };
+        }
+
+        size_t DependencySnapshot::Count(void) const
+        {
+            return this->dependencies.size();
+        }
+
+        /*
+            Read a snapshot back in, throwing std::invalid_argument if it isn't one we understand.
+        */
+        DependencySnapshot DependencySnapshot::Deserialise(const std::string & snapshot)
+        {
+            size_t headerSize = magic.size() + 1;
+            if (snapshot.size() < headerSize || snapshot.compare(0, magic.size(), magic) != 0) {
+                throw std::invalid_argument("Not a dependency snapshot");
+            }
+
+            if (static_cast<uint8_t>(snapshot[magic.size()]) != formatVersion) {
+                throw std::invalid_argument("Dependency snapshot is from a different format version");
+            }
+
+            DependencySnapshot loaded;
+            try {
+                loaded.dependencies = nlohmann::json::from_msgpack(
+                    reinterpret_cast<const uint8_t *>(snapshot.data()) + headerSize,
+                    snapshot.size() - headerSize
+                );
+            } catch (nlohmann::json::exception) {
+                throw std::invalid_argument("Dependency snapshot is corrupt");
+            }
+
+            if (!loaded.dependencies.is_object()) {
+                throw std::invalid_argument("Dependency snapshot is corrupt");
+            }
+
+            return loaded;
+        }
+
+        /*
+            Returns the data for a dependency, which may be moved out.
+        */
+        nlohmann::json & DependencySnapshot::GetDependency(std::string key)
+        {
+            return this->dependencies.at(key).at("data");
+        }
+
+        /*
+            Whether the snapshot has the given version of a dependency.
+        */
+        bool DependencySnapshot::HasDependency(std::string key, int updatedAt) const
+        {
+            nlohmann::json::const_iterator dependency = this->dependencies.find(key);
+            return dependency != this->dependencies.cend() &&
+                dependency->is_object() &&
+                dependency->contains("updated_at") &&
+                dependency->contains("data") &&
+                dependency->at("updated_at").is_number_integer() &&
+                dependency->at("updated_at").get<int>() == updatedAt;
+        }
+
+        std::string DependencySnapshot::Serialise(void) const
+        {
+            std::string snapshot = magic;
+            snapshot.push_back(static_cast<char>(formatVersion));
+            nlohmann::json::to_msgpack(this->dependencies, snapshot);
+            return snapshot;
+        }
+    }  // namespace Dependency
+}  // namespace UKControllerPlugin
@@ -0,0 +1,36 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Dependency {
+
+        /*
+            A binary snapshot of parsed dependencies, so they can be loaded without parsing JSON text.
+
+            The format is an eight byte magic string, a one byte format version and then
+            a MessagePack encoded object of dependency key to the dependency's updated_at
+            stamp and data. Each dependency is only used if its stamp matches the dependency
+            list, so anything that has changed since the snapshot was taken is loaded fresh.
+        */
+        class DependencySnapshot
+        {
+            public:
+                void AddDependency(std::string key, int updatedAt, nlohmann::json data);
+                size_t Count(void) const;
+                static DependencySnapshot Deserialise(const std::string & snapshot);
+                nlohmann::json & GetDependency(std::string key);
+                bool HasDependency(std::string key, int updatedAt) const;
+                std::string Serialise(void) const;
+
+                // Identifies a snapshot file
+                static const std::string magic;
+
+                // Bump whenever the layout changes, old snapshots are then ignored
+                static constexpr uint8_t formatVersion = 1;
+
+            private:
+
+                // Dependency key to updated_at stamp and data
+                nlohmann::json dependencies = nlohmann::json::object();
+        };
+    }  // namespace Dependency
+}  // namespace UKControllerPlugin
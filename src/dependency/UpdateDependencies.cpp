@@ -65,8 +65,81 @@ namespace UKControllerPlugin {
                 local.at(key).at("updated_at").get<int>() < remote.at(key).at("updated_at").get<int>();
         }
 
-        void UpdateDependencies(const ApiInterface& api, WinApiInterface& filesystem)
+        std::map<std::string, nlohmann::json> UpdateDependencies(const ApiInterface& api, WinApiInterface& filesystem)
         {
+            return UpdateDependencies(api, filesystem, defaultConcurrentDownloads);
+        }
+
+        /*
+            Download the given dependencies, up to maxConcurrentDownloads at a time. The results are
+            in the same order as the dependencies, with false for any that failed.
+
+            The downloads run on their own threads, so nothing may escape them, or the plugin is terminated.
+        */
+        std::vector<std::pair<bool, nlohmann::json>> DownloadDependencies(
+            const ApiInterface& api,
+            const std::vector<nlohmann::json>& dependencies,
+            size_t maxConcurrentDownloads
+        ) {
+            std::vector<std::pair<bool, nlohmann::json>> downloads(dependencies.size(), { false, nullptr });
+            std::atomic<size_t> nextDownload(0);
+
+            auto downloader = [&api, &dependencies, &downloads, &nextDownload]() {
+                for (size_t index = nextDownload++; index < dependencies.size(); index = nextDownload++) {
+                    const nlohmann::json& dependency = dependencies[index];
+                    try {
+                        downloads[index] = { true, api.GetUri(dependency.at("uri").get<std::string>()) };
+                        LogInfo("New version of dependency " + dependency.at("key").get<std::string>() + " downloaded");
+                    }
+                    catch (ApiException & exception) {
+                        downloads[index] = { false, nullptr };
+                        LogError("Unable to download dependency file: " + std::string(exception.what()));
+                    }
+                    catch (std::exception & exception) {
+                        downloads[index] = { false, nullptr };
+                        LogError("Exception when downloading dependency file: " + std::string(exception.what()));
+                    }
+                    catch (...) {
+                        downloads[index] = { false, nullptr };
+                        LogError("Unknown exception when downloading dependency file");
+                    }
+                }
+            };
+
+            // The calling thread downloads too, so only start the extra ones that are needed
+            std::vector<std::thread> downloaders;
+            size_t threads = (std::min)(maxConcurrentDownloads, dependencies.size());
+            try {
+                downloaders.reserve(threads);
+                for (size_t thread = 1; thread < threads; thread++) {
+                    downloaders.push_back(std::thread(downloader));
+                }
+            } catch (std::exception & exception) {
+                // Whatever hasn't been picked up by the threads that did start gets downloaded below
+                LogWarning("Unable to start dependency download thread: " + std::string(exception.what()));
+            }
+
+            // The downloader doesn't throw, so every thread started is always joined
+            downloader();
+            for (std::thread& thread : downloaders) {
+                thread.join();
+            }
+
+            return downloads;
+        }
+
+        /*
+            Download any dependencies that have changed and save them to the filesystem. Returns the
+            dependencies that were downloaded, keyed by dependency, so they can be used without
+            reading them back from disk.
+        */
+        std::map<std::string, nlohmann::json> UpdateDependencies(
+            const ApiInterface& api,
+            WinApiInterface& filesystem,
+            size_t maxConcurrentDownloads
+        ) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
             // Download the dependency list and save it to the filesystem
             LogInfo("Loading existing dependencies");
             std::map<std::string, nlohmann::json> existingDependencies = LoadDependencyListFromFilesystem(filesystem);
@@ -78,11 +151,11 @@ namespace UKControllerPlugin {
                 LogInfo("Downloaded new dependency list");
             } catch (ApiException exception) {
                 LogError("Unable to download dependency list: " + std::string(exception.what()));
-                return;
+                return {};
             }
 
-            // Loop the dependencies and download just the ones we need.
-            nlohmann::json dependencyListToSave = nlohmann::json::array();
+            // Work out just the ones we need.
+            std::vector<nlohmann::json> toDownload;
             for (
                 std::map<std::string, nlohmann::json>::const_iterator it = newDependencies.cbegin();
                 it != newDependencies.cend();
@@ -95,28 +168,62 @@ namespace UKControllerPlugin {
                     !NeedsDownload(existingDependencies, newDependencies, it->first)
                 ) {
                     LogInfo("Dependency " + it->first + " is up to date, skipping download");
-                    dependencyListToSave.push_back(it->second);
                     continue;
                 }
 
-                try {
-                    LogInfo("Dependency " + it->first + " has a new version available, downloading");
-                    filesystem.WriteToFile(
-                        L"dependencies/" + widePath,
-                        api.GetUri(it->second.at("uri").get<std::string>()).dump(),
-                        true
-                    );
-                    dependencyListToSave.push_back(it->second);
-                    LogInfo("New version of dependency " + it->first + " has been downloaded");
-                }
-                catch (ApiException exception) {
-                    LogError("Unable to download dependency file: " + std::string(exception.what()));
+                LogInfo("Dependency " + it->first + " has a new version available, downloading");
+                toDownload.push_back(it->second);
+            }
+
+            std::chrono::steady_clock::time_point downloadStart = std::chrono::steady_clock::now();
+            std::vector<std::pair<bool, nlohmann::json>> downloads = DownloadDependencies(
+                api,
+                toDownload,
+                maxConcurrentDownloads
+            );
+            std::chrono::steady_clock::time_point downloadEnd = std::chrono::steady_clock::now();
+
+            // Save what we downloaded and leave anything that failed out of the saved list, so it's tried again.
+            std::map<std::string, nlohmann::json> downloaded;
+            std::set<std::string> failed;
+            for (size_t index = 0; index < toDownload.size(); index++) {
+                std::string key = toDownload[index].at("key").get<std::string>();
+                if (!downloads[index].first) {
+                    failed.insert(key);
                     continue;
                 }
+
+                filesystem.WriteToFile(
+                    L"dependencies/" + HelperFunctions::ConvertToWideString(toDownload[index].at("local_file")),
+                    downloads[index].second.dump(),
+                    true
+                );
+                downloaded[key] = std::move(downloads[index].second);
+            }
+
+            nlohmann::json dependencyListToSave = nlohmann::json::array();
+            for (
+                std::map<std::string, nlohmann::json>::const_iterator it = newDependencies.cbegin();
+                it != newDependencies.cend();
+                ++it
+            ) {
+                if (!failed.count(it->first)) {
+                    dependencyListToSave.push_back(it->second);
+                }
             }
 
             filesystem.WriteToFile(dependencyListFile, dependencyListToSave.dump(), true);
-            LogInfo("Finished downloading dependency files");
+            LogInfo(
+                "Finished downloading dependency files in " + std::to_string(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+                    .count()
+                ) + "ms: " + std::to_string(downloaded.size()) + " downloaded in " + std::to_string(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(downloadEnd - downloadStart).count()
+                ) + "ms, " + std::to_string(newDependencies.size() - toDownload.size()) + " up to date, " +
+                std::to_string(failed.size()) + " failed"
+            );
+
+            return downloaded;
         }
 
         bool ValidDependency(const nlohmann::json& dependency)
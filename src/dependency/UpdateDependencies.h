@@ -5,6 +5,14 @@
 namespace UKControllerPlugin {
     namespace Dependency {
 
+        // How many dependencies to download at the same time
+        const size_t defaultConcurrentDownloads = 4;
+
+        std::vector<std::pair<bool, nlohmann::json>> DownloadDependencies(
+            const UKControllerPlugin::Api::ApiInterface & api,
+            const std::vector<nlohmann::json> & dependencies,
+            size_t maxConcurrentDownloads
+        );
         std::map<std::string, nlohmann::json> LoadDependencyList(
             const nlohmann::json dependencyList
         );
@@ -16,10 +24,15 @@ namespace UKControllerPlugin {
             const std::map<std::string, nlohmann::json>& remote,
             std::string key
         );
-        void UpdateDependencies(
+        std::map<std::string, nlohmann::json> UpdateDependencies(
             const UKControllerPlugin::Api::ApiInterface & api,
             UKControllerPlugin::Windows::WinApiInterface & filesystem
         );
+        std::map<std::string, nlohmann::json> UpdateDependencies(
+            const UKControllerPlugin::Api::ApiInterface & api,
+            UKControllerPlugin::Windows::WinApiInterface & filesystem,
+            size_t maxConcurrentDownloads
+        );
 
         bool ValidDependency(const nlohmann::json & dependency);
     }  // namespace Dependency
@@ -36,6 +36,17 @@ namespace UKControllerPlugin {
                 ) = 0;
                 virtual void ToogleMenu(RECT area, std::string title, int numColumns) = 0;
                 virtual POINT ConvertCoordinateToScreenPoint(EuroScopePlugIn::CPosition pos) = 0;
+
+                /*
+                    Converts a batch of coordinates to screen points in one go, so that callers
+                    drawing lots of points only go through the interface once.
+                */
+                virtual void ConvertCoordinatesToScreenPoints(
+                    const double * latitudes,
+                    const double * longitudes,
+                    size_t count,
+                    POINT * points
+                ) = 0;
         };
     }  // namespace Euroscope
 }  // namespace UKControllerPlugin
@@ -47,8 +47,14 @@ class EuroscopePluginLoopbackInterface
             GetSelectedRadarTarget() const = 0;
         virtual void TriggerPopupList(RECT area, std::string title, int numColumns) = 0;
         virtual void TriggerFlightplanUpdateForCallsign(std::string callsign) = 0;
+        virtual void MarkFlightplanDirty(std::string callsign) = 0;
         virtual void RegisterTagFunction(int itemCode, std::string description) = 0;
         virtual void RegisterTagItem(int itemCode, std::string description) = 0;
+
+        /*
+            Read-only iteration over every flightplan that has a radar target. This does not
+            trigger any flightplan events, use MarkFlightplanDirty for any aircraft that have changed.
+        */
         virtual void ApplyFunctionToAllFlightplans(
             std::function<
                 void(
@@ -1,13 +1,31 @@
 #include "pch/stdafx.h"
 #include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "euroscope/RadarTargetEventHandlerInterface.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "performance/ScopedHandlerTimer.h"
 
 using UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using UKControllerPlugin::Performance::ScopedHandlerTimer;
 
 namespace UKControllerPlugin {
     namespace Euroscope {
 
+        RadarTargetEventHandlerCollection::RadarTargetEventHandlerCollection(void)
+            : RadarTargetEventHandlerCollection(std::make_shared<HandlerMetricsCollection>())
+        {
+
+        }
+
+        RadarTargetEventHandlerCollection::RadarTargetEventHandlerCollection(
+            std::shared_ptr<HandlerMetricsCollection> metrics
+        )
+            : metrics(metrics)
+        {
+
+        }
+
         /*
             Returns the number of registered handlers.
         */
@@ -23,12 +41,12 @@ namespace UKControllerPlugin {
         {
             // Loop through the handlers and call their handling function.
             for (
-                std::set<std::shared_ptr<RadarTargetEventHandlerInterface>>::const_iterator it =
-                    this->handlerList.cbegin();
+                std::vector<RegisteredHandler>::const_iterator it = this->handlerList.cbegin();
                 it != this->handlerList.cend();
                 ++it
             ) {
-                (*it)->RadarTargetPositionUpdateEvent(radarTarget);
+                ScopedHandlerTimer timer(*it->metrics);
+                it->handler->RadarTargetPositionUpdateEvent(radarTarget);
             }
         }
 
@@ -38,7 +56,22 @@ namespace UKControllerPlugin {
         void RadarTargetEventHandlerCollection::RegisterHandler(
             std::shared_ptr<RadarTargetEventHandlerInterface> handler
         ) {
-            this->handlerList.insert(handler);
+            auto existing = std::find_if(
+                this->handlerList.cbegin(),
+                this->handlerList.cend(),
+                [&handler](const RegisteredHandler & registered) { return registered.handler == handler; }
+            );
+
+            if (existing != this->handlerList.cend()) {
+                return;
+            }
+
+            this->handlerList.push_back(
+                {
+                    handler,
+                    this->metrics->Register("RadarTarget " + HandlerMetricsCollection::NameFromType(typeid(*handler)))
+                }
+            );
         }
     }  // namespace Euroscope
 }  // namespace UKControllerPlugin
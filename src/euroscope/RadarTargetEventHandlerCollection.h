@@ -4,6 +4,10 @@ namespace UKControllerPlugin {
         class EuroScopeCRadarTargetInterface;
         class RadarTargetEventHandlerInterface;
     }  // namespace Euroscope
+    namespace Performance {
+        class HandlerMetrics;
+        class HandlerMetricsCollection;
+    }  // namespace Performance
 }  // namespace UKControllerPlugin
 
 namespace UKControllerPlugin {
@@ -11,11 +15,15 @@ namespace UKControllerPlugin {
 
         /*
             A repository of event handlers for RadarTarget events. When an event is received, it will
-            call each of the handlers in turn.
+            call each of the handlers in turn, recording how long each one takes.
         */
         class RadarTargetEventHandlerCollection
         {
             public:
+                RadarTargetEventHandlerCollection(void);
+                explicit RadarTargetEventHandlerCollection(
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics
+                );
                 int CountHandlers(void) const;
                 void RadarTargetEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
@@ -23,8 +31,17 @@ namespace UKControllerPlugin {
                 void RegisterHandler(std::shared_ptr<RadarTargetEventHandlerInterface> handler);
 
             private:
-                // Set of registered handlers
-                std::set<std::shared_ptr<RadarTargetEventHandlerInterface>> handlerList;
+
+                typedef struct RegisteredHandler {
+                    std::shared_ptr<RadarTargetEventHandlerInterface> handler;
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetrics> metrics;
+                } RegisteredHandler;
+
+                // Where handler metrics are kept
+                const std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics;
+
+                // Registered handlers
+                std::vector<RegisteredHandler> handlerList;
         };
     }  // namespace Euroscope
 }  // namespace UKControllerPlugin
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Flightplan {
+
+        /*
+            A handle to an aircraft that has been interned by the callsign registry.
+
+            The index is dense and is recycled once the aircraft disconnects. The generation
+            is bumped each time an index is reused, so that a handle for an aircraft that
+            has since disconnected never matches data stored for whoever took its place.
+        */
+        typedef struct AircraftId
+        {
+            unsigned int index;
+            unsigned int generation;
+
+            bool operator==(const AircraftId & compare) const
+            {
+                return this->index == compare.index && this->generation == compare.generation;
+            }
+
+            bool operator!=(const AircraftId & compare) const
+            {
+                return !(*this == compare);
+            }
+        } AircraftId;
+
+        // Returned when an aircraft isn't known to the registry
+        const AircraftId invalidAircraftId = { UINT_MAX, UINT_MAX };
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
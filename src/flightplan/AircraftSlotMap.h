@@ -0,0 +1,135 @@
+#pragma once
+#include "flightplan/AircraftId.h"
+
+namespace UKControllerPlugin {
+    namespace Flightplan {
+
+        /*
+            Per-aircraft data, stored contiguously and indexed by the id handed out by
+            the callsign registry.
+
+            Each slot remembers the generation of the id that it was stored against, so data
+            for an aircraft that has disconnected is never returned for whoever gets its id next,
+            regardless of the order in which the disconnect event reaches the registry and the cache.
+        */
+        template <typename T>
+        class AircraftSlotMap
+        {
+            public:
+
+                /*
+                    Clear everything.
+                */
+                void Clear(void)
+                {
+                    for (typename std::vector<Slot>::iterator it = this->slots.begin(); it != this->slots.end(); ++it) {
+                        it->set = false;
+                    }
+                    this->count = 0;
+                }
+
+                size_t Count(void) const
+                {
+                    return this->count;
+                }
+
+                /*
+                    Remove the data for an aircraft, if there is any.
+                */
+                void Erase(AircraftId id)
+                {
+                    if (this->Find(id) == nullptr) {
+                        return;
+                    }
+
+                    this->slots[id.index].set = false;
+                    this->count--;
+                }
+
+                /*
+                    Remove all the data that matches a predicate.
+                */
+                template <typename Predicate>
+                void EraseIf(Predicate predicate)
+                {
+                    for (typename std::vector<Slot>::iterator it = this->slots.begin(); it != this->slots.end(); ++it) {
+                        if (it->set && predicate(it->value)) {
+                            it->set = false;
+                            this->count--;
+                        }
+                    }
+                }
+
+                /*
+                    Return the data for an aircraft, or nullptr if there is none.
+                */
+                T * Find(AircraftId id)
+                {
+                    if (
+                        id.index >= this->slots.size() ||
+                        !this->slots[id.index].set ||
+                        this->slots[id.index].generation != id.generation
+                    ) {
+                        return nullptr;
+                    }
+
+                    return &this->slots[id.index].value;
+                }
+
+                const T * Find(AircraftId id) const
+                {
+                    return const_cast<AircraftSlotMap<T> *>(this)->Find(id);
+                }
+
+                /*
+                    Return the data for an aircraft, creating it with the default value if there is none.
+                */
+                T & FirstOrNew(AircraftId id)
+                {
+                    T * existing = this->Find(id);
+                    if (existing != nullptr) {
+                        return *existing;
+                    }
+
+                    return this->Set(id, T());
+                }
+
+                /*
+                    Store the data for an aircraft, replacing anything there already.
+                */
+                T & Set(AircraftId id, T value)
+                {
+                    if (id.index >= this->slots.size()) {
+                        this->slots.resize(id.index + 1);
+                    }
+
+                    Slot & slot = this->slots[id.index];
+                    if (!slot.set || slot.generation != id.generation) {
+                        if (!slot.set) {
+                            this->count++;
+                        }
+                        slot.set = true;
+                        slot.generation = id.generation;
+                    }
+
+                    slot.value = std::move(value);
+                    return slot.value;
+                }
+
+            private:
+
+                typedef struct Slot
+                {
+                    T value;
+                    unsigned int generation = 0;
+                    bool set = false;
+                } Slot;
+
+                // The slots, indexed by aircraft id
+                std::vector<Slot> slots;
+
+                // How many slots have data
+                size_t count = 0;
+        };
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
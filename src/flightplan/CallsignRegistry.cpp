@@ -0,0 +1,117 @@
+#include "pch/stdafx.h"
+#include "flightplan/CallsignRegistry.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+
+namespace UKControllerPlugin {
+    namespace Flightplan {
+
+        size_t CallsignRegistry::CountActive(void) const
+        {
+            return this->indexes.size();
+        }
+
+        /*
+            How many slots have ever been handed out, caches indexed by id
+            will never need to be bigger than this.
+        */
+        size_t CallsignRegistry::CountSlots(void) const
+        {
+            return this->slots.size();
+        }
+
+        /*
+            Find the id for a callsign, without interning it if it's not known.
+        */
+        AircraftId CallsignRegistry::Find(const std::string & callsign) const
+        {
+            std::unordered_map<std::string, unsigned int>::const_iterator index = this->indexes.find(callsign);
+            if (index == this->indexes.cend()) {
+                return invalidAircraftId;
+            }
+
+            return { index->second, this->slots[index->second].generation };
+        }
+
+        const std::string & CallsignRegistry::GetCallsign(AircraftId id) const
+        {
+            return this->IsCurrent(id) ? this->slots[id.index].callsign : this->noCallsign;
+        }
+
+        /*
+            Return the id for a callsign, handing out a new one if we haven't seen it before.
+            Freed slots are reused first so that the ids stay dense.
+        */
+        AircraftId CallsignRegistry::Intern(const std::string & callsign)
+        {
+            std::unordered_map<std::string, unsigned int>::const_iterator existing = this->indexes.find(callsign);
+            if (existing != this->indexes.cend()) {
+                return { existing->second, this->slots[existing->second].generation };
+            }
+
+            unsigned int index;
+            if (!this->freeSlots.empty()) {
+                index = this->freeSlots.back();
+                this->freeSlots.pop_back();
+                this->slots[index].callsign = callsign;
+                this->slots[index].generation++;
+                this->slots[index].active = true;
+            } else {
+                index = static_cast<unsigned int>(this->slots.size());
+                this->slots.push_back({ callsign, 0, true });
+            }
+
+            this->indexes[callsign] = index;
+            return { index, this->slots[index].generation };
+        }
+
+        /*
+            Is the id still for the aircraft it was handed out to.
+        */
+        bool CallsignRegistry::IsCurrent(AircraftId id) const
+        {
+            return id.index < this->slots.size() &&
+                this->slots[id.index].active &&
+                this->slots[id.index].generation == id.generation;
+        }
+
+        /*
+            The aircraft has gone, so its slot can be given to someone else.
+        */
+        void CallsignRegistry::Release(const std::string & callsign)
+        {
+            std::unordered_map<std::string, unsigned int>::const_iterator index = this->indexes.find(callsign);
+            if (index == this->indexes.cend()) {
+                return;
+            }
+
+            this->slots[index->second].active = false;
+            this->freeSlots.push_back(index->second);
+            this->indexes.erase(index);
+        }
+
+        void CallsignRegistry::FlightPlanEvent(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            EuroScopeCRadarTargetInterface & radarTarget
+        ) {
+            this->Intern(flightPlan.GetCallsign());
+        }
+
+        void CallsignRegistry::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface & flightPlan)
+        {
+            this->Release(flightPlan.GetCallsign());
+        }
+
+        /*
+            Nothing to do here
+        */
+        void CallsignRegistry::ControllerFlightPlanDataEvent(
+            EuroScopeCFlightPlanInterface & flightPlan,
+            int dataType
+        ) {
+
+        }
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
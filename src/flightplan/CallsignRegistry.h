@@ -0,0 +1,61 @@
+#pragma once
+#include "flightplan/AircraftId.h"
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+
+namespace UKControllerPlugin {
+    namespace Flightplan {
+
+        /*
+            Hands out a dense id for every aircraft callsign the first time it is seen,
+            and recycles the id once the flightplan disconnects.
+
+            Per-aircraft caches can then store their data in contiguous slots indexed
+            by the id rather than in their own string-keyed maps.
+        */
+        class CallsignRegistry : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface
+        {
+            public:
+                size_t CountActive(void) const;
+                size_t CountSlots(void) const;
+                AircraftId Find(const std::string & callsign) const;
+                const std::string & GetCallsign(AircraftId id) const;
+                AircraftId Intern(const std::string & callsign);
+                bool IsCurrent(AircraftId id) const;
+                void Release(const std::string & callsign);
+
+                // Inherited via FlightPlanEventHandlerInterface
+                void FlightPlanEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) override;
+                void FlightPlanDisconnectEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                ) override;
+                void ControllerFlightPlanDataEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    int dataType
+                ) override;
+
+                // Returned when asked for the callsign of an id that isn't current
+                const std::string noCallsign = "";
+
+            private:
+
+                typedef struct RegistrySlot
+                {
+                    std::string callsign;
+                    unsigned int generation;
+                    bool active;
+                } RegistrySlot;
+
+                // Callsign -> slot index
+                std::unordered_map<std::string, unsigned int> indexes;
+
+                // Every slot that has been handed out
+                std::vector<RegistrySlot> slots;
+
+                // Slots that are free to be reused
+                std::vector<unsigned int> freeSlots;
+        };
+    }  // namespace Flightplan
+}  // namespace UKControllerPlugin
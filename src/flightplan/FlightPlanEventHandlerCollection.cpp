@@ -1,15 +1,37 @@
 #include "pch/stdafx.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
 #include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "performance/ScopedHandlerTimer.h"
+#include "flightplan/StoredFlightplanCollection.h"
 
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using UKControllerPlugin::Performance::ScopedHandlerTimer;
 
 namespace UKControllerPlugin {
     namespace Flightplan {
 
+        FlightPlanEventHandlerCollection::FlightPlanEventHandlerCollection(void)
+            : FlightPlanEventHandlerCollection(std::make_shared<HandlerMetricsCollection>())
+        {
+
+        }
+
+        FlightPlanEventHandlerCollection::FlightPlanEventHandlerCollection(
+            std::shared_ptr<HandlerMetricsCollection> metrics
+        )
+            : metrics(metrics)
+        {
+
+        }
+
         /*
             Returns the number of registered handlers.
         */
@@ -20,20 +42,39 @@ namespace UKControllerPlugin {
 
 
         /*
-            Called whenever there's a flightplan or flightplan controller data event.
+            Called whenever there's a flightplan or flightplan controller data event. Skips any handler
+            that only depends on fields that the stored flightplan says didn't change on this event.
         */
         void FlightPlanEventHandlerCollection::FlightPlanEvent(
             EuroScopeCFlightPlanInterface & flightPlan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) const {
+            // Only looked up once a handler that depends on particular fields is reached
+            const StoredFlightplan * storedPlan = nullptr;
+            bool storedPlanFound = false;
+
             // Loop through the handlers and call their handling function.
             for (
-                std::list<std::shared_ptr<FlightPlanEventHandlerInterface>>::const_iterator it =
-                    this->handlerList.cbegin();
+                std::list<RegisteredHandler>::const_iterator it = this->handlerList.cbegin();
                 it != this->handlerList.cend();
                 ++it
             ) {
-                (*it)->FlightPlanEvent(flightPlan, radarTarget);
+                if (it->fieldDependencies != FlightPlanEventHandlerInterface::everyEvent) {
+                    if (!storedPlanFound) {
+                        std::string callsign = flightPlan.GetCallsign();
+                        storedPlan = this->storedFlightplans->HasFlightplanForCallsign(callsign)
+                            ? &this->storedFlightplans->GetFlightplanForCallsign(callsign)
+                            : nullptr;
+                        storedPlanFound = true;
+                    }
+
+                    if (storedPlan != nullptr && !storedPlan->HasChanged(it->fieldDependencies)) {
+                        continue;
+                    }
+                }
+
+                ScopedHandlerTimer timer(*it->metrics);
+                it->handler->FlightPlanEvent(flightPlan, radarTarget);
             }
         }
 
@@ -44,12 +85,11 @@ namespace UKControllerPlugin {
         ) const {
             // Loop through the handlers and call their handling function.
             for (
-                std::list<std::shared_ptr<FlightPlanEventHandlerInterface>>::const_iterator it =
-                    this->handlerList.cbegin();
+                std::list<RegisteredHandler>::const_iterator it = this->handlerList.cbegin();
                 it != this->handlerList.cend();
                 ++it
             ) {
-                (*it)->ControllerFlightPlanDataEvent(flightPlan, dataType);
+                it->handler->ControllerFlightPlanDataEvent(flightPlan, dataType);
             }
         }
 
@@ -58,12 +98,11 @@ namespace UKControllerPlugin {
         ) const {
             // Loop through the handlers and call their handling function.
             for (
-                std::list<std::shared_ptr<FlightPlanEventHandlerInterface>>::const_iterator it =
-                    this->handlerList.cbegin();
+                std::list<RegisteredHandler>::const_iterator it = this->handlerList.cbegin();
                     it != this->handlerList.cend();
                 ++it
             ) {
-                (*it)->FlightPlanDisconnectEvent(flightPlan);
+                it->handler->FlightPlanDisconnectEvent(flightPlan);
             }
         }
 
@@ -72,11 +111,34 @@ namespace UKControllerPlugin {
         */
         void FlightPlanEventHandlerCollection::RegisterHandler(std::shared_ptr<FlightPlanEventHandlerInterface> handler)
         {
-            if (std::find(this->handlerList.begin(), this->handlerList.end(), handler) != this->handlerList.end()) {
+            auto existing = std::find_if(
+                this->handlerList.cbegin(),
+                this->handlerList.cend(),
+                [&handler](const RegisteredHandler & registered) { return registered.handler == handler; }
+            );
+
+            if (existing != this->handlerList.cend()) {
                 return;
             }
 
-            this->handlerList.push_back(handler);
+            // Handlers registered before the stored flightplans are set may run before the plan is updated
+            this->handlerList.push_back(
+                {
+                    handler,
+                    this->metrics->Register("FlightPlan " + HandlerMetricsCollection::NameFromType(typeid(*handler))),
+                    this->storedFlightplans == nullptr
+                        ? FlightPlanEventHandlerInterface::everyEvent
+                        : handler->GetFlightplanFieldDependencies()
+                }
+            );
+        }
+
+        /*
+            Sets the stored flightplans, whose changed fields are used to skip handlers registered from now on.
+        */
+        void FlightPlanEventHandlerCollection::SetStoredFlightplans(const StoredFlightplanCollection & plans)
+        {
+            this->storedFlightplans = &plans;
         }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
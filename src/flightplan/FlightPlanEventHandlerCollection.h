@@ -5,6 +5,10 @@ namespace UKControllerPlugin {
         class EuroScopeCFlightPlanInterface;
         class EuroScopeCRadarTargetInterface;
     }  // namespace Euroscope
+    namespace Performance {
+        class HandlerMetrics;
+        class HandlerMetricsCollection;
+    }  // namespace Performance
 }  // namespace UKControllerPlugin
 
 namespace UKControllerPlugin {
@@ -12,15 +16,25 @@ namespace UKControllerPlugin {
 
         // Forward Declarations
         class FlightPlanEventHandlerInterface;
+        class StoredFlightplanCollection;
         // END
 
         /*
             A repository of event handlers for FlightPlan events. When an event is received, it will
-            call each of the handlers in turn.
+            call each of the handlers in turn. Flightplan events are timed per handler.
+
+            Once the stored flightplans have been set, handlers that are registered afterwards and only depend
+            on some of the flightplan fields are skipped if the stored flightplan says that none of those fields
+            changed on its last update. The stored flightplan handler must be registered before the stored
+            flightplans are set, so that it updates the plan before any of the filtered handlers run.
         */
         class FlightPlanEventHandlerCollection
         {
             public:
+                FlightPlanEventHandlerCollection(void);
+                explicit FlightPlanEventHandlerCollection(
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics
+                );
                 int CountHandlers(void) const;
                 void FlightPlanEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
@@ -35,10 +49,24 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
                 ) const;
                 void RegisterHandler(std::shared_ptr<FlightPlanEventHandlerInterface> handler);
+                void SetStoredFlightplans(const UKControllerPlugin::Flightplan::StoredFlightplanCollection & plans);
 
             private:
-                // Vector of registered handlers
-                std::list<std::shared_ptr<FlightPlanEventHandlerInterface>> handlerList;
+
+                typedef struct RegisteredHandler {
+                    std::shared_ptr<FlightPlanEventHandlerInterface> handler;
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetrics> metrics;
+                    unsigned int fieldDependencies;
+                } RegisteredHandler;
+
+                // Where handler metrics are kept
+                const std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics;
+
+                // Registered handlers
+                std::list<RegisteredHandler> handlerList;
+
+                // The stored flightplans, which record the fields that changed on each flightplan event
+                const UKControllerPlugin::Flightplan::StoredFlightplanCollection * storedFlightplans = nullptr;
         };
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
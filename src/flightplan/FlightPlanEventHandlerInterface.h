@@ -30,6 +30,18 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
                     int dataType
                 ) = 0;
+
+                /*
+                    The flightplan fields, as a StoredFlightplan changed fields mask, that the handler depends on.
+                    Flightplan events are only passed on if one of them has changed.
+                */
+                virtual unsigned int GetFlightplanFieldDependencies(void) const
+                {
+                    return FlightPlanEventHandlerInterface::everyEvent;
+                }
+
+                // For handlers that want every flightplan event, whether or not any of the fields changed
+                static constexpr unsigned int everyEvent = UINT_MAX;
         };
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
@@ -1,23 +1,31 @@
 #include "pch/stdafx.h"
 #include "flightplan/FlightplanStorageBootstrap.h"
 #include "flightplan/StoredFlightplanEventHandler.h"
+#include "flightplan/CallsignRegistry.h"
 
 using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
 
 namespace UKControllerPlugin {
     namespace Flightplan {
 
         /*
-            Bootstraps the event handler surrounding storage of flightplans.
+            Bootstraps the event handler surrounding storage of flightplans, and the registry
+            that hands out ids to aircraft for per-aircraft caches. Handlers registered after this
+            are skipped when none of the stored flightplan fields they depend on have changed.
         */
         void FlightplanStorageBootstrap::BootstrapPlugin(
-            const UKControllerPlugin::Bootstrap::PersistenceContainer & container
+            UKControllerPlugin::Bootstrap::PersistenceContainer & container
         ) {
+            container.callsignRegistry = std::make_shared<CallsignRegistry>();
+            container.flightplanHandler->RegisterHandler(container.callsignRegistry);
+
             std::shared_ptr<StoredFlightplanEventHandler> handler = std::make_shared<StoredFlightplanEventHandler>(
                 *container.flightplans
             );
 
             container.flightplanHandler->RegisterHandler(handler);
+            container.flightplanHandler->SetStoredFlightplans(*container.flightplans);
             container.timedHandler->RegisterEvent(handler, FlightplanStorageBootstrap::timedEventFrequency);
         }
     }  // namespace Flightplan
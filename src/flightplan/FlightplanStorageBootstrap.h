@@ -10,7 +10,7 @@ namespace UKControllerPlugin {
         class FlightplanStorageBootstrap
         {
             public:
-                static void BootstrapPlugin(const UKControllerPlugin::Bootstrap::PersistenceContainer & container);
+                static void BootstrapPlugin(UKControllerPlugin::Bootstrap::PersistenceContainer & container);
 
                 // How often the timed event for the handler should be triggered
                 static const int timedEventFrequency = 60;
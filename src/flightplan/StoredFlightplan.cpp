@@ -16,19 +16,8 @@ namespace UKControllerPlugin {
         ) :timeout(this->defaultTime)
         {
             this->callsign = euroscopePlan.GetCallsign();
-            this->origin = euroscopePlan.GetOrigin();
-            this->destination = euroscopePlan.GetDestination();
-            this->assignedSquawk = euroscopePlan.HasAssignedSquawk() ? euroscopePlan.GetAssignedSquawk()
-                : StoredFlightplan::noSquawkAllocated;
-            std::chrono::system_clock::time_point edt = HelperFunctions::GetTimeFromNumberString(
-                euroscopePlan.GetExpectedDepartureTime()
-            );
-
-            if (edt != (std::chrono::system_clock::time_point::max)()) {
-                this->expectedOffBlockTime = edt - std::chrono::minutes(15);
-            } else {
-                this->expectedOffBlockTime = edt;
-            }
+            this->UpdateFromEuroscope(euroscopePlan);
+            this->changedFields = this->allFieldsChanged;
         }
 
         StoredFlightplan::StoredFlightplan(std::string callsign, std::string origin, std::string destination)
@@ -56,6 +45,14 @@ namespace UKControllerPlugin {
             return this->callsign;
         }
 
+        /*
+            Returns the bitmask of fields that changed on the last update from EuroScope.
+        */
+        unsigned int StoredFlightplan::GetChangedFields(void) const
+        {
+            return this->changedFields;
+        }
+
         /*
             Returns the destination.
         */
@@ -104,6 +101,14 @@ namespace UKControllerPlugin {
             return this->timeout;
         }
 
+        /*
+            Returns true if any of the given fields changed on the last update from EuroScope.
+        */
+        bool StoredFlightplan::HasChanged(unsigned int fields) const
+        {
+            return (this->changedFields & fields) != this->noFieldsChanged;
+        }
+
         /*
             Returns whether or not the plugin has assigned a squawk for this aircraft.
         */
@@ -185,6 +190,79 @@ namespace UKControllerPlugin {
             this->timeout = this->defaultTime;
         }
 
+        /*
+            Updates the flightplan in place from its EuroScope counterpart, only touching the fields
+            that have changed. Returns the bitmask of the fields that changed.
+        */
+        unsigned int StoredFlightplan::UpdateFromEuroscope(
+            const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
+        ) {
+            this->changedFields = this->noFieldsChanged;
+            this->UpdateField(this->origin, euroscopePlan.GetOrigin(), this->originChanged);
+            this->UpdateField(this->destination, euroscopePlan.GetDestination(), this->destinationChanged);
+            this->UpdateField(
+                this->assignedSquawk,
+                euroscopePlan.HasAssignedSquawk() ? euroscopePlan.GetAssignedSquawk()
+                    : StoredFlightplan::noSquawkAllocated,
+                this->squawkChanged
+            );
+            this->UpdateField(this->route, euroscopePlan.GetRawRouteString(), this->routeChanged);
+            this->UpdateField(this->sid, euroscopePlan.GetSidName(), this->sidChanged);
+            this->UpdateField(this->aircraftType, euroscopePlan.GetAircraftType(), this->aircraftTypeChanged);
+            this->UpdateField(this->wakeCategory, euroscopePlan.GetIcaoWakeCategory(), this->wakeCategoryChanged);
+            this->UpdateField(this->cruiseLevel, euroscopePlan.GetCruiseLevel(), this->cruiseLevelChanged);
+
+            if (
+                !this->UpdateField(
+                    this->expectedDepartureTime,
+                    euroscopePlan.GetExpectedDepartureTime(),
+                    this->expectedOffBlockTimeChanged
+                )
+            ) {
+                return this->changedFields;
+            }
+
+            std::chrono::system_clock::time_point edt = HelperFunctions::GetTimeFromNumberString(
+                this->expectedDepartureTime
+            );
+
+            if (edt != (std::chrono::system_clock::time_point::max)()) {
+                this->expectedOffBlockTime = edt - std::chrono::minutes(15);
+            } else {
+                this->expectedOffBlockTime = edt;
+            }
+
+            return this->changedFields;
+        }
+
+        /*
+            Sets a field if its value has changed, marking the change. Returns true if it changed.
+        */
+        bool StoredFlightplan::UpdateField(std::string & field, const std::string & value, unsigned int change)
+        {
+            if (field == value) {
+                return false;
+            }
+
+            field = value;
+            this->changedFields |= change;
+            return true;
+        }
+
+        /*
+            Sets a numeric field if its value has changed, marking the change. Returns true if it changed.
+        */
+        bool StoredFlightplan::UpdateField(int & field, int value, unsigned int change)
+        {
+            if (field == value) {
+                return false;
+            }
+
+            field = value;
+            this->changedFields |= change;
+            return true;
+        }
+
         /*
             Returns true only if the callsign, origin and destination match.
         */
@@ -244,8 +322,15 @@ namespace UKControllerPlugin {
             this->destination = flightplan.destination;
             this->timeout = flightplan.timeout;
             this->assignedSquawk = flightplan.assignedSquawk;
+            this->expectedDepartureTime = flightplan.expectedDepartureTime;
+            this->route = flightplan.route;
+            this->sid = flightplan.sid;
+            this->aircraftType = flightplan.aircraftType;
+            this->wakeCategory = flightplan.wakeCategory;
+            this->cruiseLevel = flightplan.cruiseLevel;
             this->expectedOffBlockTime = flightplan.expectedOffBlockTime;
             this->estimatedDepartureTime = flightplan.estimatedDepartureTime;
+            this->changedFields = flightplan.changedFields;
         }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
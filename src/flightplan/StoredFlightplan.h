@@ -20,12 +20,14 @@ namespace UKControllerPlugin {
                 StoredFlightplan(std::string callsign, std::string origin, std::string destination);
                 std::chrono::system_clock::time_point GetActualOffBlockTime(void) const;
                 std::string GetCallsign(void) const;
+                unsigned int GetChangedFields(void) const;
                 std::string GetDestination(void) const;
                 std::chrono::system_clock::time_point GetEstimatedDepartureTime(void) const;
                 std::chrono::system_clock::time_point GetExpectedOffBlockTime(void) const;
                 std::string GetOrigin(void) const;
                 std::string GetPreviouslyAssignedSquawk(void) const;
                 std::time_t GetTimeout(void) const;
+                bool HasChanged(unsigned int fields) const;
                 bool HasPreviouslyAssignedSquawk(void) const;
                 bool HasTimedOut(void) const;
                 void SetActualOffBlockTime(std::chrono::system_clock::time_point time);
@@ -36,6 +38,9 @@ namespace UKControllerPlugin {
                 void SetPreviouslyAssignedSquawk(std::string squawk);
                 void SetTimeout(int offset);
                 void ResetTimeout(void);
+                unsigned int UpdateFromEuroscope(
+                    const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
+                );
                 bool operator==(const StoredFlightplan & compare) const;
                 bool operator==(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & compare) const;
                 bool operator!=(const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & compare) const;
@@ -49,8 +54,24 @@ namespace UKControllerPlugin {
                 // Default time, when no timeout is set.
                 const std::time_t defaultTime = 0;
 
+                // Bits in the changed fields mask, one for each field that is updated from EuroScope
+                static constexpr unsigned int noFieldsChanged = 0;
+                static constexpr unsigned int originChanged = 1;
+                static constexpr unsigned int destinationChanged = 2;
+                static constexpr unsigned int squawkChanged = 4;
+                static constexpr unsigned int expectedOffBlockTimeChanged = 8;
+                static constexpr unsigned int routeChanged = 16;
+                static constexpr unsigned int sidChanged = 32;
+                static constexpr unsigned int aircraftTypeChanged = 64;
+                static constexpr unsigned int wakeCategoryChanged = 128;
+                static constexpr unsigned int cruiseLevelChanged = 256;
+                static constexpr unsigned int allFieldsChanged = 511;
+
             private:
 
+                bool UpdateField(std::string & field, const std::string & value, unsigned int change);
+                bool UpdateField(int & field, int value, unsigned int change);
+
                 // The callsign for the aircraft
                 std::string callsign;
 
@@ -66,6 +87,19 @@ namespace UKControllerPlugin {
                 // The squawk code that has been previously assigned to this flightplan
                 std::string assignedSquawk;
 
+                // The expected departure time as EuroScope gave it, so we only parse it when it changes
+                std::string expectedDepartureTime;
+
+                // Flightplan fields that are only kept so we can tell when they change
+                std::string route;
+                std::string sid;
+                std::string aircraftType;
+                std::string wakeCategory;
+                int cruiseLevel = 0;
+
+                // The fields that changed on the last update from EuroScope, all of them for a new flightplan
+                unsigned int changedFields = allFieldsChanged;
+
                 // The expected off block time
                 std::chrono::system_clock::time_point expectedOffBlockTime =
                     (std::chrono::system_clock::time_point::max)();
@@ -72,5 +72,21 @@ namespace UKControllerPlugin {
 
             *this->flightplans[flightplan.GetCallsign()] = flightplan;
         }
+
+        /*
+            Updates a plan in place from EuroScope, or adds it if it doesn't exist, returning the stored plan.
+        */
+        StoredFlightplan & StoredFlightplanCollection::UpdatePlan(const EuroScopeCFlightPlanInterface & euroscopePlan)
+        {
+            std::string callsign = euroscopePlan.GetCallsign();
+            FlightplanMap::iterator plan = this->flightplans.find(callsign);
+            if (plan == this->flightplans.end()) {
+                LogInfo("Now tracking flightplan data for " + callsign);
+                return *(this->flightplans[callsign] = std::make_unique<StoredFlightplan>(euroscopePlan));
+            }
+
+            plan->second->UpdateFromEuroscope(euroscopePlan);
+            return *plan->second;
+        }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
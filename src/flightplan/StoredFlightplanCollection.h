@@ -25,6 +25,9 @@ class StoredFlightplanCollection
         void RemoveTimedOutPlans(void);
         void RemovePlanByCallsign(std::string callsign);
         void UpdatePlan(StoredFlightplan flightplan);
+        UKControllerPlugin::Flightplan::StoredFlightplan & UpdatePlan(
+            const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & euroscopePlan
+        );
 
     private:
 
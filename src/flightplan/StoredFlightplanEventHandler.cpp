@@ -32,10 +32,8 @@ namespace UKControllerPlugin {
             EuroScopeCFlightPlanInterface & euroscopeFlightplan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            this->storedFlightplans.UpdatePlan(StoredFlightplan(euroscopeFlightplan));
-
             // Reset anything to do with timeout.
-            this->storedFlightplans.GetFlightplanForCallsign(euroscopeFlightplan.GetCallsign()).ResetTimeout();
+            this->storedFlightplans.UpdatePlan(euroscopeFlightplan).ResetTimeout();
         }
 
         /*
@@ -3,9 +3,13 @@
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "controller/ControllerPositionHierarchy.h"
 #include "controller/ControllerPosition.h"
+#include "flightplan/StoredFlightplan.h"
 
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
 using UKControllerPlugin::Controller::ControllerPositionHierarchy;
+using UKControllerPlugin::Flightplan::AircraftId;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Controller::ActiveCallsign;
@@ -16,8 +20,9 @@ namespace UKControllerPlugin {
 
         HandoffEventHandler::HandoffEventHandler(
             const HandoffCollection& handoffs,
-            const ActiveCallsignCollection& callsigns
-        ) : handoffs(std::move(handoffs)), callsigns(std::move(callsigns))
+            const ActiveCallsignCollection& callsigns,
+            CallsignRegistry& aircraft
+        ) : handoffs(std::move(handoffs)), callsigns(std::move(callsigns)), aircraft(aircraft)
         {
 
         }
@@ -27,12 +32,12 @@ namespace UKControllerPlugin {
         */
         void HandoffEventHandler::AddCachedItem(std::string callsign, CachedHandoff item)
         {
-            this->cache[callsign] = item;
+            this->cache.Set(this->aircraft.Intern(callsign), item);
         }
 
         size_t HandoffEventHandler::CountCachedItems(void) const
         {
-            return this->cache.size();
+            return this->cache.Count();
         }
 
         /*
@@ -40,7 +45,8 @@ namespace UKControllerPlugin {
         */
         CachedHandoff HandoffEventHandler::GetCachedItem(std::string callsign) const
         {
-            return this->cache.count(callsign) ? this->cache.at(callsign) : this->DEFAULT_TAG_VALUE;
+            const CachedHandoff * cached = this->cache.Find(this->aircraft.Find(callsign));
+            return cached ? *cached : this->DEFAULT_TAG_VALUE;
         }
 
         std::string HandoffEventHandler::GetTagItemDescription(int tagItemId) const
@@ -50,18 +56,20 @@ namespace UKControllerPlugin {
 
         void HandoffEventHandler::SetTagItemData(TagData & tagData)
         {
-            if (this->cache.count(tagData.flightPlan.GetCallsign())) {
-                tagData.SetItemString(this->cache[tagData.flightPlan.GetCallsign()].frequency);
+            AircraftId id = this->aircraft.Intern(tagData.flightPlan.GetCallsign());
+            const CachedHandoff * cached = this->cache.Find(id);
+            if (cached) {
+                tagData.SetItemString(cached->frequency);
                 return;
             }
 
-            ControllerPositionHierarchy controllers = this->handoffs.GetSidHandoffOrder(
+            const ControllerPositionHierarchy & controllers = this->handoffs.GetSidHandoffOrder(
                 tagData.flightPlan.GetOrigin(),
                 tagData.flightPlan.GetSidName()
             );
 
             if (controllers == this->handoffs.invalidHierarchy) {
-                this->cache[tagData.flightPlan.GetCallsign()] = this->DEFAULT_TAG_VALUE;
+                this->cache.Set(id, this->DEFAULT_TAG_VALUE);
                 tagData.SetItemString(this->DEFAULT_TAG_VALUE.frequency);
                 return;
             }
@@ -78,22 +86,24 @@ namespace UKControllerPlugin {
                         this->callsigns.UserHasCallsign() &&
                         this->callsigns.GetUserCallsign().GetNormalisedPosition() == *it
                     ) {
-                        this->cache[tagData.flightPlan.GetCallsign()] = this->DEFAULT_TAG_VALUE;
-                        tagData.SetItemString(this->cache[tagData.flightPlan.GetCallsign()].frequency);
+                        this->cache.Set(id, this->DEFAULT_TAG_VALUE);
+                        tagData.SetItemString(this->DEFAULT_TAG_VALUE.frequency);
                         return;
                     }
 
                     char frequencyString[24];
                     sprintf_s(frequencyString, "%.3f", it->get().GetFrequency());
-                    this->cache[tagData.flightPlan.GetCallsign()] =
-                        CachedHandoff(frequencyString, it->get().GetCallsign());
-                    tagData.SetItemString(this->cache[tagData.flightPlan.GetCallsign()].frequency);
+                    CachedHandoff & handoff = this->cache.Set(
+                        id,
+                        CachedHandoff(frequencyString, it->get().GetCallsign())
+                    );
+                    tagData.SetItemString(handoff.frequency);
                     return;
                 }
             }
 
-            this->cache[tagData.flightPlan.GetCallsign()] = this->UNICOM_TAG_VALUE;
-            tagData.SetItemString(this->cache[tagData.flightPlan.GetCallsign()].frequency);
+            this->cache.Set(id, this->UNICOM_TAG_VALUE);
+            tagData.SetItemString(this->UNICOM_TAG_VALUE.frequency);
         }
 
         void HandoffEventHandler::FlightPlanEvent(
@@ -101,13 +111,21 @@ namespace UKControllerPlugin {
             EuroScopeCRadarTargetInterface& radarTarget
         ) {
             // FP changed, so erase the cache.
-            this->cache.erase(flightPlan.GetCallsign());
+            this->cache.Erase(this->aircraft.Find(flightPlan.GetCallsign()));
+        }
+
+        /*
+            The handoff order is looked up by departure airport and SID.
+        */
+        unsigned int HandoffEventHandler::GetFlightplanFieldDependencies(void) const
+        {
+            return StoredFlightplan::originChanged | StoredFlightplan::sidChanged;
         }
 
         void HandoffEventHandler::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface& flightPlan)
         {
             // FP gone, so erase the cache.
-            this->cache.erase(flightPlan.GetCallsign());
+            this->cache.Erase(this->aircraft.Find(flightPlan.GetCallsign()));
         }
 
         void HandoffEventHandler::ControllerFlightPlanDataEvent(EuroScopeCFlightPlanInterface& flightPlan, int dataType)
@@ -120,7 +138,7 @@ namespace UKControllerPlugin {
         */
         void HandoffEventHandler::ActiveCallsignAdded(const ActiveCallsign& callsign, bool userCallsign)
         {
-            this->cache.clear();
+            this->cache.Clear();
         }
 
         /*
@@ -128,15 +146,9 @@ namespace UKControllerPlugin {
         */
         void HandoffEventHandler::ActiveCallsignRemoved(const ActiveCallsign& callsign, bool userCallsign)
         {
-            for (
-                std::map<std::string, CachedHandoff>::const_iterator it = this->cache.cbegin();
-                it != this->cache.cend();
-            ) {
-                auto keyToRemove = it++;
-                if (keyToRemove->second.callsign == callsign.GetCallsign()) {
-                    this->cache.erase(keyToRemove);
-                }
-            }
+            this->cache.EraseIf([&callsign](const CachedHandoff & handoff) {
+                return handoff.callsign == callsign.GetCallsign();
+            });
         }
 
         /*
@@ -144,7 +156,7 @@ namespace UKControllerPlugin {
         */
         void HandoffEventHandler::CallsignsFlushed(void)
         {
-            this->cache.clear();
+            this->cache.Clear();
         }
     }  // namespace Handoff
 }  // namespace UKControllerPlugin
@@ -7,6 +7,8 @@
 #include "controller/ActiveCallsignEventHandlerInterface.h"
 #include "controller/ActiveCallsign.h"
 #include "tag/TagData.h"
+#include "flightplan/AircraftSlotMap.h"
+#include "flightplan/CallsignRegistry.h"
 
 namespace UKControllerPlugin {
     namespace Handoff {
@@ -23,7 +25,8 @@ namespace UKControllerPlugin {
 
                 HandoffEventHandler(
                     const UKControllerPlugin::Handoff::HandoffCollection& handoffs,
-                    const UKControllerPlugin::Controller::ActiveCallsignCollection& callsigns
+                    const UKControllerPlugin::Controller::ActiveCallsignCollection& callsigns,
+                    UKControllerPlugin::Flightplan::CallsignRegistry& aircraft
                 );
                 void AddCachedItem(std::string callsign, CachedHandoff handoff);
                 size_t CountCachedItems(void) const;
@@ -45,6 +48,7 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightPlan,
                     int dataType
                 ) override;
+                unsigned int GetFlightplanFieldDependencies(void) const override;
 
                 // Inherited via ActiveCallsignEventHandlerInterface
                 void ActiveCallsignAdded(
@@ -69,8 +73,11 @@ namespace UKControllerPlugin {
                 // The active callsigns
                 const UKControllerPlugin::Controller::ActiveCallsignCollection& callsigns;
 
-                // Maps callsign -> result so we can cache it.
-                std::map<std::string, UKControllerPlugin::Handoff::CachedHandoff> cache;
+                // Interns aircraft callsigns for the cache
+                UKControllerPlugin::Flightplan::CallsignRegistry& aircraft;
+
+                // Maps aircraft -> result so we can cache it.
+                UKControllerPlugin::Flightplan::AircraftSlotMap<UKControllerPlugin::Handoff::CachedHandoff> cache;
         };
 
     }  // namespace Handoff
@@ -0,0 +1,103 @@
+#include "pch/stdafx.h"
+#include "helper/StringScanners.h"
+
+namespace UKControllerPlugin {
+    namespace Helper {
+
+        bool IsAsciiLetter(char character)
+        {
+            return (character >= 'A' && character <= 'Z') || (character >= 'a' && character <= 'z');
+        }
+
+        /*
+            Letters, digits, underscores and hyphens, as found in controller callsigns.
+        */
+        bool IsCallsignCharacter(char character)
+        {
+            return IsAsciiLetter(character) ||
+                (character >= '0' && character <= '9') ||
+                character == '_' ||
+                character == '-';
+        }
+
+        /*
+            Returns whether a route is the start of a circuits flightplan, e.g. CIRCUITS or
+            VFR CIRCUIT, in any case.
+        */
+        bool IsCircuitRoute(const std::string & route)
+        {
+            return StartsWithIgnoringCase(route, "CIRCUIT") || StartsWithIgnoringCase(route, "VFR CIRCUIT");
+        }
+
+        /*
+            If the command starts with the prefix, returns the characters that immediately follow it
+            for as long as they are allowed, up to the maximum length. Returns an empty string otherwise.
+        */
+        std::string ScanCommandArgument(
+            const std::string & command,
+            const std::string & prefix,
+            bool (*isArgumentCharacter)(char),
+            size_t maximumLength
+        ) {
+            if (command.compare(0, prefix.size(), prefix) != 0) {
+                return "";
+            }
+
+            size_t end = prefix.size();
+            while (
+                end < command.size() &&
+                end - prefix.size() < maximumLength &&
+                isArgumentCharacter(command[end])
+            ) {
+                end++;
+            }
+
+            return command.substr(prefix.size(), end - prefix.size());
+        }
+
+        /*
+            Returns the four digit QNH from a METAR, e.g. 1013 from "... Q1013 ...". It must
+            be separated from the rest of the METAR by spaces, or be at the end. Returns an
+            empty string if there isn't one.
+        */
+        std::string ScanQnh(const std::string & metar)
+        {
+            for (size_t q = metar.find(" Q"); q != std::string::npos; q = metar.find(" Q", q + 1)) {
+                size_t digits = q + 2;
+                if (digits + 4 > metar.size()) {
+                    break;
+                }
+
+                if (
+                    std::isdigit(static_cast<unsigned char>(metar[digits])) &&
+                    std::isdigit(static_cast<unsigned char>(metar[digits + 1])) &&
+                    std::isdigit(static_cast<unsigned char>(metar[digits + 2])) &&
+                    std::isdigit(static_cast<unsigned char>(metar[digits + 3])) &&
+                    (digits + 4 == metar.size() || metar[digits + 4] == ' ')
+                ) {
+                    return metar.substr(digits, 4);
+                }
+            }
+
+            return "";
+        }
+
+        /*
+            Returns whether the text starts with the prefix, ignoring the case of both.
+        */
+        bool StartsWithIgnoringCase(const std::string & text, const char * prefix)
+        {
+            for (size_t index = 0; prefix[index] != '\0'; index++) {
+                if (
+                    index == text.size() ||
+                    std::toupper(static_cast<unsigned char>(text[index])) !=
+                        std::toupper(static_cast<unsigned char>(prefix[index]))
+                ) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }  // namespace Helper
+}  // namespace UKControllerPlugin
@@ -0,0 +1,24 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Helper {
+
+        /*
+            Hand written scanners for the bits of text that we pick apart on hot paths, such as
+            METARs, routes and dot commands. Each one makes a single pass over the text and
+            doesn't build a regex, so they are cheap enough to call on every event.
+        */
+
+        bool IsAsciiLetter(char character);
+        bool IsCallsignCharacter(char character);
+        bool IsCircuitRoute(const std::string & route);
+        std::string ScanCommandArgument(
+            const std::string & command,
+            const std::string & prefix,
+            bool (*isArgumentCharacter)(char),
+            size_t maximumLength
+        );
+        std::string ScanQnh(const std::string & metar);
+        bool StartsWithIgnoringCase(const std::string & text, const char * prefix);
+    }  // namespace Helper
+}  // namespace UKControllerPlugin
@@ -3,40 +3,89 @@
 
 namespace UKControllerPlugin {
     namespace HistoryTrail {
-        AircraftHistoryTrail::AircraftHistoryTrail(std::string callsign)
+        AircraftHistoryTrail::AircraftHistoryTrail(
+            const std::string & callsign,
+            const double * latitudes,
+            const double * longitudes,
+            unsigned int newest,
+            unsigned int size
+        )
+            : callsign(callsign), latitudes(latitudes), longitudes(longitudes), newest(newest), size(size)
         {
-            this->callsign = callsign;
+
         }
 
         /*
-            Adds an item to the history trail. If the queue is already at the maximum size, we remove the oldest
-            item before adding the new one - so the trail will never get bigger than this->maxSize.
-
-            The new item goes to the front, whilst old items are popped off the back.
+            Copies up to count positions, newest first, into the given arrays. The ring is unwrapped
+            as two contiguous runs so that the positions can be projected in bulk. Returns the number
+            of positions copied.
         */
-        void AircraftHistoryTrail::AddItem(EuroScopePlugIn::CPosition aircraftPosition)
-        {
-            this->trail.push_front(aircraftPosition);
+        unsigned int AircraftHistoryTrail::CopyPositions(
+            double * latitudes,
+            double * longitudes,
+            unsigned int count
+        ) const {
+            unsigned int toCopy = (std::min)(count, this->size);
+
+            // From the newest back to the start of the ring
+            unsigned int firstRun = (std::min)(toCopy, this->newest + 1);
+            unsigned int firstEnd = this->newest + 1;
+            std::reverse_copy(this->latitudes + firstEnd - firstRun, this->latitudes + firstEnd, latitudes);
+            std::reverse_copy(this->longitudes + firstEnd - firstRun, this->longitudes + firstEnd, longitudes);
+
+            // Then back from the end of the ring, if we've wrapped around
+            unsigned int secondRun = toCopy - firstRun;
+            std::reverse_copy(this->latitudes + maxSize - secondRun, this->latitudes + maxSize, latitudes + firstRun);
+            std::reverse_copy(
+                this->longitudes + maxSize - secondRun,
+                this->longitudes + maxSize,
+                longitudes + firstRun
+            );
 
-            if (this->trail.size() > this->maxSize) {
-                this->trail.pop_back();
-            }
+            return toCopy;
         }
 
         /*
             Returns the callsign associated with this history trail.
         */
-        std::string AircraftHistoryTrail::GetCallsign(void) const
+        const std::string & AircraftHistoryTrail::GetCallsign(void) const
         {
             return this->callsign;
         }
 
+        double AircraftHistoryTrail::GetLatitude(unsigned int age) const
+        {
+            return this->latitudes[this->RingIndex(age)];
+        }
+
+        double AircraftHistoryTrail::GetLongitude(unsigned int age) const
+        {
+            return this->longitudes[this->RingIndex(age)];
+        }
+
+        /*
+            Returns a position in the trail, 0 being the most recent.
+        */
+        EuroScopePlugIn::CPosition AircraftHistoryTrail::GetPosition(unsigned int age) const
+        {
+            EuroScopePlugIn::CPosition position;
+            position.m_Latitude = this->GetLatitude(age);
+            position.m_Longitude = this->GetLongitude(age);
+            return position;
+        }
+
+        unsigned int AircraftHistoryTrail::Size(void) const
+        {
+            return this->size;
+        }
+
         /*
-            Returns a copy of the current history trail.
+            New positions are written forwards around the ring, so older positions are found by
+            walking backwards from the newest.
         */
-        const std::deque<EuroScopePlugIn::CPosition> & AircraftHistoryTrail::GetTrail(void) const
+        unsigned int AircraftHistoryTrail::RingIndex(unsigned int age) const
         {
-            return this->trail;
+            return (this->newest + maxSize - age) % maxSize;
         }
     }  // namespace HistoryTrail
 }  // namespace UKControllerPlugin
@@ -3,25 +3,48 @@
 namespace UKControllerPlugin {
     namespace HistoryTrail {
         /*
-            Class that encapsulates a standard C++ double-ended queue with a maximum size
-            to provide a list of aircraft positions.
+            A read-only view of a single aircraft's history trail, which lives in a fixed-size
+            ring buffer inside the HistoryTrailRepository arena.
+
+            Positions are indexed by age, so position 0 is the most recent and position
+            Size() - 1 is the oldest. The view is only valid until the repository next changes.
         */
         class AircraftHistoryTrail
         {
-        public:
-            explicit AircraftHistoryTrail(std::string callsign);
-            void AddItem(EuroScopePlugIn::CPosition aircraftPosition);
-            std::string GetCallsign(void) const;
-            const std::deque<EuroScopePlugIn::CPosition> & GetTrail(void) const;
-
-            // The maximum number of items we can have in the history trail.
-            const unsigned int maxSize = 50;
-        private:
-            // A queue of aircraft positions.
-            std::deque<EuroScopePlugIn::CPosition> trail;
-
-            // Aircraft callsign corresponding to the history trail
-            std::string callsign;
+            public:
+                AircraftHistoryTrail(
+                    const std::string & callsign,
+                    const double * latitudes,
+                    const double * longitudes,
+                    unsigned int newest,
+                    unsigned int size
+                );
+                unsigned int CopyPositions(double * latitudes, double * longitudes, unsigned int count) const;
+                const std::string & GetCallsign(void) const;
+                double GetLatitude(unsigned int age) const;
+                double GetLongitude(unsigned int age) const;
+                EuroScopePlugIn::CPosition GetPosition(unsigned int age) const;
+                unsigned int Size(void) const;
+
+                // The maximum number of items we can have in the history trail.
+                static constexpr unsigned int maxSize = 50;
+
+            private:
+
+                unsigned int RingIndex(unsigned int age) const;
+
+                // Aircraft callsign corresponding to the history trail
+                const std::string & callsign;
+
+                // The ring buffers of positions
+                const double * latitudes;
+                const double * longitudes;
+
+                // Where in the ring buffers the most recent position is
+                const unsigned int newest;
+
+                // How many positions there are
+                const unsigned int size;
         };
     }  // namespace HistoryTrail
 }  // namespace UKControllerPlugin
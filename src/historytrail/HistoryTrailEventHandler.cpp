@@ -3,10 +3,8 @@
 #include "historytrail/HistoryTrailRepository.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
-#include "historytrail/AircraftHistoryTrail.h"
 
 using UKControllerPlugin::HistoryTrail::HistoryTrailRepository;
-using UKControllerPlugin::HistoryTrail::AircraftHistoryTrail;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 
@@ -48,15 +46,12 @@ namespace UKControllerPlugin {
         }
 
 
+        /*
+            Add a point to the repo, this registers the aircraft if it's not known.
+        */
         void HistoryTrailEventHandler::RadarTargetPositionUpdateEvent(EuroScopeCRadarTargetInterface & radarTarget)
         {
-            // Register the aircraft with the history trail repository if not known.
-            if (!this->repository.HasAircraft(radarTarget.GetCallsign())) {
-                this->repository.RegisterAircraft(std::make_shared<AircraftHistoryTrail>(radarTarget.GetCallsign()));
-            }
-
-            // Add a point to the repo.
-            this->repository.GetAircraft(radarTarget.GetCallsign())->AddItem(radarTarget.GetPosition());
+            this->repository.AddPosition(radarTarget.GetCallsign(), radarTarget.GetPosition());
         }
     }  // namespace HistoryTrail
 }  // namespace UKControllerPlugin
@@ -15,6 +15,7 @@ using UKControllerPlugin::Windows::GdiGraphicsInterface;
 using UKControllerPlugin::Euroscope::UserSetting;
 using UKControllerPlugin::Plugin::PopupMenuItem;
 using UKControllerPlugin::HistoryTrail::HistoryTrailRepository;
+using UKControllerPlugin::HistoryTrail::AircraftHistoryTrail;
 using UKControllerPlugin::HistoryTrail::HistoryTrailData;
 using UKControllerPlugin::Dialog::DialogManager;
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
@@ -61,6 +62,7 @@ namespace UKControllerPlugin {
                 this->maxAltitudeFilterUserSettingKey,
                 this->defaultMaxAltitude
             );
+            this->BuildDotTables();
         }
 
         /*
@@ -139,6 +141,43 @@ namespace UKControllerPlugin {
             this->historyTrailDotSizeFloat = static_cast<float>(this->historyTrailDotSize);
             this->startColour->SetFromCOLORREF(newColour);
             this->alphaPerDot = 255 / this->historyTrailLength;
+            this->BuildDotTables();
+        }
+
+        /*
+            Works out the colour, position and size of every dot up front, so that rendering
+            is just a case of looking them up. The first dot is the full trail colour and
+            subsequent dots fade and shrink as per the user's settings.
+        */
+        void HistoryTrailRenderer::BuildDotTables(void)
+        {
+            unsigned int dots = (std::min)(
+                static_cast<unsigned int>((std::max)(this->historyTrailLength, 0)) + 1,
+                AircraftHistoryTrail::maxSize
+            );
+            Gdiplus::REAL reducePerDot = (this->historyTrailDotSizeFloat / this->historyTrailLength) / 2;
+
+            this->dotColours.resize(dots);
+            this->dotOffsets.resize(dots);
+            this->dotSizes.resize(dots);
+            for (unsigned int dot = 0; dot < dots; dot++) {
+                this->dotColours[dot] = dot == 0 || !this->fadingTrails
+                    ? this->startColour->GetValue()
+                    : Gdiplus::Color::MakeARGB(
+                        static_cast<BYTE>((std::max)(255 - static_cast<int>(dot - 1) * this->alphaPerDot, 0)),
+                        this->startColour->GetRed(),
+                        this->startColour->GetGreen(),
+                        this->startColour->GetBlue()
+                    );
+
+                if (this->degradingTrails) {
+                    this->dotOffsets[dot] = (dot * reducePerDot) - (this->historyTrailDotSizeFloat / 2);
+                    this->dotSizes[dot] = this->historyTrailDotSizeFloat - ((dot + 1) * reducePerDot);
+                } else {
+                    this->dotOffsets[dot] = -(this->historyTrailDotSizeFloat / 2);
+                    this->dotSizes[dot] = this->historyTrailDotSizeFloat;
+                }
+            }
         }
 
         /*
@@ -197,6 +236,22 @@ namespace UKControllerPlugin {
             return this->degradingTrails;
         }
 
+        /*
+            Returns the colour of a given dot, 0 being the newest.
+        */
+        Gdiplus::ARGB HistoryTrailRenderer::GetDotColour(unsigned int dot) const
+        {
+            return this->dotColours.at(dot);
+        }
+
+        /*
+            Returns the width and height of a given dot, 0 being the newest.
+        */
+        float HistoryTrailRenderer::GetDotSize(unsigned int dot) const
+        {
+            return this->dotSizes.at(dot);
+        }
+
         /*
             Return whether to fade trails.
         */
@@ -292,98 +347,93 @@ namespace UKControllerPlugin {
             return false;
         }
 
+        /*
+            Gathers up all the trails to be drawn, projects them onto the screen in one batch
+            and then draws each dot using the precomputed dot tables.
+        */
         void HistoryTrailRenderer::Render(
             GdiGraphicsInterface & graphics,
             EuroscopeRadarLoopbackInterface & radarScreen
         ) {
-            Gdiplus::Color currentColourArgb = *this->startColour;
-            this->pen->SetColor(currentColourArgb);
-
             // Anti aliasing
             graphics.SetAntialias((this->antialiasedTrails) ? true : false);
 
-            // The dot we are to make.
-            Gdiplus::RectF dot;
-
-            // The amount that we'll reduce the history dot by on all sides each time.
-            Gdiplus::REAL reducePerDot = (this->historyTrailDotSizeFloat / this->historyTrailLength) / 2;
-
-            int roundNumber;
-            // Loop through the history trails.
+            // Make sure there's room for every aircraft to have a full trail
+            unsigned int maxDots = static_cast<unsigned int>(this->dotColours.size());
+            size_t requiredPositions = this->trails.CountAircraft() * maxDots;
+            if (this->frameLatitudes.size() < requiredPositions) {
+                this->frameLatitudes.resize(requiredPositions);
+                this->frameLongitudes.resize(requiredPositions);
+                this->framePoints.resize(requiredPositions);
+            }
 
+            // Loop through the history trails, these are stored contiguously so walk them in order.
+            size_t framePositions = 0;
+            this->frameTrailSizes.clear();
             std::shared_ptr<EuroScopeCRadarTargetInterface> radarTarget;
-            for (
-                HistoryTrailRepository::const_iterator aircraft = this->trails.cbegin();
-                aircraft != this->trails.cend();
-                ++aircraft
-            ) {
+            for (size_t slot = 0; slot < this->trails.CountAircraft(); slot++) {
+                AircraftHistoryTrail aircraft = this->trails.GetTrail(slot);
+                if (aircraft.Size() == 0) {
+                    continue;
+                }
+
                 // Check the radar target exists
-                radarTarget = this->plugin.GetRadarTargetForCallsign(aircraft->second->GetCallsign());
+                radarTarget = this->plugin.GetRadarTargetForCallsign(aircraft.GetCallsign());
                 if (!radarTarget) {
                     continue;
                 }
 
                 // If they're not going fast enough or are off the screen, don't display the trail.
-                if (radarScreen.GetGroundspeedForCallsign(aircraft->second->GetCallsign()) < this->minimumSpeed ||
-                    radarScreen.PositionOffScreen(*aircraft->second->GetTrail().begin()) ||
+                if (radarScreen.GetGroundspeedForCallsign(aircraft.GetCallsign()) < this->minimumSpeed ||
+                    radarScreen.PositionOffScreen(aircraft.GetPosition(0)) ||
                     radarTarget->GetFlightLevel() < this->minimumDisplayAltitude ||
                     radarTarget->GetFlightLevel() > this->maximumDisplayAltitude
                     ) {
                     continue;
                 }
 
-                // Round number used to govern fade and degrade, reset the colour
-                roundNumber = 0;
-                currentColourArgb = *this->startColour;
-
-                // Reset the dot height and width
-                dot.Width = this->historyTrailDotSizeFloat;
-                dot.Height = this->historyTrailDotSizeFloat;
-
-                // Loop through the points and display.
-                for (
-                    std::deque<EuroScopePlugIn::CPosition>::const_iterator position =
-                        aircraft->second->GetTrail().begin();
-                    position != aircraft->second->GetTrail().end();
-                    ++position
-                ) {
-
-                    POINT dotCoordinates = radarScreen.ConvertCoordinateToScreenPoint(*position);
-                    // Adjust the dot size and position as required
-                    if (this->degradingTrails) {
-                        dot.X = dotCoordinates.x - (this->historyTrailDotSizeFloat / 2) + (roundNumber * reducePerDot);
-                        dot.Y = dotCoordinates.y - (this->historyTrailDotSizeFloat / 2) + (roundNumber * reducePerDot);
-                        dot.Width = dot.Width - reducePerDot;
-                        dot.Height = dot.Height - reducePerDot;
-                    } else {
-                        dot.X = dotCoordinates.x - (this->historyTrailDotSizeFloat / 2);
-                        dot.Y = dotCoordinates.y - (this->historyTrailDotSizeFloat / 2);
+                unsigned int copied = aircraft.CopyPositions(
+                    &this->frameLatitudes[framePositions],
+                    &this->frameLongitudes[framePositions],
+                    maxDots
+                );
+                this->frameTrailSizes.push_back(copied);
+                framePositions += copied;
+            }
+
+            if (framePositions == 0) {
+                return;
+            }
+
+            radarScreen.ConvertCoordinatesToScreenPoints(
+                this->frameLatitudes.data(),
+                this->frameLongitudes.data(),
+                framePositions,
+                this->framePoints.data()
+            );
+
+            // Draw each trail, newest dot first, only changing the pen when the colour changes.
+            Gdiplus::RectF dot;
+            Gdiplus::ARGB penColour = this->dotColours[0];
+            this->pen->SetColor(Gdiplus::Color(penColour));
+            size_t point = 0;
+            for (unsigned int trailSize : this->frameTrailSizes) {
+                for (unsigned int dotIndex = 0; dotIndex < trailSize; dotIndex++, point++) {
+                    if (this->dotColours[dotIndex] != penColour) {
+                        penColour = this->dotColours[dotIndex];
+                        this->pen->SetColor(Gdiplus::Color(penColour));
                     }
 
-                    // Draw the dot
+                    dot.X = this->framePoints[point].x + this->dotOffsets[dotIndex];
+                    dot.Y = this->framePoints[point].y + this->dotOffsets[dotIndex];
+                    dot.Width = this->dotSizes[dotIndex];
+                    dot.Height = this->dotSizes[dotIndex];
+
                     this->DrawDot(
                         graphics,
                         *this->pen,
                         dot
                     );
-
-                    // If the trails are set to fade, reduce the alpha value for the next run
-                    if (this->fadingTrails) {
-                        currentColourArgb = Gdiplus::Color(
-                            255 - (roundNumber * this->alphaPerDot),
-                            currentColourArgb.GetRed(),
-                            currentColourArgb.GetGreen(),
-                            currentColourArgb.GetBlue()
-                        );
-                        this->pen->SetColor(currentColourArgb);
-                    }
-
-                    // If we've done enough dots, we stop.
-                    if (roundNumber == this->historyTrailLength) {
-                        break;
-                    }
-
-                    roundNumber++;
                 }
             }
         }
@@ -56,6 +56,8 @@ namespace UKControllerPlugin {
                 bool GetAntiAliasedTrails(void) const;
                 UKControllerPlugin::Plugin::PopupMenuItem GetConfigurationMenuItem(void) const override;
                 bool GetDegradingTrails(void) const;
+                Gdiplus::ARGB GetDotColour(unsigned int dot) const;
+                float GetDotSize(unsigned int dot) const;
                 bool GetFadingTrails(void) const;
                 int GetHistoryTrailLength(void) const;
                 int GetHistoryTrailType(void) const;
@@ -162,6 +164,7 @@ namespace UKControllerPlugin {
 
             private:
 
+                void BuildDotTables(void);
                 void DrawDot(
                     UKControllerPlugin::Windows::GdiGraphicsInterface & graphics,
                     Gdiplus::Pen & pen,
@@ -216,6 +219,17 @@ namespace UKControllerPlugin {
                 // The altitude at and above which not to display
                 int maximumDisplayAltitude;
 
+                // The colour, offset from the aircraft position and size of each dot, newest first
+                std::vector<Gdiplus::ARGB> dotColours;
+                std::vector<float> dotOffsets;
+                std::vector<float> dotSizes;
+
+                // Scratch space for the positions to be drawn this frame, and how many belong to each trail
+                std::vector<double> frameLatitudes;
+                std::vector<double> frameLongitudes;
+                std::vector<POINT> framePoints;
+                std::vector<unsigned int> frameTrailSizes;
+
                 // The dot command for opening the configuration modal.
                 const std::string dotCommand = ".ukcp h";
         };
@@ -1,65 +1,159 @@
 #include "pch/stdafx.h"
 #include "historytrail/HistoryTrailRepository.h"
-#include "historytrail/AircraftHistoryTrail.h"
-#include "euroscope/EuroScopeCRadarTargetInterface.h"
 
 namespace UKControllerPlugin {
     namespace HistoryTrail {
 
         HistoryTrailRepository::HistoryTrailRepository(void)
+            : HistoryTrailRepository(defaultCapacity)
         {
 
         }
 
+        HistoryTrailRepository::HistoryTrailRepository(size_t capacity)
+            : capacity(capacity)
+        {
+            this->slots.reserve(capacity);
+            this->latitudes.resize(capacity * AircraftHistoryTrail::maxSize);
+            this->longitudes.resize(capacity * AircraftHistoryTrail::maxSize);
+        }
+
         HistoryTrailRepository::~HistoryTrailRepository(void)
         {
 
         }
 
         /*
-            Returns an aircraft in the history trail.
+            Add the latest position for an aircraft, registering it if we don't know about it yet.
+            Once the ring is full, the oldest position is overwritten.
+        */
+        void HistoryTrailRepository::AddPosition(
+            const std::string & callsign,
+            const EuroScopePlugIn::CPosition & position
+        ) {
+            size_t slotIndex = this->FirstOrNewSlot(callsign);
+            TrailSlot & slot = this->slots[slotIndex];
+
+            slot.newest = slot.size == 0 ? 0 : (slot.newest + 1) % AircraftHistoryTrail::maxSize;
+            if (slot.size < AircraftHistoryTrail::maxSize) {
+                slot.size++;
+            }
+
+            size_t arenaIndex = slotIndex * AircraftHistoryTrail::maxSize + slot.newest;
+            this->latitudes[arenaIndex] = position.m_Latitude;
+            this->longitudes[arenaIndex] = position.m_Longitude;
+        }
+
+        size_t HistoryTrailRepository::CountAircraft(void) const
+        {
+            return this->slots.size();
+        }
+
+        /*
+            Returns the trail for an aircraft.
         */
-        std::shared_ptr<AircraftHistoryTrail> HistoryTrailRepository::GetAircraft(std::string callsign)
+        AircraftHistoryTrail HistoryTrailRepository::GetAircraft(const std::string & callsign) const
         {
-            if (!this->HasAircraft(callsign)) {
-                return NULL;
+            std::unordered_map<std::string, size_t>::const_iterator slot = this->slotIndexes.find(callsign);
+            if (slot == this->slotIndexes.cend()) {
+                throw std::invalid_argument("No history trail for " + callsign);
             }
 
-            return this->trailData[callsign];
+            return this->GetTrail(slot->second);
+        }
+
+        size_t HistoryTrailRepository::GetCapacity(void) const
+        {
+            return this->capacity;
+        }
+
+        /*
+            Returns the trail in a given slot, slots 0 to CountAircraft() - 1 are always in use.
+        */
+        AircraftHistoryTrail HistoryTrailRepository::GetTrail(size_t slot) const
+        {
+            const TrailSlot & trail = this->slots.at(slot);
+            return AircraftHistoryTrail(
+                trail.callsign,
+                &this->latitudes[slot * AircraftHistoryTrail::maxSize],
+                &this->longitudes[slot * AircraftHistoryTrail::maxSize],
+                trail.newest,
+                trail.size
+            );
         }
 
         /*
             Returns whether or not the repository knows about a particular callsign.
         */
-        bool HistoryTrailRepository::HasAircraft(std::string callsign) const
+        bool HistoryTrailRepository::HasAircraft(const std::string & callsign) const
         {
-            return this->trailData.count(callsign) == 1;
+            return this->slotIndexes.count(callsign) == 1;
         }
 
         /*
             Adds an aircraft to the history trail repository, if it doesn't already
             exist.
         */
-        void HistoryTrailRepository::RegisterAircraft(std::shared_ptr<AircraftHistoryTrail> trail)
+        void HistoryTrailRepository::RegisterAircraft(const std::string & callsign)
+        {
+            this->FirstOrNewSlot(callsign);
+        }
+
+        /*
+            Removes an aircraft from the history trail repository, if known. The last active slot is moved
+            into the gap so that the active slots stay contiguous.
+        */
+        void HistoryTrailRepository::UnregisterAircraft(const std::string & callsign)
         {
-            if (this->HasAircraft(trail->GetCallsign())) {
+            std::unordered_map<std::string, size_t>::const_iterator slot = this->slotIndexes.find(callsign);
+            if (slot == this->slotIndexes.cend()) {
                 return;
             }
 
-            this->trailData[trail->GetCallsign()] = trail;
+            size_t removedIndex = slot->second;
+            size_t lastIndex = this->slots.size() - 1;
+            this->slotIndexes.erase(slot);
+
+            if (removedIndex != lastIndex) {
+                std::copy_n(
+                    this->latitudes.begin() + lastIndex * AircraftHistoryTrail::maxSize,
+                    AircraftHistoryTrail::maxSize,
+                    this->latitudes.begin() + removedIndex * AircraftHistoryTrail::maxSize
+                );
+                std::copy_n(
+                    this->longitudes.begin() + lastIndex * AircraftHistoryTrail::maxSize,
+                    AircraftHistoryTrail::maxSize,
+                    this->longitudes.begin() + removedIndex * AircraftHistoryTrail::maxSize
+                );
+                this->slots[removedIndex] = std::move(this->slots[lastIndex]);
+                this->slotIndexes[this->slots[removedIndex].callsign] = removedIndex;
+            }
+
+            this->slots.pop_back();
         }
 
         /*
-            Removes an aircraft from the history trail repository, if known.
+            Return the slot for an aircraft, taking the next free slot if we don't know about it. If the
+            arena is full, it doubles in size.
         */
-        void HistoryTrailRepository::UnregisterAircraft(std::string callsign)
+        size_t HistoryTrailRepository::FirstOrNewSlot(const std::string & callsign)
         {
-            if (!this->HasAircraft(callsign)) {
-                return;
+            std::unordered_map<std::string, size_t>::const_iterator slot = this->slotIndexes.find(callsign);
+            if (slot != this->slotIndexes.cend()) {
+                return slot->second;
+            }
+
+            if (this->slots.size() == this->capacity) {
+                this->capacity = this->capacity == 0 ? 1 : this->capacity * 2;
+                this->slots.reserve(this->capacity);
+                this->latitudes.resize(this->capacity * AircraftHistoryTrail::maxSize);
+                this->longitudes.resize(this->capacity * AircraftHistoryTrail::maxSize);
             }
 
-            // Remove from the map and destroy the object.
-            this->trailData.erase(callsign);
+            size_t newIndex = this->slots.size();
+            this->slots.push_back({ callsign, 0, 0 });
+            this->slotIndexes[callsign] = newIndex;
+            return newIndex;
         }
     }  // namespace HistoryTrail
 }  // namespace UKControllerPlugin
@@ -1,35 +1,65 @@
 #pragma once
+#include "historytrail/AircraftHistoryTrail.h"
 
 namespace UKControllerPlugin {
     namespace HistoryTrail {
 
-        // Pre-declarations in the namespace
-        class AircraftHistoryTrail;
-        // END
-
         /*
             This class stores all the history trails currently in use by the plugin.
             It provides a public interface that allows other classes to register and unregister
             aircraft, update aircraft positions and retrieve the trail.
+
+            Every aircraft gets a slot in a single preallocated arena, which holds a fixed size ring buffer
+            of latitudes and a separate one of longitudes. Adding a position is O(1) and never allocates.
+            Active aircraft are always kept in the first CountAircraft() slots, so rendering can walk
+            straight through the arena.
         */
         class HistoryTrailRepository
         {
             public:
                 HistoryTrailRepository(void);
+                explicit HistoryTrailRepository(size_t capacity);
                 ~HistoryTrailRepository(void);
-                std::shared_ptr<AircraftHistoryTrail> GetAircraft(std::string callsign);
-                bool HasAircraft(std::string callsign) const;
-                void UnregisterAircraft(std::string callsign);
-                void RegisterAircraft(std::shared_ptr <AircraftHistoryTrail>);
-
-                // Public type definitions for a custom iterator over the class.
-                typedef std::map<std::string, std::shared_ptr<AircraftHistoryTrail>> HistoryTrails;
-                typedef HistoryTrails::const_iterator const_iterator;
-                const_iterator cbegin(void) const { return trailData.cbegin(); }
-                const_iterator cend(void) const { return trailData.cend(); }
-
-                // Map of callsign to history trail
-                HistoryTrails trailData;
-            };
+                void AddPosition(const std::string & callsign, const EuroScopePlugIn::CPosition & position);
+                size_t CountAircraft(void) const;
+                AircraftHistoryTrail GetAircraft(const std::string & callsign) const;
+                size_t GetCapacity(void) const;
+                AircraftHistoryTrail GetTrail(size_t slot) const;
+                bool HasAircraft(const std::string & callsign) const;
+                void RegisterAircraft(const std::string & callsign);
+                void UnregisterAircraft(const std::string & callsign);
+
+                // How many aircraft to make room for up front
+                static const size_t defaultCapacity = 2000;
+
+            private:
+
+                size_t FirstOrNewSlot(const std::string & callsign);
+
+                typedef struct TrailSlot
+                {
+                    // The aircraft the slot belongs to
+                    std::string callsign;
+
+                    // Where in the ring the newest position is
+                    unsigned int newest;
+
+                    // How many positions are in the ring
+                    unsigned int size;
+                } TrailSlot;
+
+                // How many aircraft the arena has room for
+                size_t capacity;
+
+                // Callsign -> slot
+                std::unordered_map<std::string, size_t> slotIndexes;
+
+                // The active slots, in arena order
+                std::vector<TrailSlot> slots;
+
+                // The arena, AircraftHistoryTrail::maxSize positions per slot
+                std::vector<double> latitudes;
+                std::vector<double> longitudes;
+        };
     }  // namespace HistoryTrail
 }  // namespace UKControllerPlugin
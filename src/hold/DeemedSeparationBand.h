@@ -0,0 +1,22 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Hold {
+
+        /*
+            The levels at which one published hold is deemed separated from
+            another, worked out from where the two holds overlap.
+        */
+        typedef struct DeemedSeparationBand
+        {
+            // The lowest level that both holds cover
+            unsigned int minimum;
+
+            // The highest level that both holds cover
+            unsigned int maximum;
+
+            // The distance at which aircraft should be inserted into the VSL
+            unsigned int vslInsertDistance;
+        } DeemedSeparationBand;
+    }  // namespace Hold
+}  // namespace UKControllerPlugin
@@ -28,7 +28,8 @@ namespace UKControllerPlugin
             HoldManager& holdManager,
             const Navaids::Navaid& navaid,
             const PublishedHoldCollection& publishedHoldCollection,
-            const DialogManager& dialogManager
+            const DialogManager& dialogManager,
+            const HoldingSnapshot& holdingSnapshot
         )
             : navaid(navaid),
               publishedHolds(std::move(publishedHoldCollection.GetForFix(navaid.identifier))),
@@ -36,6 +37,7 @@ namespace UKControllerPlugin
               plugin(plugin),
               dialogManager(dialogManager),
               publishedHoldCollection(publishedHoldCollection),
+              holdingSnapshot(holdingSnapshot),
               titleBarTextBrush(Gdiplus::Color(227, 227, 227)),
               titleBarBrush(Gdiplus::Color(197, 129, 214)),
               dataBrush(Gdiplus::Color(7, 237, 7)),
@@ -332,7 +334,8 @@ namespace UKControllerPlugin
          * we don't want to keep.
          */
         void HoldDisplay::FilterVslDisplayLevels(
-            std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>& levelMap
+            std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>& levelMap,
+            const HoldingSnapshot& snapshot
         ) const
         {
             for (
@@ -340,7 +343,7 @@ namespace UKControllerPlugin
                 level != levelMap.end();
             ) {
                 // Filter out aircraft at each level that we don't need to keep
-                this->FilterAircraftAtLevel(level->first, level->second);
+                this->FilterAircraftAtLevel(level->first, level->second, snapshot);
 
                 // Filter out levels that have nothing we need to display
                 if (this->ShouldFilterVslLevel(level->second)) {
@@ -385,7 +388,8 @@ namespace UKControllerPlugin
          */
         void HoldDisplay::FilterAircraftAtLevel(
             int level,
-            std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& holdingAircraft
+            std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& holdingAircraft,
+            const HoldingSnapshot& snapshot
         ) const
         {
             /*
@@ -413,7 +417,7 @@ namespace UKControllerPlugin
                 if (
                     !this->AircraftAssignedToHold(aircraft) &&
                     aircraft->GetAssignedHold() != aircraft->noHoldAssigned &&
-                    this->AircraftInDeemedSeparatedHold(level, aircraft, holdingAircraft)
+                    this->AircraftInDeemedSeparatedHold(level, aircraft, holdingAircraft, snapshot)
                 ) {
                     aircraftIt = holdingAircraft.erase(aircraftIt);
                 } else {
@@ -430,14 +434,28 @@ namespace UKControllerPlugin
         bool HoldDisplay::AircraftInDeemedSeparatedHold(
             int level,
             const std::shared_ptr<HoldingAircraft>& aircraft,
-            const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraftAtLevel
+            const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraftAtLevel,
+            const HoldingSnapshot& snapshot
         ) const
         {
+            /*
+             * Check that one of the published holds at this fix is deemed separated from the aircraft's
+             * assigned hold at this level, and if so the distance at which the VSL insert happens.
+             */
+            unsigned int vslInsertDistance = this->publishedHoldCollection.GetVslInsertDistance(
+                this->navaid.identifier,
+                aircraft->GetAssignedHold(),
+                level
+            );
+
+            if (vslInsertDistance == this->publishedHoldCollection.notDeemedSeparated) {
+                return false;
+            }
+
             // Make sure there's a radar target for the aircraft we're checking.
-            std::shared_ptr<EuroScopeCRadarTargetInterface> aircraftRadarTarget = this->plugin.
-                GetRadarTargetForCallsign(aircraft->GetCallsign());
+            const HoldingAircraftSnapshot* aircraftSnapshot = snapshot.GetAircraft(aircraft->GetCallsign());
 
-            if (!aircraftRadarTarget) {
+            if (!aircraftSnapshot) {
                 return false;
             }
 
@@ -445,59 +463,24 @@ namespace UKControllerPlugin
             return std::find_if(
                 aircraftAtLevel.cbegin(),
                 aircraftAtLevel.cend(),
-                [&level, &aircraftRadarTarget, &aircraft, this](
+                [&vslInsertDistance, &aircraftSnapshot, &snapshot, this](
                 const std::shared_ptr<HoldingAircraft>& conflictingAircraft) -> bool
                 {
-                    std::shared_ptr<EuroScopeCRadarTargetInterface> conflictingRadarTarget =
-                        this->plugin.GetRadarTargetForCallsign(conflictingAircraft->GetCallsign());
-
                     /*
-                     * 1. Check that the conflicting aircraft has a radar target
-                     * 2. Check that the conflicting aircraft is actually assigned to hold here
-                     * 3. Check each of the published holds at this fix
+                     * 1. Check that the conflicting aircraft is actually assigned to hold here
+                     * 2. Check that the conflicting aircraft has a radar target
+                     * 3. Check that the distance between the two aircraft is greater than the
+                     * force VSL insert distance.
                      */
-                    return conflictingRadarTarget != nullptr &&
-                        this->AircraftAssignedToHold(conflictingAircraft) &&
-                        std::find_if(
-                            this->publishedHolds.cbegin(),
-                            this->publishedHolds.cend(),
-                            [this, &level, &conflictingAircraft, &conflictingRadarTarget, &aircraft,
-                                &aircraftRadarTarget](
-                            const HoldingData* const publishedHold)-> bool
-                        {
-                            /*
-                             * 3a. Make sure that the level the aircraft are at is within the published hold
-                             * 3b. Check each of the deemed separated holds for this published hold
-                             */
-                            return publishedHold->LevelWithinHold(level) &&
-                                std::find_if(
-                                    publishedHold->deemedSeparatedHolds.cbegin(),
-                                    publishedHold->deemedSeparatedHolds.cend(),
-                                    [this, &level, &conflictingAircraft, &aircraft, &aircraftRadarTarget,
-                                        &conflictingRadarTarget](
-                                    const std::unique_ptr<DeemedSeparatedHold>& deemedSeparatedHold)-> bool
-                                    {
-                                        const HoldingData& publishedSeparatedHold =
-                                            this->publishedHoldCollection.GetById(deemedSeparatedHold->identifier);
-
-                                        /*
-                                         * 3bi. Check the deemed separated hold is published
-                                         * 3bii. Check if the level is within the deemed separated hold
-                                         * 3biii. Check if the aircraft that we're interested in is assigned to the
-                                         * deemed separated hold
-                                         * 3biv. Check that the distance between the two aircraft is greater than the
-                                         * force VSL insert distance.
-                                         */
-                                        return publishedSeparatedHold != this->publishedHoldCollection.noHold &&
-                                            publishedSeparatedHold.LevelWithinHold(level) &&
-                                            aircraft->GetAssignedHold() == publishedSeparatedHold.fix &&
-                                            aircraftRadarTarget->GetPosition().DistanceTo(
-                                                conflictingRadarTarget->GetPosition()
-                                            ) > deemedSeparatedHold->vslInsertDistance;
-                                    }
-                                ) != publishedHold->deemedSeparatedHolds.cend();
-                        }
-                    ) != publishedHolds.cend();
+                    if (!this->AircraftAssignedToHold(conflictingAircraft)) {
+                        return false;
+                    }
+
+                    const HoldingAircraftSnapshot* conflictingSnapshot =
+                        snapshot.GetAircraft(conflictingAircraft->GetCallsign());
+
+                    return conflictingSnapshot != nullptr &&
+                        aircraftSnapshot->position.DistanceTo(conflictingSnapshot->position) > vslInsertDistance;
                 }
             ) != aircraftAtLevel.cend();
         }
@@ -512,15 +495,29 @@ namespace UKControllerPlugin
 
         /*
             Maps the holding aircraft to their occupied levels and filters out ones we dont
-            want to display in the VSL
+            want to display in the VSL, looking the aircraft up in EuroScope as we go
         */
         std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>
         HoldDisplay::MapAircraftToLevels(
             const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraft
         ) const
+        {
+            HoldingSnapshot snapshot(this->holdManager, this->plugin);
+            snapshot.Refresh(aircraft);
+            return this->MapAircraftToLevels(aircraft, snapshot);
+        }
+
+        /*
+            Maps the holding aircraft to their occupied levels and filters out ones we dont
+            want to display in the VSL, using a snapshot of the aircraft
+        */
+        std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>
+        HoldDisplay::MapAircraftToLevels(
+            const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraft,
+            const HoldingSnapshot& snapshot
+        ) const
         {
             std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>> levelMap;
-            std::shared_ptr<EuroScopeCRadarTargetInterface> rt;
 
             for (
                 auto it = aircraft.cbegin();
@@ -528,13 +525,13 @@ namespace UKControllerPlugin
                 ++it
             ) {
                 // Check for the radar target
-                rt = this->plugin.GetRadarTargetForCallsign((*it)->GetCallsign());
-                if (!rt) {
+                const HoldingAircraftSnapshot* aircraftSnapshot = snapshot.GetAircraft((*it)->GetCallsign());
+                if (!aircraftSnapshot) {
                     continue;
                 }
 
                 // If the aircraft is above the displaying levels of the hold, dont map
-                int occupied = GetOccupiedLevel(rt->GetFlightLevel(), rt->GetVerticalSpeed());
+                int occupied = GetOccupiedLevel(aircraftSnapshot->flightLevel, aircraftSnapshot->verticalSpeed);
                 if (occupied > this->maximumLevel || occupied < this->minimumLevel) {
                     continue;
                 }
@@ -543,7 +540,7 @@ namespace UKControllerPlugin
             }
 
             // Filter out levels that we aren't interested in
-            this->FilterVslDisplayLevels(levelMap);
+            this->FilterVslDisplayLevels(levelMap, snapshot);
             return levelMap;
         }
 
@@ -930,7 +927,10 @@ namespace UKControllerPlugin
         {
             // Get the aircraft in each hold level
             const std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>> holdingAircraft =
-                this->MapAircraftToLevels(this->holdManager.GetAircraftForHold(this->navaid.identifier));
+                this->MapAircraftToLevels(
+                    this->holdManager.GetAircraftForHold(this->navaid.identifier),
+                    this->holdingSnapshot
+                );
 
             // Render the background
             Gdiplus::Rect backgroundRect = this->GetHoldViewBackgroundRender(holdingAircraft);
@@ -1049,13 +1049,10 @@ namespace UKControllerPlugin
                     verticalSpeedArrowDisplayEnd.Y = verticalSpeedArrowDisplayEnd.Y + this->lineHeight;
 
                 } else {
-                    std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft> aircraftAtLevel =
+                    const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraftAtLevel =
                         holdingAircraft.at(level);
                     int aircraftIndex = 0;
 
-                    std::shared_ptr<EuroScopeCRadarTargetInterface> rt;
-                    std::shared_ptr<EuroScopeCFlightPlanInterface> fp;
-
                     // We have holding aircraft to deal with, render them in
                     for (
                         std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>::const_iterator
@@ -1078,24 +1075,27 @@ namespace UKControllerPlugin
                         }
 
 
-                        rt = this->plugin.GetRadarTargetForCallsign((*it)->GetCallsign());
-                        fp = this->plugin.GetFlightplanForCallsign((*it)->GetCallsign());
+                        std::string callsign = (*it)->GetCallsign();
+                        const HoldingAircraftSnapshot* aircraftSnapshot = this->holdingSnapshot.GetAircraft(callsign);
 
-                        if (fp && rt) {
-                            if (rt->GetPosition().DistanceTo(this->navaid.coordinates) < this->sameLevelBoxDistance) {
+                        if (aircraftSnapshot && aircraftSnapshot->hasFlightplan) {
+                            if (
+                                aircraftSnapshot->position.DistanceTo(this->navaid.coordinates) <
+                                this->sameLevelBoxDistance
+                            ) {
                                 aircraftInProximity = true;
                             }
 
                             // Callsign
-                            std::wstring callsign = ConvertToTchar((*it)->GetCallsign());
+                            std::wstring callsignDisplayString = ConvertToTchar(callsign);
                             graphics.DrawString(
-                                callsign,
+                                callsignDisplayString,
                                 callsignDisplay,
                                 this->dataBrush
                             );
                             radarScreen.RegisterScreenObject(
                                 screenObjectId,
-                                this->navaid.identifier + "/callsign/" + fp->GetCallsign(),
+                                this->navaid.identifier + "/callsign/" + callsign,
                                 {
                                     callsignDisplay.X,
                                     callsignDisplay.Y,
@@ -1107,17 +1107,17 @@ namespace UKControllerPlugin
 
                             // Reported level
                             graphics.DrawString(
-                                GetLevelDisplayString(rt->GetFlightLevel()),
+                                GetLevelDisplayString(aircraftSnapshot->flightLevel),
                                 actualLevelDisplay,
                                 this->dataBrush
                             );
-                            if (GetVerticalSpeedDirection(rt->GetVerticalSpeed()) == 1) {
+                            if (GetVerticalSpeedDirection(aircraftSnapshot->verticalSpeed) == 1) {
                                 graphics.DrawLine(
                                     this->verticalSpeedAscentPen,
                                     verticalSpeedArrowDisplayStart,
                                     verticalSpeedArrowDisplayEnd
                                 );
-                            } else if (GetVerticalSpeedDirection(rt->GetVerticalSpeed()) == -1) {
+                            } else if (GetVerticalSpeedDirection(aircraftSnapshot->verticalSpeed) == -1) {
                                 graphics.DrawLine(
                                     this->verticalSpeedDescentPen,
                                     verticalSpeedArrowDisplayStart,
@@ -1128,15 +1128,15 @@ namespace UKControllerPlugin
 
                             // Cleared level - plus a clickspot for the aircraft in question
                             graphics.DrawString(
-                                fp->GetClearedAltitude() == 0
+                                aircraftSnapshot->clearedAltitude == 0
                                     ? L"---"
-                                    : GetLevelDisplayString(fp->GetClearedAltitude()),
+                                    : GetLevelDisplayString(aircraftSnapshot->clearedAltitude),
                                 clearedLevelDisplay,
                                 this->clearedLevelBrush
                             );
                             radarScreen.RegisterScreenObject(
                                 screenObjectId,
-                                this->navaid.identifier + "/cleared/" + fp->GetCallsign(),
+                                this->navaid.identifier + "/cleared/" + callsign,
                                 {
                                     clearedLevelDisplay.X,
                                     clearedLevelDisplay.Y,
@@ -4,6 +4,7 @@
 #include "hold/CompareHolds.h"
 #include "hold/CompareHoldingAircraft.h"
 #include "hold/PublishedHoldCollection.h"
+#include "hold/HoldingSnapshot.h"
 #include "dialog/DialogManager.h"
 
 namespace UKControllerPlugin {
@@ -34,7 +35,8 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Hold::HoldManager & holdManager,
                     const UKControllerPlugin::Navaids::Navaid& navaid,
                     const PublishedHoldCollection& publishedHoldCollection,
-                    const Dialog::DialogManager& dialogManager
+                    const Dialog::DialogManager& dialogManager,
+                    const HoldingSnapshot& holdingSnapshot
                 );
                 void ButtonClicked(std::string button);
                 void CallsignClicked(
@@ -80,6 +82,11 @@ namespace UKControllerPlugin {
                     MapAircraftToLevels(
                         const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraft
                     ) const;
+                std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>
+                    MapAircraftToLevels(
+                        const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraft,
+                        const HoldingSnapshot& snapshot
+                    ) const;
                 bool IsInInformationMode(void) const;
                 bool IsMinimised(void) const;
                 void LoadDataFromAsr(
@@ -148,7 +155,8 @@ namespace UKControllerPlugin {
                     const int screenObjectId
                 ) const;
                 void FilterVslDisplayLevels(
-                    std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>& levelMap
+                    std::map<int, std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>>& levelMap,
+                    const HoldingSnapshot& snapshot
                 ) const;
                 bool ShouldFilterVslLevel(
                     const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& holdingAircraft
@@ -158,12 +166,14 @@ namespace UKControllerPlugin {
                 ) const;
                 void FilterAircraftAtLevel(
                     int level,
-                    std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& holdingAircraft
+                    std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& holdingAircraft,
+                    const HoldingSnapshot& snapshot
                 ) const;
                 bool AircraftInDeemedSeparatedHold(
                     int level,
                     const std::shared_ptr<HoldingAircraft>& aircraft,
-                    const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraftAtLevel
+                    const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>& aircraftAtLevel,
+                    const HoldingSnapshot& snapshot
                 ) const;
                 bool AircraftAssignedToHold(const std::shared_ptr<HoldingAircraft>& aircraft) const;
 
@@ -179,6 +189,9 @@ namespace UKControllerPlugin {
                 // Has all the published holds
                 const PublishedHoldCollection& publishedHoldCollection;
 
+                // The holding aircraft as of this frame, shared with the other displays
+                const HoldingSnapshot& holdingSnapshot;
+
                 // Brushes
                 const Gdiplus::SolidBrush titleBarTextBrush;
                 const Gdiplus::SolidBrush titleBarBrush;
@@ -21,7 +21,8 @@ namespace UKControllerPlugin {
             const DialogManager& dialogManager
         )
             : plugin(plugin), holdManager(holdManager), navaids(navaids),
-            holds(holds), dialogManager(dialogManager)
+            holds(holds), dialogManager(dialogManager),
+            holdingSnapshot(std::make_unique<HoldingSnapshot>(holdManager, plugin))
         {
 
         }
@@ -42,8 +43,17 @@ namespace UKControllerPlugin {
                 holdManager,
                 navaidData,
                 holds,
-                dialogManager
+                dialogManager,
+                *holdingSnapshot
             );
         }
+
+        /*
+            Refresh the holding aircraft that all the created displays use, once per frame
+        */
+        void HoldDisplayFactory::RefreshSnapshot(void) const
+        {
+            this->holdingSnapshot->Refresh();
+        }
     }  // namespace Hold
 }  // namespace UKControllerPlugin
@@ -1,6 +1,7 @@
 #pragma once
 #include "hold/HoldDisplay.h"
 #include "hold/PublishedHoldCollection.h"
+#include "hold/HoldingSnapshot.h"
 #include "navaids/NavaidCollection.h"
 
 namespace UKControllerPlugin {
@@ -29,6 +30,7 @@ namespace UKControllerPlugin {
                     const UKControllerPlugin::Dialog::DialogManager& dialogManager
                 );
                 std::unique_ptr<UKControllerPlugin::Hold::HoldDisplay> Create(std::string navaid) const;
+                void RefreshSnapshot(void) const;
 
             private:
 
@@ -46,6 +48,9 @@ namespace UKControllerPlugin {
 
                 // Dialog manager
                 const UKControllerPlugin::Dialog::DialogManager& dialogManager;
+
+                // The holding aircraft, shared by every display that the factory creates
+                const std::unique_ptr<UKControllerPlugin::Hold::HoldingSnapshot> holdingSnapshot;
         };
     }  // namespace Hold
 }  // namespace UKControllerPlugin
@@ -63,6 +63,14 @@ namespace UKControllerPlugin {
             }
         }
 
+        /*
+            Refresh the holding aircraft that the displays render from
+        */
+        void HoldDisplayManager::RefreshSnapshot(void) const
+        {
+            this->displayFactory.RefreshSnapshot();
+        }
+
         /*
             Return a display by hold fix
         */
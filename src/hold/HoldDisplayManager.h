@@ -26,6 +26,7 @@ namespace UKControllerPlugin {
                 const UKControllerPlugin::Hold::HoldDisplay & GetDisplay(std::string fix) const;
                 std::vector<std::string> GetSelectedHolds(void) const;
                 void LoadSelectedHolds(std::vector<std::string> holds);
+                void RefreshSnapshot(void) const;
 
                 // Inherited via AsrEventHandlerInterface
                 void AsrLoadedEvent(UKControllerPlugin::Euroscope::UserSetting & userSetting) override;
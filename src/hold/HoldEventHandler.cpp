@@ -15,6 +15,7 @@ using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 using UKControllerPlugin::Euroscope::EuroscopeSectorFileElementInterface;
 using UKControllerPlugin::Hold::HoldManager;
 using UKControllerPlugin::Plugin::PopupMenuItem;
+using UKControllerPlugin::Navaids::Navaid;
 using UKControllerPlugin::Navaids::NavaidCollection;
 using UKControllerPlugin::Websocket::WebsocketMessage;
 using UKControllerPlugin::Websocket::WebsocketSubscription;
@@ -58,6 +59,10 @@ namespace UKControllerPlugin {
             }
         }
 
+        /*
+            Work out which navaids each aircraft is near to. The hold manager is only updated, and the
+            flightplan marked as dirty, when an aircraft enters or leaves the proximity of a hold.
+        */
         void HoldEventHandler::TimedEventTrigger(void)
         {
             this->plugin.ApplyFunctionToAllFlightplans(
@@ -65,18 +70,50 @@ namespace UKControllerPlugin {
                     std::shared_ptr<EuroScopeCFlightPlanInterface> fp,
                     std::shared_ptr<EuroScopeCRadarTargetInterface> rt
                 ) {
-                    for (
-                        NavaidCollection::const_iterator navaids = this->navaids.cbegin();
-                        navaids != this->navaids.cend();
-                        ++navaids
-                    ) {
-                        if (rt->GetPosition().DistanceTo(navaids->coordinates) <= this->proximityDistance) {
-                            this->holdManager.AddAircraftToProximityHold(fp->GetCallsign(), navaids->identifier);
-                        } else {
-                            this->holdManager.RemoveAircraftFromProximityHold(fp->GetCallsign(), navaids->identifier);
+                    this->navaids.FindWithinDistance(rt->GetPosition(), this->proximityDistance, this->nearbyNavaids);
+                    std::string callsign = fp->GetCallsign();
+                    std::shared_ptr<HoldingAircraft> aircraft = this->holdManager.GetHoldingAircraft(callsign);
+
+                    // Nowhere near a hold and wasn't before, nothing to do
+                    if (!aircraft && this->nearbyNavaids.empty()) {
+                        return;
+                    }
+
+                    // Holds that the aircraft is newly in the proximity of
+                    bool changed = false;
+                    for (const Navaid * navaid : this->nearbyNavaids) {
+                        if (!aircraft || !aircraft->IsInHoldProximity(navaid->identifier)) {
+                            this->holdManager.AddAircraftToProximityHold(callsign, navaid->identifier);
+                            changed = true;
                         }
                     }
 
+                    if (!aircraft) {
+                        this->plugin.MarkFlightplanDirty(callsign);
+                        return;
+                    }
+
+                    // Holds that the aircraft is no longer in the proximity of
+                    this->departedHolds.clear();
+                    for (const std::string & hold : aircraft->GetProximityHolds()) {
+                        if (
+                            std::find_if(
+                                this->nearbyNavaids.cbegin(),
+                                this->nearbyNavaids.cend(),
+                                [&hold](const Navaid * navaid) -> bool { return navaid->identifier == hold; }
+                            ) == this->nearbyNavaids.cend()
+                        ) {
+                            this->departedHolds.push_back(hold);
+                        }
+                    }
+
+                    for (const std::string & hold : this->departedHolds) {
+                        this->holdManager.RemoveAircraftFromProximityHold(callsign, hold);
+                    }
+
+                    if (changed || !this->departedHolds.empty()) {
+                        this->plugin.MarkFlightplanDirty(callsign);
+                    }
                 }
             );
         }
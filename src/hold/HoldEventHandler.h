@@ -69,6 +69,10 @@ namespace UKControllerPlugin {
 
                 // Manages holds
                 UKControllerPlugin::Hold::HoldManager & holdManager;
+
+                // Scratch space for the navaids near to an aircraft and the holds it has left, reused between aircraft
+                std::vector<const UKControllerPlugin::Navaids::Navaid *> nearbyNavaids;
+                std::vector<std::string> departedHolds;
         };
     }  // namespace Hold
 }  // namespace UKControllerPlugin
@@ -78,7 +78,7 @@ namespace UKControllerPlugin {
                 return;
             }
 
-            this->taskRunner.QueueAsynchronousTask([this, callsign, hold]() {
+            this->taskRunner.QueueInteractiveTask([this, callsign, hold]() {
                 try {
                     this->api.AssignAircraftToHold(callsign, hold);
                 }
@@ -99,6 +99,15 @@ namespace UKControllerPlugin {
                 : this->invalidHolds;
         }
 
+        /*
+            Get every aircraft that is holding or in the proximity of a hold
+        */
+        const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>&
+            HoldManager::GetAllHoldingAircraft(void) const
+        {
+            return this->aircraft;
+        }
+
         const std::shared_ptr<HoldingAircraft>& HoldManager::GetHoldingAircraft(std::string callsign)
         {
             auto aircraft = this->aircraft.find(callsign);
@@ -134,7 +143,7 @@ namespace UKControllerPlugin {
                 return;
             }
 
-            this->taskRunner.QueueAsynchronousTask([this, callsign]() {
+            this->taskRunner.QueueInteractiveTask([this, callsign]() {
                 try {
                     this->api.UnassignAircraftHold(callsign);
                 }
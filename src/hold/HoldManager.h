@@ -42,6 +42,8 @@ namespace UKControllerPlugin {
                 size_t CountHoldingAircraft(void) const;
                 const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>&
                     GetAircraftForHold(std::string hold) const;
+                const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft>&
+                    GetAllHoldingAircraft(void) const;
                 const std::shared_ptr<HoldingAircraft>& GetHoldingAircraft(std::string callsign);
                 void UnassignAircraftFromHold(std::string callsign, bool updateApi);
                 void RemoveAircraftFromProximityHold(std::string callsign, std::string hold);
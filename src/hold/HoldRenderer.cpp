@@ -147,6 +147,12 @@ namespace UKControllerPlugin {
             GdiGraphicsInterface & graphics,
             EuroscopeRadarLoopbackInterface & radarScreen
         ) {
+            if (this->displays->CountDisplays() == 0) {
+                return;
+            }
+
+            // Look the holding aircraft up once for all of the displays
+            this->displays->RefreshSnapshot();
             for (
                 HoldDisplayManager::const_iterator it = this->displays->cbegin();
                 it != this->displays->cend();
@@ -34,7 +34,7 @@ namespace UKControllerPlugin {
             return this->callsign;
         }
 
-        const std::set<std::string> HoldingAircraft::GetProximityHolds(void) const
+        const std::set<std::string> & HoldingAircraft::GetProximityHolds(void) const
         {
             return this->proximityHolds;
         }
@@ -16,7 +16,7 @@ namespace UKControllerPlugin {
                 std::string GetAssignedHold(void) const;
                 const std::chrono::system_clock::time_point& GetAssignedHoldEntryTime(void) const;
                 std::string GetCallsign(void) const;
-                const std::set<std::string> GetProximityHolds(void) const;
+                const std::set<std::string> & GetProximityHolds(void) const;
                 bool IsInAnyHold(void) const;
                 bool IsInHold(std::string hold) const;
                 bool IsInHoldProximity(std::string hold) const;
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Hold {
+
+        /*
+            What the hold displays need to know about a holding aircraft, taken from
+            its radar target and flightplan once per frame.
+        */
+        typedef struct HoldingAircraftSnapshot
+        {
+            // Where the aircraft is
+            EuroScopePlugIn::CPosition position;
+
+            // The reported level of the aircraft
+            int flightLevel = 0;
+
+            // The reported vertical speed of the aircraft
+            int verticalSpeed = 0;
+
+            // Whether the aircraft has a flightplan
+            bool hasFlightplan = false;
+
+            // The cleared altitude from the flightplan
+            int clearedAltitude = 0;
+
+            // The refresh in which the aircraft was last seen
+            unsigned int refresh = 0;
+        } HoldingAircraftSnapshot;
+    }  // namespace Hold
+}  // namespace UKControllerPlugin
@@ -0,0 +1,89 @@
+#include "pch/stdafx.h"
+#include "hold/HoldingSnapshot.h"
+#include "hold/HoldingAircraft.h"
+#include "hold/HoldManager.h"
+#include "euroscope/EuroscopePluginLoopbackInterface.h"
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "euroscope/EuroScopeCRadarTargetInterface.h"
+
+using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+
+namespace UKControllerPlugin {
+    namespace Hold {
+
+        HoldingSnapshot::HoldingSnapshot(
+            const HoldManager & holdManager,
+            EuroscopePluginLoopbackInterface & plugin
+        )
+            : holdManager(holdManager), plugin(plugin)
+        {
+
+        }
+
+        /*
+            Count the aircraft in the snapshot
+        */
+        size_t HoldingSnapshot::Count(void) const
+        {
+            return this->aircraft.size();
+        }
+
+        /*
+            Get an aircraft from the snapshot, nullptr if it had no radar target
+        */
+        const HoldingAircraftSnapshot * HoldingSnapshot::GetAircraft(const std::string & callsign) const
+        {
+            auto aircraft = this->aircraft.find(callsign);
+            return aircraft != this->aircraft.cend() ? &aircraft->second : nullptr;
+        }
+
+        /*
+            Take a snapshot of every aircraft known to the hold manager
+        */
+        void HoldingSnapshot::Refresh(void)
+        {
+            this->Refresh(this->holdManager.GetAllHoldingAircraft());
+        }
+
+        /*
+            Take a snapshot of the given aircraft. Entries are updated in place so that
+            a steady set of holding aircraft doesn't allocate, anything not seen this
+            time around is removed.
+        */
+        void HoldingSnapshot::Refresh(
+            const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft> & aircraft
+        ) {
+            this->refreshes++;
+            for (const std::shared_ptr<HoldingAircraft> & holdingAircraft : aircraft) {
+                std::string callsign = holdingAircraft->GetCallsign();
+                std::shared_ptr<EuroScopeCRadarTargetInterface> radarTarget =
+                    this->plugin.GetRadarTargetForCallsign(callsign);
+
+                if (!radarTarget) {
+                    continue;
+                }
+
+                std::shared_ptr<EuroScopeCFlightPlanInterface> flightplan =
+                    this->plugin.GetFlightplanForCallsign(callsign);
+
+                HoldingAircraftSnapshot & snapshot = this->aircraft[callsign];
+                snapshot.position = radarTarget->GetPosition();
+                snapshot.flightLevel = radarTarget->GetFlightLevel();
+                snapshot.verticalSpeed = radarTarget->GetVerticalSpeed();
+                snapshot.hasFlightplan = flightplan != nullptr;
+                snapshot.clearedAltitude = flightplan ? flightplan->GetClearedAltitude() : 0;
+                snapshot.refresh = this->refreshes;
+            }
+
+            for (auto snapshot = this->aircraft.begin(); snapshot != this->aircraft.end();) {
+                if (snapshot->second.refresh != this->refreshes) {
+                    snapshot = this->aircraft.erase(snapshot);
+                } else {
+                    ++snapshot;
+                }
+            }
+        }
+    }  // namespace Hold
+}  // namespace UKControllerPlugin
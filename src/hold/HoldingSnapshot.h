@@ -0,0 +1,50 @@
+#pragma once
+#include "hold/HoldingAircraftSnapshot.h"
+#include "hold/CompareHoldingAircraft.h"
+
+namespace UKControllerPlugin {
+    namespace Hold {
+        class HoldManager;
+        class HoldingAircraft;
+    }  // namespace Hold
+    namespace Euroscope {
+        class EuroscopePluginLoopbackInterface;
+    }  // namespace Euroscope
+}  // namespace UKControllerPlugin
+
+namespace UKControllerPlugin {
+    namespace Hold {
+
+        /*
+            The radar target and flightplan data of every holding aircraft, fetched from
+            EuroScope once per frame and shared by all of the hold displays, so that each
+            display doesn't have to look every aircraft up again for every check it makes.
+        */
+        class HoldingSnapshot
+        {
+            public:
+                HoldingSnapshot(
+                    const UKControllerPlugin::Hold::HoldManager & holdManager,
+                    UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & plugin
+                );
+                size_t Count(void) const;
+                const HoldingAircraftSnapshot * GetAircraft(const std::string & callsign) const;
+                void Refresh(void);
+                void Refresh(const std::set<std::shared_ptr<HoldingAircraft>, CompareHoldingAircraft> & aircraft);
+
+            private:
+
+                // The hold manager
+                const UKControllerPlugin::Hold::HoldManager & holdManager;
+
+                // Reference to the plugin
+                UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & plugin;
+
+                // The aircraft that have a radar target, by callsign
+                std::unordered_map<std::string, HoldingAircraftSnapshot> aircraft;
+
+                // How many times the snapshot has been refreshed
+                unsigned int refreshes = 0;
+        };
+    }  // namespace Hold
+}  // namespace UKControllerPlugin
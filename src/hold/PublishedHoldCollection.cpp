@@ -9,11 +9,63 @@ namespace UKControllerPlugin {
         */
         void PublishedHoldCollection::Add(HoldingData data)
         {
-            if (!this->holds.insert(std::move(data)).second) {
-                LogWarning("Attempted to add duplicate published hold: " + std::to_string(data.identifier));
+            unsigned int identifier = data.identifier;
+            auto inserted = this->holds.insert(std::move(data));
+            if (!inserted.second) {
+                LogWarning("Attempted to add duplicate published hold: " + std::to_string(identifier));
+                return;
+            }
+
+            const HoldingData& added = *inserted.first;
+            this->holdsById[identifier] = &added;
+
+            // The holds that the new hold is deemed separated from
+            for (const std::unique_ptr<DeemedSeparatedHold>& deemedSeparatedHold : added.deemedSeparatedHolds) {
+                auto separatedHold = this->holdsById.find(deemedSeparatedHold->identifier);
+                if (separatedHold != this->holdsById.cend()) {
+                    this->AddDeemedSeparation(
+                        added,
+                        *separatedHold->second,
+                        deemedSeparatedHold->vslInsertDistance
+                    );
+                }
+            }
+
+            // The holds that were already here and are deemed separated from the new hold
+            for (const HoldingData& hold : this->holds) {
+                if (hold == added) {
+                    continue;
+                }
+
+                for (const std::unique_ptr<DeemedSeparatedHold>& deemedSeparatedHold : hold.deemedSeparatedHolds) {
+                    if (deemedSeparatedHold->identifier == identifier) {
+                        this->AddDeemedSeparation(hold, added, deemedSeparatedHold->vslInsertDistance);
+                    }
+                }
             }
         }
 
+        /*
+            Record the levels at which a hold is deemed separated from another, those that both holds cover.
+        */
+        void PublishedHoldCollection::AddDeemedSeparation(
+            const HoldingData& hold,
+            const HoldingData& separatedHold,
+            unsigned int vslInsertDistance
+        ) {
+            if (separatedHold == this->noHold) {
+                return;
+            }
+
+            unsigned int minimum = (std::max)(hold.minimum, separatedHold.minimum);
+            unsigned int maximum = (std::min)(hold.maximum, separatedHold.maximum);
+            if (minimum > maximum) {
+                return;
+            }
+
+            this->deemedSeparation[hold.fix][separatedHold.fix].push_back({ minimum, maximum, vslInsertDistance });
+        }
+
         /*
             Get all the published holds at a fix, this is by value so shouldn't be used directly in rendering code.
         */
@@ -42,19 +94,40 @@ namespace UKControllerPlugin {
          */
         const HoldingData& PublishedHoldCollection::GetById(int id) const
         {
-            auto foundHold = std::find_if(
-                this->holds.cbegin(),
-                this->holds.cend(),
-                [&id](const HoldingData& hold) -> bool
-                {
-                    return hold.identifier == id;
+            auto foundHold = this->holdsById.find(id);
+            return foundHold != this->holdsById.cend() ? *foundHold->second : this->noHold;
+        }
+
+
+        /*
+            Get the distance beyond which an aircraft holding at the separated fix is deemed separated from one
+            holding at the fix, at the given level. Where more than one pair of holds applies, the shortest wins.
+        */
+        unsigned int PublishedHoldCollection::GetVslInsertDistance(
+            const std::string& fix,
+            const std::string& separatedFix,
+            unsigned int level
+        ) const {
+            auto holdsAtFix = this->deemedSeparation.find(fix);
+            if (holdsAtFix == this->deemedSeparation.cend()) {
+                return this->notDeemedSeparated;
+            }
+
+            auto bands = holdsAtFix->second.find(separatedFix);
+            if (bands == holdsAtFix->second.cend()) {
+                return this->notDeemedSeparated;
+            }
+
+            unsigned int distance = this->notDeemedSeparated;
+            for (const DeemedSeparationBand& band : bands->second) {
+                if (level >= band.minimum && level <= band.maximum) {
+                    distance = (std::min)(distance, band.vslInsertDistance);
                 }
-            );
+            }
 
-            return foundHold != this->holds.cend() ? *foundHold : this->noHold;
+            return distance;
         }
 
-
         /*
             Count all the published holds
         */
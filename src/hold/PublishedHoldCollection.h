@@ -1,6 +1,7 @@
 #pragma once
 #include "hold/HoldingData.h"
 #include "hold/CompareHolds.h"
+#include "hold/DeemedSeparationBand.h"
 
 namespace UKControllerPlugin {
     namespace Hold {
@@ -13,18 +14,41 @@ namespace UKControllerPlugin {
                 void Add(HoldingData data);
                 const std::set<const HoldingData*> GetForFix(std::string fix) const;
                 const HoldingData& GetById(int id) const;
+                unsigned int GetVslInsertDistance(
+                    const std::string& fix,
+                    const std::string& separatedFix,
+                    unsigned int level
+                ) const;
                 size_t Count(void) const;
 
                 // Returns the hold with no data
                 const HoldingData noHold = {};
 
+                // Returned by GetVslInsertDistance if the holds aren't deemed separated at the level
+                const unsigned int notDeemedSeparated = UINT_MAX;
+
             private:
 
+                void AddDeemedSeparation(
+                    const HoldingData& hold,
+                    const HoldingData& separatedHold,
+                    unsigned int vslInsertDistance
+                );
+
                 // Array to return if no holds are found
                 const std::set<HoldingData, CompareHolds> noHolds;
 
                 // All the published holds
                 std::set<HoldingData, CompareHolds> holds;
+
+                // The published holds by their id, so that rendering can look up deemed separated holds quickly
+                std::unordered_map<unsigned int, const HoldingData*> holdsById;
+
+                // By fix, then the fix it is deemed separated from, the levels at which the holds are separated
+                std::unordered_map<
+                    std::string,
+                    std::unordered_map<std::string, std::vector<DeemedSeparationBand>>
+                > deemedSeparation;
         };
     }  // namespace Hold
 }  // namespace UKControllerPlugin
@@ -49,8 +49,7 @@ namespace UKControllerPlugin {
 
         void ExternalMessageEventHandler::AddMessageToQueue(std::string message)
         {
-            std::lock_guard<std::mutex> lock(this->messageLock);
-            this->messages.push(message);
+            this->messages.Push(message);
         }
 
         size_t ExternalMessageEventHandler::CountHandlers(void) const
@@ -60,23 +59,20 @@ namespace UKControllerPlugin {
 
         void ExternalMessageEventHandler::TimedEventTrigger(void)
         {
-            std::lock_guard<std::mutex> lock(this->messageLock);
-
             // Process any incoming messages
-            while (this->messages.size() != 0) {
+            this->messages.Drain([this](std::string message) {
                 for (
                     auto handlerIt = this->eventHandlers.cbegin();
                     handlerIt != this->eventHandlers.cend();
                     ++handlerIt
                 ) {
-                    if ((*handlerIt)->ProcessMessage(this->messages.front())) {
+                    if ((*handlerIt)->ProcessMessage(message)) {
                         break;
                     }
 
                 }
-                LogWarning("Unable to handle external message: " + this->messages.front());
-                this->messages.pop();
-            }
+                LogWarning("Unable to handle external message: " + message);
+            });
         }
 
         bool ExternalMessageEventHandler::ProcessCommand(std::string command)
@@ -3,6 +3,7 @@
 #include "integration/HiddenWindow.h"
 #include "integration/ExternalMessageHandlerInterface.h"
 #include "command/CommandHandlerInterface.h"
+#include "task/LockFreeQueue.h"
 
 namespace UKControllerPlugin {
     namespace Integration {
@@ -33,11 +34,8 @@ namespace UKControllerPlugin {
                     std::shared_ptr<UKControllerPlugin::Integration::ExternalMessageHandlerInterface>
                 > eventHandlers;
 
-                // Lock for the message queue
-                std::mutex messageLock;
-
-                // Internal message quque
-                std::queue<std::string> messages;
+                // Internal message queue
+                UKControllerPlugin::TaskManager::LockFreeQueue<std::string> messages;
 
                 // The hidden window handle
                 HWND hiddenWindow = NULL;
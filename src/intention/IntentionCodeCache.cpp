@@ -9,21 +9,23 @@ namespace UKControllerPlugin {
     namespace IntentionCode {
 
         /*
-            Gets an intention code for a given aircraft.
+            Gets an intention code for a given aircraft. The reference is valid until the aircraft
+            is unregistered or the cache is cleared.
         */
-        std::string IntentionCodeCache::GetIntentionCodeForAircraft(std::string callsign) const
+        const std::string & IntentionCodeCache::GetIntentionCodeForAircraft(const std::string & callsign) const
         {
-            if (this->intentionCodeMap.count(callsign) == 0) {
-                return "--";
+            auto code = this->intentionCodeMap.find(callsign);
+            if (code == this->intentionCodeMap.cend()) {
+                return this->defaultCode;
             }
 
-            return this->intentionCodeMap.at(callsign).intentionCode;
+            return code->second.intentionCode;
         }
 
         /*
             Returns true or false depending on whether we have an intention code cached.
         */
-        bool IntentionCodeCache::HasIntentionCodeForAircraft(std::string callsign) const
+        bool IntentionCodeCache::HasIntentionCodeForAircraft(const std::string & callsign) const
         {
             return this->intentionCodeMap.count(callsign) > 0;
         }
@@ -36,24 +38,26 @@ namespace UKControllerPlugin {
         /*
             Returns true if the intention code is still valid.
         */
-        bool IntentionCodeCache::IntentionCodeValid(std::string callsign, EuroscopeExtractedRouteInterface & route)
-        {
-            if (!this->HasIntentionCodeForAircraft(callsign)) {
+        bool IntentionCodeCache::IntentionCodeValid(
+            const std::string & callsign,
+            EuroscopeExtractedRouteInterface & route
+        ) const {
+            auto cached = this->intentionCodeMap.find(callsign);
+            if (cached == this->intentionCodeMap.cend()) {
                 return false;
             }
 
             // If they don't have an exit point, or they're cleared direct beyond it but aren't yet close.
-            if (this->intentionCodeMap[callsign].exitPointValid == false ||
-                (route.GetPointsAssignedIndex() > this->intentionCodeMap[callsign].exitPointIndex &&
-                    route.GetPointsCalculatedIndex() <= this->intentionCodeMap[callsign].exitPointIndex)
+            const IntentionCodeData & code = cached->second;
+            if (code.exitPointValid == false ||
+                (route.GetPointsAssignedIndex() > code.exitPointIndex &&
+                    route.GetPointsCalculatedIndex() <= code.exitPointIndex)
                 ) {
                 return true;
             }
 
             // If they've passed their exit point, then the intention code is no longer valid.
-            if (route.GetPointDistanceInMinutes(
-                this->intentionCodeMap[callsign].exitPointIndex) == this->exitPointPassed
-            ) {
+            if (route.GetPointDistanceInMinutes(code.exitPointIndex) == this->exitPointPassed) {
                 return false;
             }
 
@@ -63,7 +67,7 @@ namespace UKControllerPlugin {
         /*
             Registers an aircraft with the cache.
         */
-        void IntentionCodeCache::RegisterAircraft(std::string callsign, IntentionCodeData intentionCode)
+        void IntentionCodeCache::RegisterAircraft(const std::string & callsign, IntentionCodeData intentionCode)
         {
             if (this->intentionCodeMap.count(callsign) != 0) {
                 return;
@@ -83,7 +87,7 @@ namespace UKControllerPlugin {
         /*
             Unregisters an aircraft with the intention code cache.
         */
-        void IntentionCodeCache::UnregisterAircraft(std::string callsign)
+        void IntentionCodeCache::UnregisterAircraft(const std::string & callsign)
         {
             if (this->intentionCodeMap.count(callsign) == 0) {
                 return;
@@ -21,14 +21,17 @@ namespace UKControllerPlugin {
             public:
                 void Clear(void);
                 bool IntentionCodeValid(
-                    std::string callsign,
+                    const std::string & callsign,
                     UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface & route
+                ) const;
+                const std::string & GetIntentionCodeForAircraft(const std::string & callsign) const;
+                bool HasIntentionCodeForAircraft(const std::string & callsign) const;
+                void RegisterAircraft(
+                    const std::string & callsign,
+                    UKControllerPlugin::IntentionCode::IntentionCodeData
                 );
-                std::string GetIntentionCodeForAircraft(std::string callsign) const;
-                bool HasIntentionCodeForAircraft(std::string callsign) const;
-                void RegisterAircraft(std::string callsign, UKControllerPlugin::IntentionCode::IntentionCodeData);
                 size_t TotalCached(void) const;
-                void UnregisterAircraft(std::string callsign);
+                void UnregisterAircraft(const std::string & callsign);
 
                 // The default intention code if we cant resolve something better
                 const std::string defaultCode = "--";
@@ -5,6 +5,7 @@
 #include "intention/IntentionCodeData.h"
 #include "euroscope/EuroscopeExtractedRouteInterface.h"
 #include "euroscope/EuroScopeCControllerInterface.h"
+#include "flightplan/StoredFlightplan.h"
 
 using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
@@ -12,6 +13,7 @@ using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::IntentionCode::IntentionCodeCache;
 using UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCControllerInterface;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Tag::TagData;
 
 namespace UKControllerPlugin {
@@ -45,6 +47,15 @@ namespace UKControllerPlugin {
             this->codeCache.UnregisterAircraft(flightPlan.GetCallsign());
         }
 
+        /*
+            Intention codes are generated from the airports, the route and the cruise level.
+        */
+        unsigned int IntentionCodeEventHandler::GetFlightplanFieldDependencies(void) const
+        {
+            return StoredFlightplan::originChanged | StoredFlightplan::destinationChanged |
+                StoredFlightplan::routeChanged | StoredFlightplan::cruiseLevelChanged;
+        }
+
         /*
             Respond to flightplans disconnecting - invalidate the intention code cache.
         */
@@ -67,27 +78,23 @@ namespace UKControllerPlugin {
         void IntentionCodeEventHandler::SetTagItemData(TagData& tagData)
         {
             // If we have it cached, then use the cached value
+            std::string callsign = tagData.flightPlan.GetCallsign();
             EuroscopeExtractedRouteInterface extractedRoute = tagData.flightPlan.GetExtractedRoute();
-            if (
-                this->codeCache.HasIntentionCodeForAircraft(tagData.flightPlan.GetCallsign()) &&
-                this->codeCache.IntentionCodeValid(tagData.flightPlan.GetCallsign(), extractedRoute)
-            ) {
-                tagData.SetItemString(
-                    this->codeCache.GetIntentionCodeForAircraft(tagData.flightPlan.GetCallsign())
-                );
+            if (this->codeCache.IntentionCodeValid(callsign, extractedRoute)) {
+                tagData.SetItemString(this->codeCache.GetIntentionCodeForAircraft(callsign));
                 return;
             }
 
             // Generate the code and then cache it
             IntentionCodeData data = this->intention.GetIntentionCodeForFlightplan(
-                tagData.flightPlan.GetCallsign(),
+                callsign,
                 tagData.flightPlan.GetOrigin(),
                 tagData.flightPlan.GetDestination(),
                 extractedRoute,
                 tagData.flightPlan.GetCruiseLevel()
             );
 
-            this->codeCache.RegisterAircraft(tagData.flightPlan.GetCallsign(), data);
+            this->codeCache.RegisterAircraft(callsign, data);
             tagData.SetItemString(data.intentionCode);
         }
 
@@ -42,6 +42,7 @@ namespace UKControllerPlugin {
                 void FlightPlanDisconnectEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
                 );
+                unsigned int GetFlightplanFieldDependencies(void) const override;
                 std::string GetTagItemDescription(int tagItemId) const override;
                 void SetTagItemData(UKControllerPlugin::Tag::TagData& tagData) override;
 
@@ -1,5 +1,8 @@
 #include "pch/stdafx.h"
 #include "metar/MetarParsingFunctions.h"
+#include "helper/StringScanners.h"
+
+using UKControllerPlugin::Helper::ScanQnh;
 
 namespace UKControllerPlugin {
     namespace Metar {
@@ -11,14 +14,8 @@ namespace UKControllerPlugin {
         */
         std::string GetQnhString(std::string metar)
         {
-            std::regex qnhPattern(" Q([0-9]{4})( |$)");
-            std::smatch qnhMatch;
-
-            if (!std::regex_search(metar, qnhMatch, qnhPattern)) {
-                return noQnh;
-            }
-
-            return qnhMatch[1];
+            std::string qnh = ScanQnh(metar);
+            return qnh.empty() ? noQnh : qnh;
         }
     }  // namespace Metar
 }  // namespace UKControllerPlugin
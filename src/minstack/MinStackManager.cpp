@@ -1,10 +1,10 @@
 #include "pch/stdafx.h"
 #include "minstack/MinStackManager.h"
-#include "helper/HelperFunctions.h"
+#include "helper/StringScanners.h"
 #include "task/TaskRunner.h"
 
 using UKControllerPlugin::TaskManager::TaskRunnerInterface;
-using UKControllerPlugin::HelperFunctions;
+using UKControllerPlugin::Helper::ScanQnh;
 using UKControllerPlugin::Websocket::WebsocketSubscription;
 using UKControllerPlugin::Websocket::WebsocketMessage;
 
@@ -104,22 +104,12 @@ namespace UKControllerPlugin {
         }
 
         /*
-            When we receive a new metar, process it in tokens until we get the QNH.
+            When we receive a new metar, pick out the QNH.
         */
         int MinStackManager::ProcessMetar(std::string metar)
         {
-            std::istringstream buf(metar);
-            std::istream_iterator<std::string> beg(buf), end;
-            std::vector<std::string> tokens(beg, end);
-
-            for each (std::string token in tokens)
-            {
-                if (token[0] == 'Q' && HelperFunctions::IsAnInteger(token.substr(1))) {
-                    return std::stoi(token.substr(1));
-                }
-            }
-
-            return 0;
+            std::string qnh = ScanQnh(metar);
+            return qnh.empty() ? 0 : std::stoi(qnh);
         }
 
         /*
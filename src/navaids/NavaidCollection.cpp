@@ -6,9 +6,17 @@ namespace UKControllerPlugin {
 
         void NavaidCollection::AddNavaid(Navaid navaid)
         {
-            if (!this->navaids.insert(navaid).second) {
+            auto inserted = this->navaids.insert(navaid);
+            if (!inserted.second) {
                 LogWarning("Duplicate navaid detected, skipping: " + navaid.identifier);
+                return;
             }
+
+            const Navaid & added = *inserted.first;
+            this->grid[this->GridKey(
+                this->GridCell(added.coordinates.m_Latitude),
+                this->GridCell(added.coordinates.m_Longitude)
+            )].push_back(&added);
         }
 
         size_t NavaidCollection::Count(void) const
@@ -16,11 +24,66 @@ namespace UKControllerPlugin {
             return this->navaids.size();
         }
 
+        /*
+            Finds all the navaids within a given distance (in nautical miles) of a position, replacing the
+            contents of found. Only the grid cells that could contain a navaid in range are checked.
+
+            A degree of longitude shrinks as we head north, so the number of cells to check either side is
+            worked out at the latitude furthest from the equator that we could be looking at.
+        */
+        void NavaidCollection::FindWithinDistance(
+            const EuroScopePlugIn::CPosition & position,
+            double distance,
+            std::vector<const Navaid *> & found
+        ) const {
+            found.clear();
+            if (this->navaids.empty()) {
+                return;
+            }
+
+            double latitudeSpan = distance / 60.0;
+            double furthestLatitude = (std::min)(std::abs(position.m_Latitude) + latitudeSpan, 89.0);
+            double longitudeSpan = (std::min)(
+                distance / (60.0 * std::cos(furthestLatitude * this->radiansPerDegree)),
+                180.0
+            );
+
+            int minLatitudeCell = this->GridCell(position.m_Latitude - latitudeSpan);
+            int maxLatitudeCell = this->GridCell(position.m_Latitude + latitudeSpan);
+            int minLongitudeCell = this->GridCell(position.m_Longitude - longitudeSpan);
+            int maxLongitudeCell = this->GridCell(position.m_Longitude + longitudeSpan);
+
+            for (int latitudeCell = minLatitudeCell; latitudeCell <= maxLatitudeCell; latitudeCell++) {
+                for (int longitudeCell = minLongitudeCell; longitudeCell <= maxLongitudeCell; longitudeCell++) {
+                    auto cell = this->grid.find(this->GridKey(latitudeCell, longitudeCell));
+                    if (cell == this->grid.cend()) {
+                        continue;
+                    }
+
+                    for (const Navaid * navaid : cell->second) {
+                        if (position.DistanceTo(navaid->coordinates) <= distance) {
+                            found.push_back(navaid);
+                        }
+                    }
+                }
+            }
+        }
+
         const Navaid& NavaidCollection::GetByIdentifier(std::string identifier) const
         {
             auto navaid = this->navaids.find(identifier);
             return navaid == this->navaids.cend() ? this->invalidNavaid : *navaid;
         }
 
+        int NavaidCollection::GridCell(double degrees) const
+        {
+            return static_cast<int>(std::floor(degrees / this->gridCellSize));
+        }
+
+        int64_t NavaidCollection::GridKey(int latitudeCell, int longitudeCell) const
+        {
+            return (static_cast<int64_t>(latitudeCell) << 32) | static_cast<uint32_t>(longitudeCell);
+        }
+
     }  // namespace Navaids
 }  // namespace UKControllerPlugin
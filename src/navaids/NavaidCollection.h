@@ -7,12 +7,23 @@ namespace UKControllerPlugin {
 
         /*
             A collection of all the navaids.
+
+            The spatial grid points into the collection's own set of navaids, so the collection
+            cannot be copied.
         */
         class NavaidCollection
         {
             public:
+                NavaidCollection(void) = default;
+                NavaidCollection(const NavaidCollection &) = delete;
+                NavaidCollection & operator=(const NavaidCollection &) = delete;
                 void AddNavaid(Navaid navaid);
                 size_t Count(void) const;
+                void FindWithinDistance(
+                    const EuroScopePlugIn::CPosition & position,
+                    double distance,
+                    std::vector<const UKControllerPlugin::Navaids::Navaid *> & found
+                ) const;
                 const UKControllerPlugin::Navaids::Navaid& GetByIdentifier(std::string identifier) const;
 
                 const Navaid invalidNavaid = { 0, "INVALID" };
@@ -22,9 +33,21 @@ namespace UKControllerPlugin {
                 const_iterator cbegin() const { return navaids.cbegin(); }
                 const_iterator cend() const { return navaids.cend(); }
 
+                // The size of each spatial index cell, in degrees of latitude and longitude
+                const double gridCellSize = 0.2;
+
             private:
+
+                int GridCell(double degrees) const;
+                int64_t GridKey(int latitudeCell, int longitudeCell) const;
+
+                const double radiansPerDegree = 0.017453292519943295;
+
                 // All the navaids
                 NavaidList navaids;
+
+                // Navaids bucketed into a grid of latitude and longitude, so we only check those that are nearby
+                std::unordered_map<int64_t, std::vector<const UKControllerPlugin::Navaids::Navaid *>> grid;
         };
     }  // namespace Navaids
 }  // namespace UKControllerPlugin
@@ -81,7 +81,7 @@ namespace UKControllerPlugin {
             tagData.SetItemString(
                 offBlock == (std::chrono::system_clock::time_point::max)()
                     ? this->displayTime.GetUnknownTimeFormat()
-                    : this->displayTime.FromTimePoint(offBlock)
+                    : this->displayTime.GetTimeString(offBlock)
             );
         }
     }  // namespace Datablock
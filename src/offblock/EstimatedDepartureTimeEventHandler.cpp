@@ -8,6 +8,7 @@
 #include "helper/HelperFunctions.h"
 
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::HelperFunctions;
@@ -47,7 +48,7 @@ void EstimatedDepartureTimeEventHandler::SetTagItemData(TagData& tagData)
         return;
     }
 
-    tagData.SetItemString(this->displayTime.FromTimePoint(edt));
+    tagData.SetItemString(this->displayTime.GetTimeString(edt));
 }
 
 /*
@@ -66,6 +67,14 @@ void EstimatedDepartureTimeEventHandler::FlightPlanEvent(
         .SetEstimatedDepartureTime(HelperFunctions::GetTimeFromNumberString(flightPlan.GetExpectedDepartureTime()));
 }
 
+/*
+    The EDT only needs working out again when the expected departure time changes.
+*/
+unsigned int EstimatedDepartureTimeEventHandler::GetFlightplanFieldDependencies(void) const
+{
+    return StoredFlightplan::expectedOffBlockTimeChanged;
+}
+
 /*
     Nothing to do here
 */
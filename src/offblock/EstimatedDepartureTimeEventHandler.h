@@ -35,6 +35,7 @@ class EstimatedDepartureTimeEventHandler : public UKControllerPlugin::Tag::TagIt
         void ControllerFlightPlanDataEvent(
             UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan, int dataType
         ) override;
+        unsigned int GetFlightplanFieldDependencies(void) const override;
         std::string GetTagItemDescription(int tagItemId) const override;
         void SetTagItemData(UKControllerPlugin::Tag::TagData& tagData) override;
 
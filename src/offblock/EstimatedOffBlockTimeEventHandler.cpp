@@ -42,7 +42,7 @@ void EstimatedOffBlockTimeEventHandler::SetTagItemData(TagData& tagData)
         return;
     }
 
-    tagData.SetItemString(this->displayTime.FromTimePoint(eobt));
+    tagData.SetItemString(this->displayTime.GetTimeString(eobt));
 }
 
 }  // namespace Datablock
@@ -10,6 +10,7 @@
 #include "message/UserMessager.h"
 #include "ownership/AirfieldOwnerQueryMessage.h"
 #include "ownership/AirfieldsOwnedQueryMessage.h"
+#include "helper/StringScanners.h"
 
 using UKControllerPlugin::Airfield::AirfieldCollection;
 using UKControllerPlugin::Ownership::AirfieldOwnershipManager;
@@ -22,6 +23,9 @@ using UKControllerPlugin::Euroscope::EuroScopeCControllerInterface;
 using UKControllerPlugin::Message::UserMessager;
 using UKControllerPlugin::Ownership::AirfieldOwnerQueryMessage;
 using UKControllerPlugin::Ownership::AirfieldsOwnedQueryMessage;
+using UKControllerPlugin::Helper::IsAsciiLetter;
+using UKControllerPlugin::Helper::IsCallsignCharacter;
+using UKControllerPlugin::Helper::ScanCommandArgument;
 
 namespace UKControllerPlugin {
     namespace Ownership {
@@ -37,14 +41,11 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Loops through each of the airfields in the topdown order and refresh who owns them.
+            Refresh who owns the airfields that the position is in the ownership order of.
         */
         void AirfieldOwnershipHandler::ProcessAffectedAirfields(const ControllerPosition & controller)
         {
-            std::vector<std::string> topDown = controller.GetTopdown();
-            for (std::vector<std::string>::iterator it = topDown.begin(); it != topDown.end(); ++it) {
-                this->airfieldOwnership.RefreshOwner(*it);
-            }
+            this->airfieldOwnership.RefreshOwnersForPosition(controller);
         }
 
         void AirfieldOwnershipHandler::ActiveCallsignAdded(const ActiveCallsign& callsign, bool userCallsign)
@@ -69,24 +70,27 @@ namespace UKControllerPlugin {
         */
         bool AirfieldOwnershipHandler::ProcessCommand(std::string command)
         {
-            std::regex ownerRegex(".ukcp owner ([A-Za-z]{4})");
-            std::smatch ownerMatches;
-            if (std::regex_search(command, ownerMatches, ownerRegex)) {
-                ActiveCallsign active = this->airfieldOwnership.GetOwner(ownerMatches[1]);
+            std::string airfield = ScanCommandArgument(command, ".ukcp owner ", IsAsciiLetter, 4);
+            if (airfield.size() == 4) {
+                ActiveCallsign active = this->airfieldOwnership.GetOwner(airfield);
                 this->userMessager.SendMessageToUser(AirfieldOwnerQueryMessage(
-                    ownerMatches[1],
+                    airfield,
                     active.GetCallsign(),
                     active.GetControllerName()
                 ));
                 return true;
             }
 
-            std::regex ownedRegex(".ukcp owned ([A-Za-z0-9_-]+)");
-            std::smatch ownedMatches;
-            if (std::regex_search(command, ownedMatches, ownedRegex)) {
+            std::string callsign = ScanCommandArgument(
+                command,
+                ".ukcp owned ",
+                IsCallsignCharacter,
+                std::string::npos
+            );
+            if (!callsign.empty()) {
                 this->userMessager.SendMessageToUser(AirfieldsOwnedQueryMessage(
-                    this->airfieldOwnership.GetOwnedAirfields(ownedMatches[1]),
-                    ownedMatches[1]
+                    this->airfieldOwnership.GetOwnedAirfields(callsign),
+                    callsign
                 ));
                 return true;
             }
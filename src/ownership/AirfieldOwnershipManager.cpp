@@ -57,6 +57,8 @@ namespace UKControllerPlugin {
         void AirfieldOwnershipManager::Flush(void)
         {
             this->ownershipMap.clear();
+            this->ownedAirfields.clear();
+            this->positionActive.assign(this->positionActive.size(), false);
         }
 
         /*
@@ -78,17 +80,15 @@ namespace UKControllerPlugin {
         {
             std::vector<AirfieldModel> ownedAirfields;
 
-            if (!this->activeCallsigns.CallsignActive(callsign)) {
+            std::map<std::string, std::set<std::string>>::const_iterator owned = this->ownedAirfields.find(callsign);
+            if (owned == this->ownedAirfields.cend() || !this->activeCallsigns.CallsignActive(callsign)) {
                 return ownedAirfields;
             }
 
-            for (
-                std::map<std::string, std::unique_ptr<ActiveCallsign>>::const_iterator it = this->ownershipMap.cbegin();
-                it != this->ownershipMap.cend();
-                ++it
-            ) {
-                if (*it->second == this->activeCallsigns.GetCallsign(callsign)) {
-                    ownedAirfields.push_back(this->airfields.FetchAirfieldByIcao(it->first));
+            const ActiveCallsign activeCallsign = this->activeCallsigns.GetCallsign(callsign);
+            for (const std::string & icao : owned->second) {
+                if (*this->ownershipMap.find(icao)->second == activeCallsign) {
+                    ownedAirfields.push_back(this->airfields.FetchAirfieldByIcao(icao));
                 }
             }
 
@@ -100,44 +100,162 @@ namespace UKControllerPlugin {
         */
         void AirfieldOwnershipManager::RefreshOwner(std::string icao)
         {
-            std::vector<std::string> topdownOrder;
-            try {
-                topdownOrder = this->airfields.FetchAirfieldByIcao(icao).GetOwnershipPresedence();
-            }
-            catch (std::out_of_range) {
+            this->BuildIndexIfNeeded();
+            std::unordered_map<std::string, size_t>::const_iterator airfield = this->airfieldIds.find(icao);
+            if (airfield == this->airfieldIds.cend()) {
                 // Nothing we can do if we can't find the airfield.
                 return;
             }
 
-            // Loop through the topdown order
-            for (std::vector<std::string>::iterator it = topdownOrder.begin(); it != topdownOrder.end(); ++it) {
+            for (size_t position : this->airfieldOwnershipOrders[airfield->second]) {
+                this->positionActive[position] = this->activeCallsigns.PositionActive(
+                    this->positionCallsigns[position]
+                );
+            }
+
+            this->UpdateOwner(airfield->second);
+        }
+
+        /*
+            A position has gained or lost a controller, so update the owners of the airfields that
+            it appears in the ownership order of, or has in its topdown.
+        */
+        void AirfieldOwnershipManager::RefreshOwnersForPosition(const ControllerPosition & position)
+        {
+            this->BuildIndexIfNeeded();
+            size_t positionId = this->GetPositionId(position.GetCallsign());
+
+            // The first time we see a position, add its topdown airfields to the index
+            if (!this->positionTopdownIndexed[positionId]) {
+                for (const std::string & icao : position.GetTopdown()) {
+                    std::unordered_map<std::string, size_t>::const_iterator airfield = this->airfieldIds.find(icao);
+                    if (airfield != this->airfieldIds.cend()) {
+                        this->IndexAirfieldForPosition(positionId, airfield->second);
+                    }
+                }
+                this->positionTopdownIndexed[positionId] = true;
+            }
+
+            this->positionActive[positionId] = this->activeCallsigns.PositionActive(
+                this->positionCallsigns[positionId]
+            );
+
+            for (size_t airfield : this->airfieldsByPosition[positionId]) {
+                this->UpdateOwner(airfield);
+            }
+        }
+
+        /*
+            Give every position in the airfields' ownership orders an ID, and index which airfields
+            each position is in. Only done when the airfields have changed.
+        */
+        void AirfieldOwnershipManager::BuildIndexIfNeeded(void)
+        {
+            if (this->airfields.GetSize() == this->indexedAirfieldCount) {
+                return;
+            }
+
+            this->positionIds.clear();
+            this->positionCallsigns.clear();
+            this->positionActive.clear();
+            this->positionTopdownIndexed.clear();
+            this->airfieldsByPosition.clear();
+            this->airfieldIds.clear();
+            this->airfieldIcaos.clear();
+            this->airfieldOwnershipOrders.clear();
+
+            for (
+                AirfieldCollection::const_iterator airfield = this->airfields.cbegin();
+                airfield != this->airfields.cend();
+                ++airfield
+            ) {
+                size_t airfieldId = this->airfieldIcaos.size();
+                this->airfieldIds[airfield->first] = airfieldId;
+                this->airfieldIcaos.push_back(airfield->first);
+                this->airfieldOwnershipOrders.push_back({});
+
+                for (const std::string & position : airfield->second->GetOwnershipPresedence()) {
+                    size_t positionId = this->GetPositionId(position);
+                    this->airfieldOwnershipOrders[airfieldId].push_back(positionId);
+                    this->IndexAirfieldForPosition(positionId, airfieldId);
+                }
+            }
+
+            this->indexedAirfieldCount = this->airfields.GetSize();
+        }
+
+        /*
+            Returns the ID of a position, giving it one if it doesn't have one yet.
+        */
+        size_t AirfieldOwnershipManager::GetPositionId(const std::string & callsign)
+        {
+            std::unordered_map<std::string, size_t>::const_iterator positionId = this->positionIds.find(callsign);
+            if (positionId != this->positionIds.cend()) {
+                return positionId->second;
+            }
+
+            this->positionIds[callsign] = this->positionCallsigns.size();
+            this->positionCallsigns.push_back(callsign);
+            this->positionActive.push_back(this->activeCallsigns.PositionActive(callsign));
+            this->positionTopdownIndexed.push_back(false);
+            this->airfieldsByPosition.push_back({});
+            return this->positionCallsigns.size() - 1;
+        }
+
+        /*
+            Record that changes to a position affect an airfield.
+        */
+        void AirfieldOwnershipManager::IndexAirfieldForPosition(size_t position, size_t airfield)
+        {
+            std::vector<size_t> & affectedAirfields = this->airfieldsByPosition[position];
+            if (std::find(affectedAirfields.cbegin(), affectedAirfields.cend(), airfield) == affectedAirfields.cend()) {
+                affectedAirfields.push_back(airfield);
+            }
+        }
+
+        /*
+            Walk the airfield's ownership order and hand it to the first active position, or
+            to nobody if none are active.
+        */
+        void AirfieldOwnershipManager::UpdateOwner(size_t airfield)
+        {
+            const std::string & icao = this->airfieldIcaos[airfield];
+            std::map<std::string, std::unique_ptr<ActiveCallsign>>::iterator currentOwner =
+                this->ownershipMap.find(icao);
+
+            for (size_t position : this->airfieldOwnershipOrders[airfield]) {
 
                 // If nobody is covering the position, don't count it, otherwise, take the lead callsign
-                if (!this->activeCallsigns.PositionActive(*it)) {
+                if (!this->positionActive[position]) {
                     continue;
                 }
 
-                // Only log when positions have changed hands
-                bool needsLog = this->ownershipMap.count(icao) == 0 ||
-                    this->ownershipMap.at(icao)->GetCallsign() !=
-                    this->activeCallsigns.GetLeadCallsignForPosition(*it).GetCallsign();
-
-                this->ownershipMap[icao] = std::make_unique<ActiveCallsign>(
-                    this->activeCallsigns.GetLeadCallsignForPosition(*it)
+                ActiveCallsign newOwner = this->activeCallsigns.GetLeadCallsignForPosition(
+                    this->positionCallsigns[position]
                 );
 
-                if (needsLog) {
-                    LogInfo(
-                        "Airfield " + icao + " is now managed by " +
-                        this->ownershipMap.find(icao)->second->GetCallsign()
-                    );
+                // Only log when positions have changed hands
+                if (currentOwner != this->ownershipMap.end()) {
+                    if (currentOwner->second->GetCallsign() == newOwner.GetCallsign()) {
+                        currentOwner->second = std::make_unique<ActiveCallsign>(newOwner);
+                        return;
+                    }
+
+                    this->ownedAirfields[currentOwner->second->GetCallsign()].erase(icao);
                 }
+
+                this->ownedAirfields[newOwner.GetCallsign()].insert(icao);
+                this->ownershipMap[icao] = std::make_unique<ActiveCallsign>(newOwner);
+                LogInfo("Airfield " + icao + " is now managed by " + newOwner.GetCallsign());
                 return;
             }
 
             // We can't find an owner, so set no owner.
-            LogInfo("Airfield " + icao + " is no longer managed by any controller");
-            this->ownershipMap.erase(icao);
+            if (currentOwner != this->ownershipMap.end()) {
+                this->ownedAirfields[currentOwner->second->GetCallsign()].erase(icao);
+                this->ownershipMap.erase(currentOwner);
+                LogInfo("Airfield " + icao + " is no longer managed by any controller");
+            }
         }
     }  // namespace Ownership
 }  // namespace UKControllerPlugin
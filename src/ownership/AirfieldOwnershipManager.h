@@ -13,6 +13,10 @@ namespace UKControllerPlugin {
             to determine whether or not the client should be setting initial altitudes or
             requesting squawks. Naturally, there are server side checks for this too,
             but nobody likes a hammered server.
+
+            To keep up with controllers coming and going, each position is given an integer ID and indexed
+            to the airfields that it affects: those it appears in the ownership order of, and those in its
+            topdown. When a position changes, only those airfields are looked at again.
         */
         class AirfieldOwnershipManager
         {
@@ -31,12 +35,18 @@ namespace UKControllerPlugin {
                 const UKControllerPlugin::Controller::ActiveCallsign & GetOwner(std::string icao) const;
                 std::vector<UKControllerPlugin::Airfield::AirfieldModel> GetOwnedAirfields(std::string callsign) const;
                 void RefreshOwner(std::string icao);
+                void RefreshOwnersForPosition(const UKControllerPlugin::Controller::ControllerPosition & position);
 
                 // A callsign to return when a lookup is done but the callsign cant be found
                 const UKControllerPlugin::Controller::ActiveCallsign notFoundCallsign;
 
             private:
 
+                void BuildIndexIfNeeded(void);
+                size_t GetPositionId(const std::string & callsign);
+                void IndexAirfieldForPosition(size_t position, size_t airfield);
+                void UpdateOwner(size_t airfield);
+
                 // A controller position to return when a lookup is done but the callsign cant be found
                 const UKControllerPlugin::Controller::ControllerPosition notFoundControllerPosition;
 
@@ -48,6 +58,29 @@ namespace UKControllerPlugin {
 
                 // Map of callsign to ownership
                 std::map<std::string, std::unique_ptr<UKControllerPlugin::Controller::ActiveCallsign>> ownershipMap;
+
+                // Map of owning callsign to the airfields it owns
+                std::map<std::string, std::set<std::string>> ownedAirfields;
+
+                // How many airfields there were when the index was built, if this changes we rebuild
+                size_t indexedAirfieldCount = 0;
+
+                // Position ID for each normalised position callsign
+                std::unordered_map<std::string, size_t> positionIds;
+
+                // Normalised callsign, whether it is active, whether its topdown has been indexed and the
+                // airfields that it affects, by position ID
+                std::vector<std::string> positionCallsigns;
+                std::vector<bool> positionActive;
+                std::vector<bool> positionTopdownIndexed;
+                std::vector<std::vector<size_t>> airfieldsByPosition;
+
+                // Airfield ID for each ICAO
+                std::unordered_map<std::string, size_t> airfieldIds;
+
+                // ICAO and ownership order as position IDs, by airfield ID
+                std::vector<std::string> airfieldIcaos;
+                std::vector<std::vector<size_t>> airfieldOwnershipOrders;
         };
     }  // namespace Ownership
 }  // namespace UKControllerPlugin
@@ -33,8 +33,11 @@
 #include <shtypes.h>
 #include <filesystem>
 #include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <string>
+#include <string_view>
 #include <tchar.h>
 #include <map>
 #include <mutex>
@@ -52,10 +55,13 @@
 #include <gdiplustypes.h>
 #include <gdiplusenums.h>
 #include <thread>
+#include <future>
+#include <atomic>
 #include <regex>
 #include <type_traits>
 #include <gdipluspixelformats.h>
 #include <unordered_set>
+#include <unordered_map>
 #include <codecvt>
 #include <locale>
 #include <Shobjidl.h>
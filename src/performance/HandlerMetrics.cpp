@@ -0,0 +1,126 @@
+#include "pch/stdafx.h"
+#include "performance/HandlerMetrics.h"
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        HandlerMetrics::HandlerMetrics(std::string name)
+            : name(name), histogram(histogramBuckets, 0)
+        {
+
+        }
+
+        /*
+            Returns the histogram bucket that a call of the given duration falls into.
+        */
+        size_t HandlerMetrics::BucketForDuration(std::chrono::nanoseconds duration)
+        {
+            long long microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+            size_t bucket = 0;
+            while (microseconds > 0 && bucket < histogramBuckets - 1) {
+                microseconds >>= 1;
+                bucket++;
+            }
+
+            return bucket;
+        }
+
+        /*
+            Returns the duration below which all calls in a given bucket took.
+        */
+        std::chrono::nanoseconds HandlerMetrics::BucketUpperBound(size_t bucket)
+        {
+            return std::chrono::microseconds(1LL << bucket);
+        }
+
+        unsigned long long HandlerMetrics::CountCalls(void) const
+        {
+            return this->calls;
+        }
+
+        std::chrono::nanoseconds HandlerMetrics::GetAverageTime(void) const
+        {
+            return this->calls == 0
+                ? std::chrono::nanoseconds::zero()
+                : std::chrono::nanoseconds(this->totalTime.count() / static_cast<long long>(this->calls));
+        }
+
+        const std::vector<unsigned long long> & HandlerMetrics::GetHistogram(void) const
+        {
+            return this->histogram;
+        }
+
+        std::chrono::nanoseconds HandlerMetrics::GetMaxTime(void) const
+        {
+            return this->maxTime;
+        }
+
+        std::string HandlerMetrics::GetName(void) const
+        {
+            return this->name;
+        }
+
+        /*
+            Returns the duration that the given percentile (0 - 1) of calls completed within, to
+            the resolution of the histogram. Calls in the final bucket are bounded by the slowest call.
+        */
+        std::chrono::nanoseconds HandlerMetrics::GetPercentileUpperBound(double percentile) const
+        {
+            if (this->calls == 0) {
+                return std::chrono::nanoseconds::zero();
+            }
+
+            unsigned long long target = static_cast<unsigned long long>(std::ceil(percentile * this->calls));
+            unsigned long long seen = 0;
+            for (size_t bucket = 0; bucket < histogramBuckets - 1; bucket++) {
+                seen += this->histogram[bucket];
+                if (seen >= target) {
+                    return (std::min)(BucketUpperBound(bucket), this->maxTime);
+                }
+            }
+
+            return this->maxTime;
+        }
+
+        /*
+            A single line summary of the metrics, for logging and displaying to the user.
+        */
+        std::string HandlerMetrics::GetSummary(void) const
+        {
+            std::stringstream summary;
+            summary << this->name << ": " << this->calls << " calls, "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(this->totalTime).count() << "ms total, "
+                << std::chrono::duration_cast<std::chrono::microseconds>(this->GetAverageTime()).count()
+                << "us avg, "
+                << std::chrono::duration_cast<std::chrono::microseconds>(this->GetPercentileUpperBound(0.99)).count()
+                << "us p99, "
+                << std::chrono::duration_cast<std::chrono::microseconds>(this->maxTime).count() << "us max";
+
+            return summary.str();
+        }
+
+        std::chrono::nanoseconds HandlerMetrics::GetTotalTime(void) const
+        {
+            return this->totalTime;
+        }
+
+        /*
+            Record a call to the handler.
+        */
+        void HandlerMetrics::Record(std::chrono::nanoseconds duration)
+        {
+            this->calls++;
+            this->totalTime += duration;
+            this->maxTime = (std::max)(this->maxTime, duration);
+            this->histogram[BucketForDuration(duration)]++;
+        }
+
+        void HandlerMetrics::Reset(void)
+        {
+            this->calls = 0;
+            this->totalTime = std::chrono::nanoseconds::zero();
+            this->maxTime = std::chrono::nanoseconds::zero();
+            std::fill(this->histogram.begin(), this->histogram.end(), 0);
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -0,0 +1,52 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        /*
+            Cheap counters for a single event handler or tag item - how many times it has been
+            called, how long it has taken in total, its slowest call and a log-scale histogram
+            of call durations.
+
+            Histogram bucket 0 holds calls that took under a microsecond, bucket n holds calls that took
+            between 2^(n-1) and 2^n microseconds. The final bucket holds everything slower than that.
+        */
+        class HandlerMetrics
+        {
+            public:
+                explicit HandlerMetrics(std::string name);
+                static size_t BucketForDuration(std::chrono::nanoseconds duration);
+                static std::chrono::nanoseconds BucketUpperBound(size_t bucket);
+                unsigned long long CountCalls(void) const;
+                std::chrono::nanoseconds GetAverageTime(void) const;
+                const std::vector<unsigned long long> & GetHistogram(void) const;
+                std::chrono::nanoseconds GetMaxTime(void) const;
+                std::string GetName(void) const;
+                std::chrono::nanoseconds GetPercentileUpperBound(double percentile) const;
+                std::string GetSummary(void) const;
+                std::chrono::nanoseconds GetTotalTime(void) const;
+                void Record(std::chrono::nanoseconds duration);
+                void Reset(void);
+
+                // The number of buckets in the histogram
+                static const size_t histogramBuckets = 16;
+
+            private:
+
+                // The name of the handler
+                const std::string name;
+
+                // How many times the handler has been called
+                unsigned long long calls = 0;
+
+                // The total time spent in the handler
+                std::chrono::nanoseconds totalTime = std::chrono::nanoseconds::zero();
+
+                // The slowest call to the handler
+                std::chrono::nanoseconds maxTime = std::chrono::nanoseconds::zero();
+
+                // Call durations, log-scale
+                std::vector<unsigned long long> histogram;
+        };
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
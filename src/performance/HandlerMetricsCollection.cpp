@@ -0,0 +1,83 @@
+#include "pch/stdafx.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "performance/HandlerMetrics.h"
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        size_t HandlerMetricsCollection::CountMetrics(void) const
+        {
+            return this->metrics.size();
+        }
+
+        /*
+            Returns the metrics with the given name, or nullptr if there are none.
+        */
+        std::shared_ptr<HandlerMetrics> HandlerMetricsCollection::GetMetrics(std::string name) const
+        {
+            auto metric = this->metrics.find(name);
+            return metric == this->metrics.cend() ? nullptr : metric->second;
+        }
+
+        /*
+            Returns all the metrics, with the most expensive handler first.
+        */
+        std::vector<std::shared_ptr<const HandlerMetrics>> HandlerMetricsCollection::GetMetricsByTotalTime(void) const
+        {
+            std::vector<std::shared_ptr<const HandlerMetrics>> sorted;
+            for (auto metric = this->metrics.cbegin(); metric != this->metrics.cend(); ++metric) {
+                sorted.push_back(metric->second);
+            }
+
+            std::stable_sort(
+                sorted.begin(),
+                sorted.end(),
+                [](const std::shared_ptr<const HandlerMetrics> & a, const std::shared_ptr<const HandlerMetrics> & b)
+                {
+                    return a->GetTotalTime() > b->GetTotalTime();
+                }
+            );
+
+            return sorted;
+        }
+
+        /*
+            Turns a handler type into something readable, so "class UKControllerPlugin::Wake::WakeEventHandler"
+            becomes "Wake::WakeEventHandler".
+        */
+        std::string HandlerMetricsCollection::NameFromType(const std::type_info & type)
+        {
+            std::string name = type.name();
+            for (std::string prefix : { "class ", "struct ", "UKControllerPlugin::" }) {
+                if (name.compare(0, prefix.size(), prefix) == 0) {
+                    name = name.substr(prefix.size());
+                }
+            }
+
+            return name;
+        }
+
+        /*
+            Creates metrics for a handler. If metrics with the given name already exist, they are returned
+            so that a handler that is registered more than once is reported as one.
+        */
+        std::shared_ptr<HandlerMetrics> HandlerMetricsCollection::Register(std::string name)
+        {
+            if (this->metrics.count(name) == 0) {
+                this->metrics[name] = std::make_shared<HandlerMetrics>(name);
+            }
+
+            return this->metrics.at(name);
+        }
+
+        /*
+            Start counting from scratch.
+        */
+        void HandlerMetricsCollection::Reset(void)
+        {
+            for (auto metric = this->metrics.cbegin(); metric != this->metrics.cend(); ++metric) {
+                metric->second->Reset();
+            }
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
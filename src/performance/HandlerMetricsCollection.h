@@ -0,0 +1,28 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        class HandlerMetrics;
+
+        /*
+            Holds the metrics for every instrumented event handler and tag item, so
+            that we can work out which ones are taking up the most time.
+        */
+        class HandlerMetricsCollection
+        {
+            public:
+                size_t CountMetrics(void) const;
+                std::shared_ptr<HandlerMetrics> GetMetrics(std::string name) const;
+                std::vector<std::shared_ptr<const HandlerMetrics>> GetMetricsByTotalTime(void) const;
+                static std::string NameFromType(const std::type_info & type);
+                std::shared_ptr<HandlerMetrics> Register(std::string name);
+                void Reset(void);
+
+            private:
+
+                // All the metrics, by name
+                std::map<std::string, std::shared_ptr<HandlerMetrics>> metrics;
+        };
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -0,0 +1,26 @@
+#include "pch/stdafx.h"
+#include "performance/PerformanceModule.h"
+#include "performance/PerformanceReporter.h"
+
+using UKControllerPlugin::Bootstrap::PersistenceContainer;
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        const int logReportFrequency = 300;
+
+        /*
+            Set up reporting on the handler metrics gathered by the event collections.
+        */
+        void BootstrapPlugin(PersistenceContainer & container)
+        {
+            std::shared_ptr<PerformanceReporter> reporter = std::make_shared<PerformanceReporter>(
+                *container.handlerMetrics,
+                *container.userMessager
+            );
+
+            container.commandHandlers->RegisterHandler(reporter);
+            container.timedHandler->RegisterEvent(reporter, logReportFrequency);
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -0,0 +1,12 @@
+#pragma once
+#include "bootstrap/PersistenceContainer.h"
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        // How often to write the handler performance report to the log, in seconds
+        extern const int logReportFrequency;
+
+        void BootstrapPlugin(UKControllerPlugin::Bootstrap::PersistenceContainer & container);
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -0,0 +1,59 @@
+#include "pch/stdafx.h"
+#include "performance/PerformanceReportMessage.h"
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        PerformanceReportMessage::PerformanceReportMessage(std::string line)
+            : line(line)
+        {
+
+        }
+
+        /*
+            Put the message in a dedicated handler
+        */
+        std::string PerformanceReportMessage::MessageHandler(void) const
+        {
+            return "UKCP_Perf";
+        }
+
+        std::string PerformanceReportMessage::MessageSender(void) const
+        {
+            return "UKCP";
+        }
+
+        std::string PerformanceReportMessage::MessageString(void) const
+        {
+            return this->line;
+        }
+
+        /*
+            They've asked for it, so show it
+        */
+        bool PerformanceReportMessage::MessageShowHandler(void) const
+        {
+            return true;
+        }
+
+        bool PerformanceReportMessage::MessageMarkUnread(void) const
+        {
+            return false;
+        }
+
+        bool PerformanceReportMessage::MessageOverrideBusy(void) const
+        {
+            return true;
+        }
+
+        bool PerformanceReportMessage::MessageFlashHandler(void) const
+        {
+            return false;
+        }
+
+        bool PerformanceReportMessage::MessageRequiresConfirm(void) const
+        {
+            return false;
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
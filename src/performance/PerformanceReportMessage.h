@@ -0,0 +1,29 @@
+#pragma once
+#include "message/MessageSerializableInterface.h"
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        /*
+            A line of the handler performance report, shown to the user
+            when they ask for it.
+        */
+        class PerformanceReportMessage : public UKControllerPlugin::Message::MessageSerializableInterface
+        {
+            public:
+                explicit PerformanceReportMessage(std::string line);
+                std::string MessageHandler(void) const override;
+                std::string MessageSender(void) const override;
+                std::string MessageString(void) const override;
+                bool MessageShowHandler(void) const override;
+                bool MessageMarkUnread(void) const override;
+                bool MessageOverrideBusy(void) const override;
+                bool MessageFlashHandler(void) const override;
+                bool MessageRequiresConfirm(void) const override;
+
+            private:
+                // The line of the report
+                const std::string line;
+        };
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -0,0 +1,79 @@
+#include "pch/stdafx.h"
+#include "performance/PerformanceReporter.h"
+#include "performance/PerformanceReportMessage.h"
+#include "performance/HandlerMetrics.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "message/UserMessager.h"
+
+using UKControllerPlugin::Message::UserMessager;
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        PerformanceReporter::PerformanceReporter(
+            const HandlerMetricsCollection & metrics,
+            UserMessager & userMessager
+        )
+            : metrics(metrics), userMessager(userMessager)
+        {
+
+        }
+
+        /*
+            Returns a summary of each handler that has been called, most expensive first.
+        */
+        std::vector<std::string> PerformanceReporter::GetReport(size_t maxLines) const
+        {
+            std::vector<std::string> report;
+            std::vector<std::shared_ptr<const HandlerMetrics>> sorted = this->metrics.GetMetricsByTotalTime();
+            for (
+                auto metric = sorted.cbegin();
+                metric != sorted.cend() && report.size() < maxLines;
+                ++metric
+            ) {
+                if ((*metric)->CountCalls() == 0) {
+                    continue;
+                }
+
+                report.push_back((*metric)->GetSummary());
+            }
+
+            return report;
+        }
+
+        bool PerformanceReporter::ProcessCommand(std::string command)
+        {
+            if (command != this->command) {
+                return false;
+            }
+
+            std::vector<std::string> report = this->GetReport(this->maxUserLines);
+            if (report.empty()) {
+                this->userMessager.SendMessageToUser(PerformanceReportMessage("No handler metrics recorded yet"));
+                return true;
+            }
+
+            for (auto line = report.cbegin(); line != report.cend(); ++line) {
+                this->userMessager.SendMessageToUser(PerformanceReportMessage(*line));
+            }
+
+            return true;
+        }
+
+        /*
+            Write the full report to the log.
+        */
+        void PerformanceReporter::TimedEventTrigger(void)
+        {
+            std::vector<std::string> report = this->GetReport(this->metrics.CountMetrics());
+            if (report.empty()) {
+                return;
+            }
+
+            LogInfo("Handler performance report");
+            for (auto line = report.cbegin(); line != report.cend(); ++line) {
+                LogInfo(*line);
+            }
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
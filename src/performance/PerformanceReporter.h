@@ -0,0 +1,52 @@
+#pragma once
+#include "command/CommandHandlerInterface.h"
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPlugin {
+    namespace Message {
+        class UserMessager;
+    }  // namespace Message
+}  // namespace UKControllerPlugin
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        class HandlerMetricsCollection;
+
+        /*
+            Reports on how long the instrumented event handlers and tag items are taking. Periodically
+            writes the full report to the log, and shows the most expensive handlers to the user
+            when they type .ukcp perf.
+        */
+        class PerformanceReporter : public UKControllerPlugin::Command::CommandHandlerInterface,
+            public UKControllerPlugin::TimedEvent::AbstractTimedEvent
+        {
+            public:
+                PerformanceReporter(
+                    const UKControllerPlugin::Performance::HandlerMetricsCollection & metrics,
+                    UKControllerPlugin::Message::UserMessager & userMessager
+                );
+                std::vector<std::string> GetReport(size_t maxLines) const;
+
+                // Inherited via CommandHandlerInterface
+                bool ProcessCommand(std::string command) override;
+
+                // Inherited via AbstractTimedEvent
+                void TimedEventTrigger(void) override;
+
+                // The command to show the report
+                const std::string command = ".ukcp perf";
+
+                // The most handlers to show the user at once
+                const size_t maxUserLines = 10;
+
+            private:
+
+                // The handler metrics
+                const UKControllerPlugin::Performance::HandlerMetricsCollection & metrics;
+
+                // For sending the report to the user
+                UKControllerPlugin::Message::UserMessager & userMessager;
+        };
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -0,0 +1,19 @@
+#include "pch/stdafx.h"
+#include "performance/ScopedHandlerTimer.h"
+#include "performance/HandlerMetrics.h"
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        ScopedHandlerTimer::ScopedHandlerTimer(HandlerMetrics & metrics)
+            : metrics(metrics), start(std::chrono::steady_clock::now())
+        {
+
+        }
+
+        ScopedHandlerTimer::~ScopedHandlerTimer(void)
+        {
+            this->metrics.Record(std::chrono::steady_clock::now() - this->start);
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
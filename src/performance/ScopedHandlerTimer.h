@@ -0,0 +1,29 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace Performance {
+
+        class HandlerMetrics;
+
+        /*
+            Times how long it takes to go out of scope and records the
+            result against a handlers metrics.
+        */
+        class ScopedHandlerTimer
+        {
+            public:
+                explicit ScopedHandlerTimer(HandlerMetrics & metrics);
+                ~ScopedHandlerTimer(void);
+                ScopedHandlerTimer(const ScopedHandlerTimer &) = delete;
+                ScopedHandlerTimer & operator=(const ScopedHandlerTimer &) = delete;
+
+            private:
+
+                // The metrics to record against
+                HandlerMetrics & metrics;
+
+                // When we started timing
+                const std::chrono::steady_clock::time_point start;
+        };
+    }  // namespace Performance
+}  // namespace UKControllerPlugin
@@ -546,6 +546,19 @@ namespace UKControllerPlugin {
         }
     }
 
+    /*
+        Mark a flightplan as needing an update. All the dirty flightplans are pushed through the
+        flightplan event handlers once on the next timer tick, however many times they're marked.
+    */
+    void UKPlugin::MarkFlightplanDirty(std::string callsign)
+    {
+        this->dirtyFlightplans.insert(callsign);
+    }
+
+    /*
+        Apply a function to every flightplan with a radar target. This is read-only as far as
+        the flightplan event handlers are concerned.
+    */
     void UKPlugin::ApplyFunctionToAllFlightplans(
         std::function<void(
             std::shared_ptr<EuroScopeCFlightPlanInterface>,
@@ -575,8 +588,6 @@ namespace UKControllerPlugin {
                 std::make_shared<EuroScopeCFlightPlanWrapper>(current),
                 std::make_shared<EuroScopeCRadarTargetWrapper>(rt)
             );
-
-            this->OnFlightPlanFlightPlanDataUpdate(current);
         } while (strcmp((current = this->FlightPlanSelectNext(current)).GetCallsign(), "") != 0);
     }
 
@@ -618,5 +629,10 @@ namespace UKControllerPlugin {
     void UKPlugin::OnTimer(int time)
     {
         this->timedEvents.Tick(time);
+
+        for (const std::string & callsign : this->dirtyFlightplans) {
+            this->TriggerFlightplanUpdateForCallsign(callsign);
+        }
+        this->dirtyFlightplans.clear();
     }
 }  // namespace UKControllerPlugin
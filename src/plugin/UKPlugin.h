@@ -134,6 +134,7 @@ namespace UKControllerPlugin {
             void RegisterTagFunction(int itemCode, std::string description) override;
             void RegisterTagItem(int itemCode, std::string description);
             void TriggerFlightplanUpdateForCallsign(std::string callsign);
+            void MarkFlightplanDirty(std::string callsign) override;
             void ApplyFunctionToAllFlightplans(
                 std::function<
                 void(
@@ -199,5 +200,8 @@ namespace UKControllerPlugin {
 
             // Whether or not we've initialised the plugin.
             bool initialised = false;
+
+            // Flightplans that need to go through the flightplan event handlers on the next timer tick
+            std::set<std::string> dirtyFlightplans;
 };  // namespace Windows
 }  // namespace UKControllerPlugin
@@ -54,6 +54,24 @@ namespace UKControllerPlugin {
         return this->ConvertCoordFromPositionToPixel(pos);
     }
 
+    /*
+        Converts a batch of coordinates to pixels. EuroScope doesn't expose its view
+        transform, so each point still goes through EuroScope, but we only build one position.
+    */
+    void UKRadarScreen::ConvertCoordinatesToScreenPoints(
+        const double * latitudes,
+        const double * longitudes,
+        size_t count,
+        POINT * points
+    ) {
+        EuroScopePlugIn::CPosition position;
+        for (size_t i = 0; i < count; i++) {
+            position.m_Latitude = latitudes[i];
+            position.m_Longitude = longitudes[i];
+            points[i] = this->ConvertCoordFromPositionToPixel(position);
+        }
+    }
+
     /*
         Interface method, get data from the ASR.
     */
@@ -46,6 +46,12 @@ namespace UKControllerPlugin {
             ~UKRadarScreen(void);
             void AddMenuItem(UKControllerPlugin::Plugin::PopupMenuItem menuItem) override;
             POINT ConvertCoordinateToScreenPoint(EuroScopePlugIn::CPosition pos) override;
+            void ConvertCoordinatesToScreenPoints(
+                const double * latitudes,
+                const double * longitudes,
+                size_t count,
+                POINT * points
+            ) override;
             std::string GetAsrData(std::string key) override;
             int GetGroundspeedForCallsign(std::string cs) override;
             std::string GetKey(std::string key) override;
@@ -236,7 +236,7 @@ namespace UKControllerPlugin {
             std::string transferringCallsign = transferringController.GetCallsign();
             std::string targetCallsign = targetController.GetCallsign();
             EnrouteRelease release = this->outgoingReleases.at(callsign);
-            this->taskRunner.QueueAsynchronousTask(
+            this->taskRunner.QueueInteractiveTask(
                 [this, release, callsign, transferringCallsign, targetCallsign]() {
                     try {
                         if (release.releasePoint != this->noReleasePoint) {
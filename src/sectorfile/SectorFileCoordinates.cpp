@@ -4,8 +4,105 @@
 namespace UKControllerPlugin {
     namespace SectorFile {
 
-        std::regex latitudePattern("^([N,S])(\\d{3})\\.(\\d{2})\\.(\\d{2})\\.(\\d{3})$");
-        std::regex longitudePattern("^([E,W])(\\d{3})\\.(\\d{2})\\.(\\d{2})\\.(\\d{3})$");
+        // Coordinates are always of the form N051.28.39.000
+        const size_t coordinateLength = 14;
+
+        // XORed with each byte of a coordinate, so that digits become 0-9 and the dots become 0
+        const unsigned char coordinateMask[16] = {
+            0, '0', '0', '0', '.', '0', '0', '.', '0', '0', '.', '0', '0', '0', 0, 0
+        };
+
+        // Added to each masked byte, setting the top bit of any that are too big to be a digit or a dot
+        const unsigned char coordinateLimits[16] = {
+            0x7F, 0x76, 0x76, 0x76, 0x7F, 0x76, 0x76, 0x7F, 0x76, 0x76, 0x7F, 0x76, 0x76, 0x76, 0x7F, 0x7F
+        };
+
+        /*
+            Decodes one coordinate into signed decimal degrees, returning false if it isn't in the sector
+            file format or is out of range.
+
+            Rather than matching a pattern character by character, the coordinate is checked and turned into
+            digits eight bytes at a time. The hemisphere may also be a comma, which is treated as north or
+            east, as the patterns that this replaces have always allowed.
+        */
+        bool DecodeSectorFileCoordinate(
+            const char * coordinate,
+            size_t length,
+            char positive,
+            char negative,
+            int maximumDegrees,
+            double & decoded
+        ) {
+            if (
+                length != coordinateLength ||
+                (coordinate[0] != positive && coordinate[0] != negative && coordinate[0] != ',')
+            ) {
+                return false;
+            }
+
+            unsigned char bytes[16] = {};
+            std::memcpy(bytes + 1, coordinate + 1, coordinateLength - 1);
+
+            uint64_t words[2];
+            uint64_t masks[2];
+            uint64_t limits[2];
+            std::memcpy(words, bytes, sizeof(words));
+            std::memcpy(masks, coordinateMask, sizeof(masks));
+            std::memcpy(limits, coordinateLimits, sizeof(limits));
+
+            uint64_t outOfRange = 0;
+            for (int word = 0; word < 2; word++) {
+                words[word] ^= masks[word];
+                outOfRange |= (((words[word] & 0x7F7F7F7F7F7F7F7F) + limits[word]) | words[word]) &
+                    0x8080808080808080;
+            }
+
+            if (outOfRange != 0) {
+                return false;
+            }
+
+            std::memcpy(bytes, words, sizeof(bytes));
+            int degrees = bytes[1] * 100 + bytes[2] * 10 + bytes[3];
+            int minutes = bytes[5] * 10 + bytes[6];
+            int thousandthsOfSeconds = bytes[8] * 10000 + bytes[9] * 1000 + bytes[11] * 100 + bytes[12] * 10 +
+                bytes[13];
+
+            if (
+                (degrees == maximumDegrees && (minutes != 0 || thousandthsOfSeconds != 0)) ||
+                degrees > maximumDegrees ||
+                minutes >= 60 ||
+                thousandthsOfSeconds >= 60000
+            ) {
+                return false;
+            }
+
+            decoded = degrees + (minutes / 60.0) + ((thousandthsOfSeconds / 1000.0) / 3600.0);
+            if (coordinate[0] == negative) {
+                decoded *= -1;
+            }
+
+            return true;
+        }
+
+        /*
+            Decodes a latitude and longitude pair, or returns the invalid position if either is invalid.
+        */
+        EuroScopePlugIn::CPosition DecodeSectorFileCoordinates(
+            const char * latitude,
+            size_t latitudeLength,
+            const char * longitude,
+            size_t longitudeLength
+        ) {
+            EuroScopePlugIn::CPosition position;
+            if (
+                !DecodeSectorFileCoordinate(latitude, latitudeLength, 'N', 'S', 90, position.m_Latitude) ||
+                !DecodeSectorFileCoordinate(longitude, longitudeLength, 'E', 'W', 180, position.m_Longitude)
+            ) {
+                return GetInvalidPosition();
+            }
+
+            return position;
+        }
 
         EuroScopePlugIn::CPosition GetInvalidPosition(void)
         {
@@ -15,53 +112,55 @@ namespace UKControllerPlugin {
             return pos;
         }
 
-        EuroScopePlugIn::CPosition ParseSectorFileCoordinates(std::string latitude, std::string longitude)
+        /*
+            Parses a buffer of whitespace separated latitude and longitude pairs, such as
+            "N051.28.39.000 W000.27.41.000\nN051.29.00.000 W000.28.00.000". Returns one position
+            per pair, in the order they appear. Pairs that don't parse, and a latitude without a longitude
+            at the end, are returned as the invalid position.
+        */
+        std::vector<EuroScopePlugIn::CPosition> ParseSectorFileCoordinateBuffer(const std::string & buffer)
         {
-            std::match_results<std::string::const_iterator> latitudeMatch;
-            std::match_results<std::string::const_iterator> longitudeMatch;
+            std::vector<EuroScopePlugIn::CPosition> positions;
+            positions.reserve(buffer.size() / (coordinateLength * 2 + 2) + 1);
 
-            if (
-                !std::regex_match(latitude, latitudeMatch, latitudePattern) ||
-                !std::regex_match(longitude, longitudeMatch, longitudePattern)
-            ) {
-                return GetInvalidPosition();
-            }
+            const char * next = buffer.data();
+            const char * end = buffer.data() + buffer.size();
+            const char * latitude = nullptr;
+            size_t latitudeLength = 0;
+            while (true) {
+                while (next != end && (*next == ' ' || *next == '\t' || *next == '\r' || *next == '\n')) {
+                    next++;
+                }
 
-            // Get the values out of the regex
-            int latitudeDegrees = std::stoi(latitudeMatch[2].str());
-            int latitudeMinutes = std::stoi(latitudeMatch[3].str());
-            double latitudeSeconds = std::stod(latitudeMatch[4].str() + "." + latitudeMatch[5].str());
-            int longitudeDegrees = std::stoi(longitudeMatch[2].str());
-            int longitudeMinutes = std::stoi(longitudeMatch[3].str());
-            double longitudeSeconds = std::stod(longitudeMatch[4].str() + "." + longitudeMatch[5].str());
+                if (next == end) {
+                    break;
+                }
 
-            // Check the validity of the values
-            if (
-                (latitudeDegrees == 90 && (latitudeMinutes != 0 || latitudeSeconds != 0)) ||
-                latitudeDegrees > 90 ||
-                latitudeMinutes >= 60 ||
-                latitudeSeconds >= 60.0 ||
-                (longitudeDegrees == 180 && (longitudeMinutes != 0 || longitudeSeconds != 0)) ||
-                longitudeDegrees > 180 ||
-                longitudeMinutes >= 60 ||
-                longitudeSeconds >= 60.0
-            ) {
-                return GetInvalidPosition();
-            }
+                const char * token = next;
+                while (next != end && *next != ' ' && *next != '\t' && *next != '\r' && *next != '\n') {
+                    next++;
+                }
 
-            EuroScopePlugIn::CPosition position;
-            position.m_Latitude = latitudeDegrees + (latitudeMinutes / 60.0) + (latitudeSeconds / 3600.0);
-            position.m_Longitude = longitudeDegrees + (longitudeMinutes / 60.0) + (longitudeSeconds / 3600.0);
+                if (latitude == nullptr) {
+                    latitude = token;
+                    latitudeLength = next - token;
+                    continue;
+                }
 
-            if (latitudeMatch[1] == "S") {
-                position.m_Latitude *= -1;
+                positions.push_back(DecodeSectorFileCoordinates(latitude, latitudeLength, token, next - token));
+                latitude = nullptr;
             }
 
-            if (longitudeMatch[1] == "W") {
-                position.m_Longitude *= -1;
+            if (latitude != nullptr) {
+                positions.push_back(GetInvalidPosition());
             }
 
-            return position;
+            return positions;
+        }
+
+        EuroScopePlugIn::CPosition ParseSectorFileCoordinates(std::string latitude, std::string longitude)
+        {
+            return DecodeSectorFileCoordinates(latitude.data(), latitude.size(), longitude.data(), longitude.size());
         }
 
         bool PositionIsInvalid(EuroScopePlugIn::CPosition pos)
@@ -3,6 +3,7 @@
 namespace UKControllerPlugin {
     namespace SectorFile {
         EuroScopePlugIn::CPosition GetInvalidPosition(void);
+        std::vector<EuroScopePlugIn::CPosition> ParseSectorFileCoordinateBuffer(const std::string & buffer);
         EuroScopePlugIn::CPosition ParseSectorFileCoordinates(std::string latitude, std::string longitude);
         bool PositionIsInvalid(EuroScopePlugIn::CPosition pos);
     }  // namespace SectorFile
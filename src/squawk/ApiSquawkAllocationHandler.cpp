@@ -18,12 +18,19 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Add a squawk event to the queue, but don't store duplicates
+            Add a squawk event to the queue, duplicates are removed when it is taken off the queue
         */
         void ApiSquawkAllocationHandler::AddAllocationToQueue(ApiSquawkAllocation event)
         {
-            std::lock_guard<std::mutex> lock(this->queueGuard);
-            this->allocationQueue.insert(event);
+            this->incomingAllocations.Push({ event });
+        }
+
+        /*
+            Add several squawk events to the queue at once, so that they are all assigned in the same flush
+        */
+        void ApiSquawkAllocationHandler::AddAllocationsToQueue(const std::vector<ApiSquawkAllocation> & events)
+        {
+            this->incomingAllocations.Push(events);
         }
 
         /*
@@ -31,15 +38,16 @@ namespace UKControllerPlugin {
         */
         int ApiSquawkAllocationHandler::Count(void)
         {
-            std::lock_guard<std::mutex> lock(this->queueGuard);
+            this->TakeIncomingAllocations();
             return this->allocationQueue.size();
         }
 
         /*
             Returns the first allocation on the queue
         */
-        UKControllerPlugin::Squawk::ApiSquawkAllocation ApiSquawkAllocationHandler::First(void) const
+        UKControllerPlugin::Squawk::ApiSquawkAllocation ApiSquawkAllocationHandler::First(void)
         {
+            this->TakeIncomingAllocations();
             return this->allocationQueue.size() > 0 ? *this->allocationQueue.cbegin() : this->invalid;
         }
 
@@ -48,7 +56,7 @@ namespace UKControllerPlugin {
         */
         void ApiSquawkAllocationHandler::TimedEventTrigger(void)
         {
-            std::lock_guard<std::mutex> lock(this->queueGuard);
+            this->TakeIncomingAllocations();
             std::shared_ptr<EuroScopeCFlightPlanInterface> flightplan;
             for (
                 std::set<UKControllerPlugin::Squawk::ApiSquawkAllocation>::iterator it = this->allocationQueue.begin();
@@ -65,5 +73,15 @@ namespace UKControllerPlugin {
                 this->allocationQueue.erase(it++);
             }
         }
+
+        /*
+            Move everything that other threads have handed over into the queue, without storing duplicates
+        */
+        void ApiSquawkAllocationHandler::TakeIncomingAllocations(void)
+        {
+            this->incomingAllocations.Drain([this](std::vector<ApiSquawkAllocation> allocations) {
+                this->allocationQueue.insert(allocations.cbegin(), allocations.cend());
+            });
+        }
     }  // namespace Squawk
 }  // namespace UKControllerPlugin
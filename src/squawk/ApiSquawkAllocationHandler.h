@@ -1,6 +1,7 @@
 #pragma once
 #include "squawk/ApiSquawkAllocation.h"
 #include "timedevent/AbstractTimedEvent.h"
+#include "task/LockFreeQueue.h"
 
 namespace UKControllerPlugin {
     namespace Euroscope {
@@ -13,7 +14,9 @@ namespace UKControllerPlugin {
 
         /*
             Receives the API squawk allocation events
-            and subsequently assigns them to flightplans
+            and subsequently assigns them to flightplans.
+
+            Allocations can be added from any thread. Everything else must happen on the EuroScope thread.
         */
         class ApiSquawkAllocationHandler : public UKControllerPlugin::TimedEvent::AbstractTimedEvent
         {
@@ -22,8 +25,9 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & plugin
                 );
                 void AddAllocationToQueue(UKControllerPlugin::Squawk::ApiSquawkAllocation event);
+                void AddAllocationsToQueue(const std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> & events);
                 int Count(void);
-                UKControllerPlugin::Squawk::ApiSquawkAllocation First(void) const;
+                UKControllerPlugin::Squawk::ApiSquawkAllocation First(void);
                 // Inherited via AbstractTimedEvent
                 void TimedEventTrigger(void) override;
 
@@ -31,11 +35,15 @@ namespace UKControllerPlugin {
 
             private:
 
-                // A queue of squawk events to be processed
-                std::set<UKControllerPlugin::Squawk::ApiSquawkAllocation> allocationQueue;
+                void TakeIncomingAllocations(void);
 
-                // A guard on the queue to allow it
-                std::mutex queueGuard;
+                // Allocations handed over from other threads, each batch of allocations is pushed in one go
+                UKControllerPlugin::TaskManager::LockFreeQueue<
+                    std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation>
+                > incomingAllocations;
+
+                // A queue of squawk events to be processed, only touched on the EuroScope thread
+                std::set<UKControllerPlugin::Squawk::ApiSquawkAllocation> allocationQueue;
 
                 // The plugin instance, to allow squawks to be set and flightplans to be retrieved
                 UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface & plugin;
@@ -0,0 +1,19 @@
+#pragma once
+#include "squawk/ApiSquawkAllocation.h"
+
+namespace UKControllerPlugin {
+    namespace Squawk {
+
+        /*
+            A squawk request that is waiting to be sent to the API as part of the next batch.
+        */
+        typedef struct PendingSquawkRequest
+        {
+            // The callsign the squawk is for
+            std::string callsign;
+
+            // Makes the API calls, adding any squawk allocated to the list
+            std::function<void(std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> & allocations)> request;
+        } PendingSquawkRequest;
+    }  // namespace Squawk
+}  // namespace UKControllerPlugin
@@ -10,6 +10,7 @@
 #include "euroscope/EuroScopeCControllerInterface.h"
 #include "controller/ActiveCallsignCollection.h"
 #include "flightplan/StoredFlightplanCollection.h"
+#include "helper/StringScanners.h"
 
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
@@ -20,6 +21,7 @@ using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Helper::IsCircuitRoute;
 
 namespace UKControllerPlugin {
     namespace Squawk {
@@ -48,10 +50,7 @@ namespace UKControllerPlugin {
         {
             return flightplan.IsVfr() &&
                 !flightplan.HasAssignedSquawk() &&
-                std::regex_search(
-                    flightplan.GetRawRouteString(),
-                    std::regex("^(?:VFR )?CIRCUIT(?:S)?", std::regex::icase)
-                ) &&
+                IsCircuitRoute(flightplan.GetRawRouteString()) &&
                 this->GeneralAssignmentNeeded(flightplan, radarTarget);
         }
 
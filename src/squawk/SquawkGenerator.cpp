@@ -13,6 +13,8 @@
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "squawk/ApiSquawkAllocation.h"
 #include "squawk/ApiSquawkAllocationHandler.h"
+#include "squawk/PendingSquawkRequest.h"
+#include "squawk/SquawkRequestBatch.h"
 
 using UKControllerPlugin::Api::ApiInterface;
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
@@ -27,6 +29,8 @@ using UKControllerPlugin::Api::ApiNotFoundException;
 using UKControllerPlugin::Controller::ControllerPosition;
 using UKControllerPlugin::Squawk::ApiSquawkAllocation;
 using UKControllerPlugin::Squawk::ApiSquawkAllocationHandler;
+using UKControllerPlugin::Squawk::PendingSquawkRequest;
+using UKControllerPlugin::Squawk::SquawkRequestBatch;
 
 namespace UKControllerPlugin {
     namespace Squawk {
@@ -37,10 +41,11 @@ namespace UKControllerPlugin {
             const UKControllerPlugin::Squawk::SquawkAssignment & assignmentRules,
             const UKControllerPlugin::Controller::ActiveCallsignCollection & activeCallsigns,
             const UKControllerPlugin::Flightplan::StoredFlightplanCollection & storedFlightplans,
-            const std::shared_ptr<ApiSquawkAllocationHandler> allocations
+            const std::shared_ptr<ApiSquawkAllocationHandler> allocations,
+            const std::chrono::milliseconds batchWindow
         )
             : api(api), taskRunner(taskRunner), assignmentRules(assignmentRules), activeCallsigns(activeCallsigns),
-            storedFlightplans(storedFlightplans), allocations(allocations)
+            storedFlightplans(storedFlightplans), allocations(allocations), batchWindow(batchWindow)
         {
         }
 
@@ -85,10 +90,12 @@ namespace UKControllerPlugin {
             std::string origin = flightplan.GetOrigin();
             std::string destination = flightplan.GetDestination();
 
-            this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
-                this->CreateGeneralSquawkAssignment(callsign, origin, destination);
-                this->EndSquawkUpdate(callsign);
-            });
+            this->QueueSquawkRequest(
+                callsign,
+                [this, callsign, origin, destination](std::vector<ApiSquawkAllocation> & allocations) {
+                    this->CreateGeneralSquawkAssignment(callsign, origin, destination, allocations);
+                }
+            );
             return true;
         }
 
@@ -122,10 +129,12 @@ namespace UKControllerPlugin {
             std::string flightRules = flightplan.GetFlightRules();
 
             // Make the request
-            this->taskRunner->QueueAsynchronousTask([this, callsign, unit, flightRules]() {
-                this->CreateLocalSquawkAssignment(callsign, unit, flightRules);
-                this->EndSquawkUpdate(callsign);
-            });
+            this->QueueSquawkRequest(
+                callsign,
+                [this, callsign, unit, flightRules](std::vector<ApiSquawkAllocation> & allocations) {
+                    this->CreateLocalSquawkAssignment(callsign, unit, flightRules, allocations);
+                }
+            );
             return true;
         }
 
@@ -180,20 +189,24 @@ namespace UKControllerPlugin {
 
             // Force update required.
             if (this->assignmentRules.ForceAssignmentNeeded(flightplan)) {
-                this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
-                    this->CreateGeneralSquawkAssignment(callsign, origin, destination);
-                    this->EndSquawkUpdate(callsign);
-                });
+                this->QueueSquawkRequest(
+                    callsign,
+                    [this, callsign, origin, destination](std::vector<ApiSquawkAllocation> & allocations) {
+                        this->CreateGeneralSquawkAssignment(callsign, origin, destination, allocations);
+                    }
+                );
                 return true;
             }
 
             // Search for an existing assignment, create if necessary
-            this->taskRunner->QueueAsynchronousTask([this, callsign, origin, destination]() {
-                if (!this->GetSquawkAssignment(callsign)) {
-                    this->CreateGeneralSquawkAssignment(callsign, origin, destination);
+            this->QueueSquawkRequest(
+                callsign,
+                [this, callsign, origin, destination](std::vector<ApiSquawkAllocation> & allocations) {
+                    if (!this->GetSquawkAssignment(callsign, allocations)) {
+                        this->CreateGeneralSquawkAssignment(callsign, origin, destination, allocations);
+                    }
                 }
-                this->EndSquawkUpdate(callsign);
-            });
+            );
             return true;
         }
 
@@ -223,12 +236,14 @@ namespace UKControllerPlugin {
             std::string flightRules = flightplan.GetFlightRules();
 
             // Check for existing squawk assignment, create if necessary
-            this->taskRunner->QueueAsynchronousTask([this, callsign, unit, flightRules]() {
-                if (!this->GetSquawkAssignment(callsign)) {
-                    this->CreateLocalSquawkAssignment(callsign, unit, flightRules);
+            this->QueueSquawkRequest(
+                callsign,
+                [this, callsign, unit, flightRules](std::vector<ApiSquawkAllocation> & allocations) {
+                    if (!this->GetSquawkAssignment(callsign, allocations)) {
+                        this->CreateLocalSquawkAssignment(callsign, unit, flightRules, allocations);
+                    }
                 }
-                this->EndSquawkUpdate(callsign);
-            });
+            );
             return true;
         }
 
@@ -238,12 +253,14 @@ namespace UKControllerPlugin {
 
             THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
         */
-        bool SquawkGenerator::GetSquawkAssignment(std::string callsign) const
-        {
+        bool SquawkGenerator::GetSquawkAssignment(
+            std::string callsign,
+            std::vector<ApiSquawkAllocation> & allocations
+        ) const {
             // Assign the squawk to our aircraft
             try {
                 ApiSquawkAllocation allocation = this->api.GetAssignedSquawk(callsign);
-                this->allocations->AddAllocationToQueue(allocation);
+                allocations.push_back(allocation);
                 LogInfo("Found existing API squawk allocation of " + allocation.squawk + " for " + callsign);
                 return true;
             }
@@ -266,7 +283,8 @@ namespace UKControllerPlugin {
         bool SquawkGenerator::CreateGeneralSquawkAssignment(
             std::string callsign,
             std::string origin,
-            std::string destination
+            std::string destination,
+            std::vector<ApiSquawkAllocation> & allocations
         ) const {
             // Assign the squawk to our aircraft
             try {
@@ -275,7 +293,7 @@ namespace UKControllerPlugin {
                     origin,
                     destination
                 );
-                this->allocations->AddAllocationToQueue(allocation);
+                allocations.push_back(allocation);
                 LogInfo("API allocated general squawk " + allocation.squawk + " to " + callsign);
                 return true;
             } catch (ApiException exception) {
@@ -295,11 +313,12 @@ namespace UKControllerPlugin {
         bool SquawkGenerator::CreateLocalSquawkAssignment(
             std::string callsign,
             std::string unit,
-            std::string flightRules
+            std::string flightRules,
+            std::vector<ApiSquawkAllocation> & allocations
         ) const {
             try {
                 ApiSquawkAllocation allocation = this->api.CreateLocalSquawkAssignment(callsign, unit, flightRules);
-                this->allocations->AddAllocationToQueue(allocation);
+                allocations.push_back(allocation);
                 LogInfo("API allocated local squawk " + allocation.squawk + " to " + callsign);
                 return true;
             } catch (ApiException exception) {
@@ -311,6 +330,95 @@ namespace UKControllerPlugin {
             }
         }
 
+        /*
+            Run a request from a batch. If it's the last request in the batch to finish, hand over all the squawks
+            allocated in the batch at once.
+
+            THIS FUNCTION SHOULD ONLY BE USED ON AN ASYNCHRONOUS THREAD.
+        */
+        void SquawkGenerator::FinishSquawkRequest(std::shared_ptr<SquawkRequestBatch> batch, size_t request)
+        {
+            // Whatever happens to the request, it must still count towards the batch finishing, or no squawks in
+            // the batch would ever be handed over
+            std::vector<ApiSquawkAllocation> allocations;
+            try {
+                batch->requests[request].request(allocations);
+            } catch (std::exception & exception) {
+                LogError(
+                    "Exception when requesting squawk for " + batch->requests[request].callsign + ": " +
+                        std::string(exception.what())
+                );
+            } catch (...) {
+                LogError("Unknown exception when requesting squawk for " + batch->requests[request].callsign);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(batch->allocationsLock);
+                for (const ApiSquawkAllocation & allocation : allocations) {
+                    batch->allocations.push_back(allocation);
+                }
+            }
+
+            if (--batch->remaining != 0) {
+                return;
+            }
+
+            this->allocations->AddAllocationsToQueue(batch->allocations);
+            for (const PendingSquawkRequest & pending : batch->requests) {
+                this->EndSquawkUpdate(pending.callsign);
+            }
+
+            if (batch->requests.size() > 1) {
+                LogInfo(
+                    "Processed batch of " + std::to_string(batch->requests.size()) + " squawk requests, " +
+                        std::to_string(batch->allocations.size()) + " squawks allocated"
+                );
+            }
+        }
+
+        /*
+            Once the batch window has passed, take every request waiting in the batch and queue each of them
+            as a task, so that the task runner sends them to the API concurrently.
+        */
+        void SquawkGenerator::TimedEventTrigger(void)
+        {
+            std::shared_ptr<SquawkRequestBatch> batch = std::make_shared<SquawkRequestBatch>();
+            {
+                std::lock_guard<std::mutex> lock(this->pendingRequestsLock);
+                if (
+                    this->pendingRequests.empty() ||
+                    std::chrono::steady_clock::now() < this->batchStarted + this->batchWindow
+                ) {
+                    return;
+                }
+
+                batch->requests.swap(this->pendingRequests);
+            }
+
+            batch->remaining = batch->requests.size();
+            for (size_t request = 0; request < batch->requests.size(); request++) {
+                this->taskRunner->QueueInteractiveTask([this, batch, request]() {
+                    this->FinishSquawkRequest(batch, request);
+                });
+            }
+        }
+
+        /*
+            Add a request to the next batch, starting the batch window if it's the first request in the batch.
+            Any requests made before the batch is sent will go in the same batch.
+        */
+        void SquawkGenerator::QueueSquawkRequest(
+            std::string callsign,
+            std::function<void(std::vector<ApiSquawkAllocation> &)> request
+        ) {
+            std::lock_guard<std::mutex> lock(this->pendingRequestsLock);
+            if (this->pendingRequests.empty()) {
+                this->batchStarted = std::chrono::steady_clock::now();
+            }
+
+            this->pendingRequests.push_back({ callsign, request });
+        }
+
         /*
             Places a request in progress to prevent duplicate requests
         */
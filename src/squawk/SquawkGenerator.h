@@ -1,6 +1,9 @@
 #pragma once
 #include "task/TaskRunnerInterface.h"
+#include "timedevent/AbstractTimedEvent.h"
 #include "squawk/SquawkRequest.h"
+#include "squawk/PendingSquawkRequest.h"
+#include "squawk/SquawkRequestBatch.h"
 
 namespace UKControllerPlugin {
     namespace Api {
@@ -28,8 +31,15 @@ namespace UKControllerPlugin {
 
         /*
             Makes the relevant API calls to generate a squawk for an aircraft.
+
+            Requests are batched, so that when lots of aircraft need squawks at once, such as at login,
+            they are sent to the API together. A batch collects every request made within a short window of
+            the first. The timed event closes the batch on the EuroScope thread once the window has passed, so
+            no task runner thread waits on it, and each request is then run as its own task on the task runner.
+            Every squawk in a batch is handed to the allocation handler at once, so that they are all assigned
+            in the same flush.
         */
-        class SquawkGenerator
+        class SquawkGenerator : public UKControllerPlugin::TimedEvent::AbstractTimedEvent
         {
             public:
                 SquawkGenerator(
@@ -38,7 +48,8 @@ namespace UKControllerPlugin {
                     const UKControllerPlugin::Squawk::SquawkAssignment & assignmentRules,
                     const UKControllerPlugin::Controller::ActiveCallsignCollection & callsigns,
                     const UKControllerPlugin::Flightplan::StoredFlightplanCollection & storedFlightplans,
-                    const std::shared_ptr<UKControllerPlugin::Squawk::ApiSquawkAllocationHandler> allocations
+                    const std::shared_ptr<UKControllerPlugin::Squawk::ApiSquawkAllocationHandler> allocations,
+                    const std::chrono::milliseconds batchWindow = SquawkGenerator::defaultBatchWindow
                 );
                 bool AssignCircuitSquawkForAircraft(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightplan,
@@ -56,6 +67,7 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightplan,
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
                 ) const;
+                void TimedEventTrigger(void) override;
                 bool RequestGeneralSquawkForAircraft(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightplan,
                     UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
@@ -68,22 +80,42 @@ namespace UKControllerPlugin {
                 // The squawk we set when a squawk is being generated
                 const std::string PROCESS_SQUAWK = "7000";
 
+                // How long a batch waits after its first request for others to join it, at least until the next
+                // time the timed event runs
+                static constexpr std::chrono::milliseconds defaultBatchWindow = std::chrono::milliseconds(250);
+
             private:
 
-                bool GetSquawkAssignment(std::string callsign) const;
+                bool GetSquawkAssignment(
+                    std::string callsign,
+                    std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> & allocations
+                ) const;
                 bool CreateGeneralSquawkAssignment(
                     std::string callsign,
                     std::string origin,
-                    std::string destination
+                    std::string destination,
+                    std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> & allocations
                 ) const;
                 bool CreateLocalSquawkAssignment(
                     std::string callsign,
                     std::string unit,
-                    std::string flightRules
+                    std::string flightRules,
+                    std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> & allocations
                 ) const;
                 void EndSquawkUpdate(std::string callsign);
+                void FinishSquawkRequest(
+                    std::shared_ptr<UKControllerPlugin::Squawk::SquawkRequestBatch> batch,
+                    size_t request
+                );
+                void QueueSquawkRequest(
+                    std::string callsign,
+                    std::function<void(std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> &)> request
+                );
                 bool StartSquawkUpdate(UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightplan);
 
+                // How long a batch waits after its first request for others to join it
+                const std::chrono::milliseconds batchWindow;
+
                 // Callsigns of logged in controllers
                 const UKControllerPlugin::Controller::ActiveCallsignCollection & activeCallsigns;
 
@@ -102,6 +134,15 @@ namespace UKControllerPlugin {
                 // A class for thread-safe tracking of squawk requests
                 UKControllerPlugin::Squawk::SquawkRequest squawkRequests;
 
+                // Protects the pending requests
+                std::mutex pendingRequestsLock;
+
+                // Requests waiting to go in the next batch
+                std::vector<UKControllerPlugin::Squawk::PendingSquawkRequest> pendingRequests;
+
+                // When the first request in the next batch was made
+                std::chrono::steady_clock::time_point batchStarted;
+
                 // Receives API squawk allocations, so that they may be assigned to flightplans on the main thread
                 const std::shared_ptr<UKControllerPlugin::Squawk::ApiSquawkAllocationHandler> allocations;
         };
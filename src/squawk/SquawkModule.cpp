@@ -38,7 +38,7 @@ namespace UKControllerPlugin {
                 disabled
             )
             );
-            container.squawkGenerator = std::make_unique<SquawkGenerator>(
+            container.squawkGenerator = std::make_shared<SquawkGenerator>(
                 *container.api,
                 container.taskRunner.get(),
                 *container.squawkAssignmentRules,
@@ -46,6 +46,7 @@ namespace UKControllerPlugin {
                 *container.flightplans,
                 allocations
             );
+            container.timedHandler->RegisterEvent(container.squawkGenerator, SquawkModule::batchCheckFrequency);
 
             // The event handler
             std::shared_ptr<SquawkEventHandler> eventHandler(
@@ -26,6 +26,9 @@ namespace UKControllerPlugin {
 
                 // How often to check for new API allocations
                 static const int allocationCheckFrequency = 3;
+
+                // How often to check whether the next batch of squawk requests is ready to send
+                static const int batchCheckFrequency = 1;
         };
     }  // namespace Squawk
 }  // namespace UKControllerPlugin
@@ -0,0 +1,27 @@
+#pragma once
+#include "squawk/ApiSquawkAllocation.h"
+#include "squawk/PendingSquawkRequest.h"
+
+namespace UKControllerPlugin {
+    namespace Squawk {
+
+        /*
+            A batch of squawk requests that are being sent to the API. Each request runs as its own task, so
+            the squawks are collected here until the last request in the batch has finished.
+        */
+        typedef struct SquawkRequestBatch
+        {
+            // The requests in the batch
+            std::vector<UKControllerPlugin::Squawk::PendingSquawkRequest> requests;
+
+            // How many requests are yet to finish
+            std::atomic<size_t> remaining;
+
+            // Protects the allocations
+            std::mutex allocationsLock;
+
+            // The squawks allocated by the requests that have finished
+            std::vector<UKControllerPlugin::Squawk::ApiSquawkAllocation> allocations;
+        } SquawkRequestBatch;
+    }  // namespace Squawk
+}  // namespace UKControllerPlugin
@@ -75,7 +75,7 @@ namespace UKControllerPlugin {
             ) {
                 this->standAssignments.erase(callsign);
                 this->RemoveFlightStripAnnotation(callsign);
-                this->taskRunner.QueueAsynchronousTask([this, callsign]() {
+                this->taskRunner.QueueInteractiveTask([this, callsign]() {
                     try {
                         this->api.DeleteStandAssignmentForAircraft(callsign);
                     }
@@ -102,7 +102,7 @@ namespace UKControllerPlugin {
                 int standId = stand->id;
                 this->standAssignments[callsign] = standId;
                 this->AnnotateFlightStrip(callsign, standId);
-                this->taskRunner.QueueAsynchronousTask([this, standId, callsign]() {
+                this->taskRunner.QueueInteractiveTask([this, standId, callsign]() {
                     try {
                         this->api.AssignStandToAircraft(callsign, standId);
                     }
@@ -34,6 +34,15 @@ namespace UKControllerPlugin {
                 stands
             );
 
+            BootstrapPlugin(container, std::move(stands));
+        }
+
+        /*
+            Bootstrap with stands that have already been loaded, so that they can be built away from
+            the EuroScope thread.
+        */
+        void BootstrapPlugin(PersistenceContainer& container, std::set<Stand, CompareStands> stands)
+        {
             // Create the event handler
             std::shared_ptr<StandEventHandler> eventHandler = std::make_shared<StandEventHandler>(
                 *container.api,
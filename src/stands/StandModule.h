@@ -1,6 +1,8 @@
 #pragma once
 #include "bootstrap/PersistenceContainer.h"
 #include "dependency/DependencyLoaderInterface.h"
+#include "stands/Stand.h"
+#include "stands/CompareStands.h"
 
 namespace UKControllerPlugin {
     namespace Stands {
@@ -14,5 +16,9 @@ namespace UKControllerPlugin {
             UKControllerPlugin::Bootstrap::PersistenceContainer& container,
             UKControllerPlugin::Dependency::DependencyLoaderInterface& dependencies
         );
+        void BootstrapPlugin(
+            UKControllerPlugin::Bootstrap::PersistenceContainer& container,
+            std::set<UKControllerPlugin::Stands::Stand, UKControllerPlugin::Stands::CompareStands> stands
+        );
     }  // namespace Stands
 }  // namespace UKControllerPlugin
@@ -28,15 +28,20 @@ namespace UKControllerPlugin {
             return std::string(this->itemString);
         }
 
-        void TagData::SetItemString(std::string itemString)
+        /*
+            Copies the string straight into the buffer that EuroScope gave us, this is called
+            for every tag item on every refresh so must not allocate.
+        */
+        void TagData::SetItemString(std::string_view itemString)
         {
             // We only allow data of length maxlength - 1 because of null char on the end.
-            if (itemString.size() > this->maxItemSize - 1) {
-                itemString = this->invalidItemText;
+            if (itemString.size() > maxItemSize - 1) {
+                itemString = invalidItemText;
             }
 
             // Copy into place
-            strcpy_s(this->itemString, 16, itemString.c_str());
+            memcpy(this->itemString, itemString.data(), itemString.size());
+            this->itemString[itemString.size()] = '\0';
         }
 
         void TagData::SetEuroscopeColourCode(int code)
@@ -22,7 +22,7 @@ namespace UKControllerPlugin {
                 );
 
                 std::string GetItemString(void) const;
-                void SetItemString(std::string itemString);
+                void SetItemString(std::string_view itemString);
                 void SetEuroscopeColourCode(int code);
                 int GetEuroscopeColourCode(void) const;
                 void SetTagColour(COLORREF colour);
@@ -32,10 +32,10 @@ namespace UKControllerPlugin {
 
 
                 // The tag item text is too long
-                const std::string invalidItemText = "INVALID";
+                static constexpr const char * invalidItemText = "INVALID";
 
                 // Max length we can have on TAG items, 15 characters + 1 null terminator
-                const size_t maxItemSize = 16;
+                static const size_t maxItemSize = 16;
 
                 // The flightplan
                 const UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface& flightPlan;
@@ -2,12 +2,28 @@
 #include "tag/TagItemCollection.h"
 #include "euroscope/EuroscopePluginLoopbackInterface.h"
 #include "tag/TagItemInterface.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "performance/ScopedHandlerTimer.h"
 
 using UKControllerPlugin::Euroscope::EuroscopePluginLoopbackInterface;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using UKControllerPlugin::Performance::ScopedHandlerTimer;
 
 namespace UKControllerPlugin {
     namespace Tag {
 
+        TagItemCollection::TagItemCollection(void)
+            : TagItemCollection(std::make_shared<HandlerMetricsCollection>())
+        {
+
+        }
+
+        TagItemCollection::TagItemCollection(std::shared_ptr<HandlerMetricsCollection> metrics)
+            : metrics(metrics)
+        {
+
+        }
+
         /*
             Returns the number of registered handlers.
         */
@@ -35,7 +51,21 @@ namespace UKControllerPlugin {
                 throw std::invalid_argument("Tag item already exists!");
             }
 
-            this->tagItems[itemId] = tagItem;
+            if (itemId < 0) {
+                throw std::invalid_argument("Tag item ids cannot be negative");
+            }
+
+            this->tagItems[itemId] = {
+                tagItem,
+                this->metrics->Register(
+                    "Tag " + std::to_string(itemId) + " " + HandlerMetricsCollection::NameFromType(typeid(*tagItem))
+                )
+            };
+
+            if (static_cast<size_t>(itemId) >= this->dispatchTable.size()) {
+                this->dispatchTable.resize(itemId + 1, nullptr);
+            }
+            this->dispatchTable[itemId] = &this->tagItems.at(itemId);
         }
 
         /*
@@ -46,14 +76,20 @@ namespace UKControllerPlugin {
         {
 
             // Make sure the item exists
-            if (this->tagItems.count(tagData.itemCode) == 0) {
+            if (
+                tagData.itemCode < 0 ||
+                static_cast<size_t>(tagData.itemCode) >= this->dispatchTable.size() ||
+                this->dispatchTable[tagData.itemCode] == nullptr
+            ) {
                 LogWarning("Invalid TAG item requested, id: " + std::to_string(tagData.itemCode));
                 tagData.SetItemString(this->errorTagItemText);
                 return;
             }
 
             // Set the data for the tag item
-            this->tagItems.at(tagData.itemCode)->SetTagItemData(tagData);
+            const RegisteredTagItem & item = *this->dispatchTable[tagData.itemCode];
+            ScopedHandlerTimer timer(*item.metrics);
+            item.tagItem->SetTagItemData(tagData);
         }
 
         /*
@@ -62,12 +98,11 @@ namespace UKControllerPlugin {
         void TagItemCollection::RegisterAllItemsWithEuroscope(EuroscopePluginLoopbackInterface & pluginCore) const
         {
             for (
-                std::map<int, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface>>::const_iterator it =
-                    this->tagItems.cbegin();
+                std::map<int, RegisteredTagItem>::const_iterator it = this->tagItems.cbegin();
                 it != this->tagItems.cend();
                 ++it
             ) {
-                pluginCore.RegisterTagItem(it->first, it->second->GetTagItemDescription(it->first));
+                pluginCore.RegisterTagItem(it->first, it->second.tagItem->GetTagItemDescription(it->first));
             }
 
             LogInfo("Registered " + std::to_string(this->tagItems.size()) + " TAG items");
@@ -12,6 +12,10 @@ namespace UKControllerPlugin {
     namespace Euroscope {
         class EuroscopePluginLoopbackInterface;
     }  // namespace Euroscope
+    namespace Performance {
+        class HandlerMetrics;
+        class HandlerMetricsCollection;
+    }  // namespace Performance
 }  // namespace UKControllerPlugin
 // END
 
@@ -20,11 +24,18 @@ namespace UKControllerPlugin {
 
         /*
             A collection of TAG items, which can be called to
-            produce data for a TAG.
+            produce data for a TAG. Records how long each item takes to produce.
+
+            EuroScope asks for every tag item on every aircraft on every refresh, so items are
+            dispatched through a flat table indexed by item code rather than searching the map.
         */
         class TagItemCollection
         {
             public:
+                TagItemCollection(void);
+                explicit TagItemCollection(
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics
+                );
                 int CountHandlers(void) const;
                 bool HasHandlerForItemId(int id) const;
                 void RegisterTagItem(int itemId, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem);
@@ -37,8 +48,20 @@ namespace UKControllerPlugin {
                 const std::string errorTagItemText = "ERROR";
 
             private:
+
+                typedef struct RegisteredTagItem {
+                    std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem;
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetrics> metrics;
+                } RegisteredTagItem;
+
+                // Where tag item metrics are kept
+                const std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics;
+
                 // All registered tag items
-                std::map<int, std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface>> tagItems;
+                std::map<int, RegisteredTagItem> tagItems;
+
+                // Registered tag items indexed by item code, nullptr where there is no item
+                std::vector<const RegisteredTagItem *> dispatchTable;
         };
     }  // namespace Tag
 }  // namespace UKControllerPlugin
@@ -0,0 +1,107 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace TaskManager {
+
+        /*
+            An unbounded queue for handing things from any number of worker threads to a single
+            consumer, usually the EuroScope thread, without either side taking a lock.
+
+            Pushing is one allocation and one atomic exchange, so a producer never waits for the
+            consumer or for other producers. Popping never waits either: if a producer is halfway
+            through a push, the consumer sees the queue as ending there and picks up the rest next
+            time round. Items from any one producer come out in the order that they went in.
+
+            Only one thread may pop at a time. T must be default constructible and movable.
+        */
+        template <typename T>
+        class LockFreeQueue
+        {
+            public:
+                LockFreeQueue(void)
+                    : head(new Node), tail(head.load())
+                {
+                }
+
+                ~LockFreeQueue(void)
+                {
+                    T value;
+                    while (this->TryPop(value)) {}
+                    delete this->tail;
+                }
+
+                LockFreeQueue(const LockFreeQueue &) = delete;
+                LockFreeQueue & operator=(const LockFreeQueue &) = delete;
+
+                /*
+                    Pop everything that had been pushed when the drain started, passing each item to the
+                    function. Items pushed whilst draining are left for next time, so that busy producers
+                    can't keep the consumer here forever. Returns how many items were popped. Consumer thread only.
+                */
+                template <typename Function>
+                size_t Drain(Function function)
+                {
+                    Node * last = this->head.load(std::memory_order_acquire);
+                    size_t popped = 0;
+                    T value;
+                    while (this->tail != last && this->TryPop(value)) {
+                        function(std::move(value));
+                        popped++;
+                    }
+
+                    return popped;
+                }
+
+                /*
+                    Whether there is nothing to pop. Consumer thread only.
+                */
+                bool Empty(void) const
+                {
+                    return this->tail->next.load(std::memory_order_acquire) == nullptr;
+                }
+
+                /*
+                    Add an item to the back of the queue. Any thread.
+                */
+                void Push(T value)
+                {
+                    Node * node = new Node;
+                    node->value = std::move(value);
+                    Node * previous = this->head.exchange(node, std::memory_order_acq_rel);
+                    previous->next.store(node, std::memory_order_release);
+                }
+
+                /*
+                    Take the item at the front of the queue, returning false if there isn't one.
+                    Consumer thread only.
+                */
+                bool TryPop(T & value)
+                {
+                    Node * next = this->tail->next.load(std::memory_order_acquire);
+                    if (next == nullptr) {
+                        return false;
+                    }
+
+                    // The node we move to becomes the new empty front of the queue
+                    value = std::move(next->value);
+                    delete this->tail;
+                    this->tail = next;
+                    return true;
+                }
+
+            private:
+
+                typedef struct Node
+                {
+                    std::atomic<Node *> next { nullptr };
+                    T value;
+                } Node;
+
+                // The most recently pushed node, which producers swap out
+                std::atomic<Node *> head;
+
+                // The node before the front of the queue, only touched by the consumer
+                Node * tail;
+        };
+    }  // namespace TaskManager
+}  // namespace UKControllerPlugin
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace UKControllerPlugin {
+    namespace TaskManager {
+
+        /*
+            A snapshot of how busy one of the TaskRunner's queues has been.
+        */
+        typedef struct TaskQueueMetrics {
+
+            // How many tasks have been queued
+            size_t tasksQueued = 0;
+
+            // How many tasks have been picked up by a thread
+            size_t tasksStarted = 0;
+
+            // How many tasks are currently waiting
+            size_t depth = 0;
+
+            // The most tasks there have been waiting at once
+            size_t maxDepth = 0;
+
+            // How long tasks have spent waiting to be picked up, in total and at worst
+            std::chrono::microseconds totalWait = std::chrono::microseconds(0);
+            std::chrono::microseconds maxWait = std::chrono::microseconds(0);
+        } TaskQueueMetrics;
+    }  // namespace TaskManager
+}  // namespace UKControllerPlugin
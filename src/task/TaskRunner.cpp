@@ -32,6 +32,16 @@ namespace UKControllerPlugin {
                 }
             }
             LogInfo("All TaskRunner threads shut down");
+
+            TaskQueueMetrics interactive = this->GetInteractiveMetrics();
+            TaskQueueMetrics background = this->GetBackgroundMetrics();
+            LogInfo(
+                "TaskRunner ran " + std::to_string(interactive.tasksStarted) + " interactive tasks (max wait " +
+                std::to_string(interactive.maxWait.count()) + "us, max depth " +
+                std::to_string(interactive.maxDepth) + ") and " + std::to_string(background.tasksStarted) +
+                " background tasks (max wait " + std::to_string(background.maxWait.count()) + "us, max depth " +
+                std::to_string(background.maxDepth) + ")"
+            );
         }
 
         size_t TaskRunner::CountThreads(void) const
@@ -39,6 +49,29 @@ namespace UKControllerPlugin {
             return this->threads.size();
         }
 
+        TaskQueueMetrics TaskRunner::GetBackgroundMetrics(void) const
+        {
+            return this->GetMetrics(this->asynchronousTaskQueue, this->backgroundMetrics);
+        }
+
+        TaskQueueMetrics TaskRunner::GetInteractiveMetrics(void) const
+        {
+            return this->GetMetrics(this->interactiveTaskQueue, this->interactiveMetrics);
+        }
+
+        /*
+            Take a snapshot of the metrics for a queue.
+        */
+        TaskQueueMetrics TaskRunner::GetMetrics(
+            const std::deque<QueuedTask> & queue,
+            const TaskQueueMetrics & metrics
+        ) const {
+            std::lock_guard<std::mutex> lock(this->asynchronousQueueLock);
+            TaskQueueMetrics snapshot = metrics;
+            snapshot.depth = queue.size();
+            return snapshot;
+        }
+
         /*
             Queue an aysynchronous task and notify one thread. These kinds of tasks involve actions
             that may be blocking to the EuroScope instance for significant periods
@@ -46,11 +79,46 @@ namespace UKControllerPlugin {
         */
         void TaskRunner::QueueAsynchronousTask(std::function<void(void)> task)
         {
+            this->QueueTask(this->asynchronousTaskQueue, this->backgroundMetrics, std::move(task));
+        }
+
+        /*
+            Queue a task that a controller is waiting on, it'll be run before any background tasks.
+        */
+        void TaskRunner::QueueInteractiveTask(std::function<void(void)> task)
+        {
+            this->QueueTask(this->interactiveTaskQueue, this->interactiveMetrics, std::move(task));
+        }
+
+        void TaskRunner::QueueTask(
+            std::deque<QueuedTask> & queue,
+            TaskQueueMetrics & metrics,
+            std::function<void(void)> task
+        ) {
             std::unique_lock<std::mutex> uniqueLock(this->asynchronousQueueLock);
-            this->asynchronousTaskQueue.push_back(std::move(task));
+            queue.push_back({ std::move(task), std::chrono::steady_clock::now() });
+            metrics.tasksQueued++;
+            metrics.maxDepth = (std::max)(metrics.maxDepth, queue.size());
             this->asynchronousQueueCondVar.notify_one();
         }
 
+        /*
+            Take the task from the front of a queue and record how long it waited. The queue lock must be held.
+        */
+        std::function<void(void)> TaskRunner::TakeTask(std::deque<QueuedTask> & queue, TaskQueueMetrics & metrics)
+        {
+            std::chrono::microseconds wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - queue.front().queuedAt
+            );
+            metrics.tasksStarted++;
+            metrics.totalWait += wait;
+            metrics.maxWait = (std::max)(metrics.maxWait, wait);
+
+            std::function<void(void)> task = std::move(queue.front().task);
+            queue.pop_front();
+            return task;
+        }
+
         /*
             A method to process tasks that are asynchronous - running outside the normal
             loop of EuroScope execution. For example, tasks that require HTTP requests, which
@@ -69,29 +137,33 @@ namespace UKControllerPlugin {
                     break;
                 }
 
-                // If the queue is empty, we should wait for a job
-                if (this->asynchronousTaskQueue.empty()) {
+                // If the queues are empty, we should wait for a job
+                if (this->interactiveTaskQueue.empty() && this->asynchronousTaskQueue.empty()) {
                     this->asynchronousQueueCondVar.wait(uniqueLock);
 
                     // Spurious wakeup, skip the loop
-                    if (this->asynchronousTaskQueue.empty()) {
+                    if (this->interactiveTaskQueue.empty() && this->asynchronousTaskQueue.empty()) {
                         uniqueLock.unlock();
                         continue;
                     }
                 }
 
-                // Lock the queue and copy the task off
-                currentTask = std::move(this->asynchronousTaskQueue.front());
-                this->asynchronousTaskQueue.pop_front();
+                // Take the task off, interactive tasks first
+                currentTask = this->interactiveTaskQueue.empty()
+                    ? this->TakeTask(this->asynchronousTaskQueue, this->backgroundMetrics)
+                    : this->TakeTask(this->interactiveTaskQueue, this->interactiveMetrics);
                 uniqueLock.unlock();
 
                 // Do the task
                 try {
                     currentTask();
                 }
-                catch (std::exception exception) {
+                catch (std::exception & exception) {
                     LogError("Unhandled exception in task runner " + std::string(exception.what()));
                 }
+                catch (...) {
+                    LogError("Unhandled non-standard exception in task runner");
+                }
             }
 
             LogInfo("Task runner thread " + std::to_string(threadNumber) + " stopped");
@@ -1,5 +1,6 @@
 #pragma once
 #include "task/TaskRunnerInterface.h"
+#include "task/TaskQueueMetrics.h"
 
 namespace UKControllerPlugin {
     namespace Curl {
@@ -15,6 +16,9 @@ namespace UKControllerPlugin {
 
             The primary use of this class is to run tasks that involve HTTP requests, as waiting
             for CURL on the ES thread would lock up the entire application.
+
+            There are two queues. Interactive tasks always go ahead of background tasks, so that
+            the likes of squawk assignments don't wait behind a queue of downloads.
         */
         class TaskRunner : public UKControllerPlugin::TaskManager::TaskRunnerInterface
         {
@@ -23,10 +27,29 @@ namespace UKControllerPlugin {
                 TaskRunner(const TaskRunner&) = delete;
                 ~TaskRunner(void);
                 size_t CountThreads(void) const override;
+                TaskQueueMetrics GetBackgroundMetrics(void) const;
+                TaskQueueMetrics GetInteractiveMetrics(void) const;
                 void QueueAsynchronousTask(std::function<void(void)> task) override;
+                void QueueInteractiveTask(std::function<void(void)> task) override;
 
             private:
+
+                typedef struct QueuedTask {
+                    std::function<void(void)> task;
+                    std::chrono::steady_clock::time_point queuedAt;
+                } QueuedTask;
+
+                TaskQueueMetrics GetMetrics(
+                    const std::deque<QueuedTask> & queue,
+                    const TaskQueueMetrics & metrics
+                ) const;
                 void ProcessAsynchronousTasks(int threadNumber);
+                void QueueTask(
+                    std::deque<QueuedTask> & queue,
+                    TaskQueueMetrics & metrics,
+                    std::function<void(void)> task
+                );
+                std::function<void(void)> TakeTask(std::deque<QueuedTask> & queue, TaskQueueMetrics & metrics);
 
                 // Are the threads running
                 bool threadsRunning = true;
@@ -34,13 +57,20 @@ namespace UKControllerPlugin {
                 // A vector for all the threads.
                 std::vector<std::thread> threads;
 
-                // A lock for the asynchronous queue when picking off tasks.
-                std::mutex asynchronousQueueLock;
+                // A lock for the queues when picking off tasks.
+                mutable std::mutex asynchronousQueueLock;
+
+                // The queue for background tasks - will be taken off in order once there are no interactive tasks.
+                std::deque<QueuedTask> asynchronousTaskQueue;
+
+                // The queue for interactive tasks - will be taken off in order.
+                std::deque<QueuedTask> interactiveTaskQueue;
 
-                // The master queue for asynchronous tasks - will be taken off in order.
-                std::deque <std::function<void(void)>> asynchronousTaskQueue;
+                // Metrics for each queue
+                TaskQueueMetrics backgroundMetrics;
+                TaskQueueMetrics interactiveMetrics;
 
-                // A condition variable for the asynchronous queue.
+                // A condition variable for the queues.
                 std::condition_variable asynchronousQueueCondVar;
         };
     }  // namespace TaskManager
@@ -8,6 +8,9 @@ namespace UKControllerPlugin {
             to avoid long HTTP calls stalling the main EuroScope thread. This interface delibarately
             avoids the setup and teardown methods - so that the task runner can not be shut down
             outside the setup and teardown code.
+
+            Interactive tasks are those where a controller is waiting on the result, for example
+            squawk or stand assignments, and are run ahead of any queued background tasks.
         */
         class TaskRunnerInterface
         {
@@ -15,6 +18,7 @@ namespace UKControllerPlugin {
                 virtual ~TaskRunnerInterface(void) {}
                 virtual size_t CountThreads(void) const = 0;
                 virtual void QueueAsynchronousTask(std::function<void(void)> task) = 0;
+                virtual void QueueInteractiveTask(std::function<void(void)> task) = 0;
         };
     }  // namespace TaskManager
 }  // namespace UKControllerPlugin
@@ -1,12 +1,27 @@
 #include "pch/stdafx.h"
 #include "timedevent/TimedEventCollection.h"
 #include "timedevent/AbstractTimedEvent.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "performance/ScopedHandlerTimer.h"
 
 using UKControllerPlugin::TimedEvent::AbstractTimedEvent;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using UKControllerPlugin::Performance::ScopedHandlerTimer;
 
 namespace UKControllerPlugin {
     namespace TimedEvent {
 
+        TimedEventCollection::TimedEventCollection(void)
+            : TimedEventCollection(std::make_shared<HandlerMetricsCollection>())
+        {
+
+        }
+
+        TimedEventCollection::TimedEventCollection(std::shared_ptr<HandlerMetricsCollection> metrics)
+            : metrics(metrics)
+        {
+
+        }
 
         /*
             Returns the total number of handlers.
@@ -15,8 +30,7 @@ namespace UKControllerPlugin {
         {
             int count = 0;
             for (
-                std::map<int, std::vector<std::shared_ptr<AbstractTimedEvent>>>::const_iterator it =
-                    this->eventMap.cbegin();
+                std::map<int, std::vector<RegisteredEvent>>::const_iterator it = this->eventMap.cbegin();
                 it != this->eventMap.cend();
                 ++it
             ) {
@@ -40,21 +54,20 @@ namespace UKControllerPlugin {
         void TimedEventCollection::Tick(int seconds) const
         {
             for (
-                std::map<int, std::vector<std::shared_ptr<AbstractTimedEvent>>>::const_iterator it =
-                    this->eventMap.cbegin();
+                std::map<int, std::vector<RegisteredEvent>>::const_iterator it = this->eventMap.cbegin();
                 it != this->eventMap.cend();
                 ++it
             ) {
 
                 // If we manage to find a set of events that wans to run at this time, run them all.
                 if (seconds % it->first == 0) {
-                    std::vector<std::shared_ptr<AbstractTimedEvent>> events = this->eventMap.find(it->first)->second;
                     for (
-                        std::vector<std::shared_ptr<AbstractTimedEvent>>::const_iterator itVector = events.cbegin();
-                        itVector != events.cend();
+                        std::vector<RegisteredEvent>::const_iterator itVector = it->second.cbegin();
+                        itVector != it->second.cend();
                         ++itVector
                     ) {
-                        (*itVector)->TimedEventTrigger();
+                        ScopedHandlerTimer timer(*itVector->metrics);
+                        itVector->event->TimedEventTrigger();
                     }
                 }
             }
@@ -65,7 +78,12 @@ namespace UKControllerPlugin {
         */
         void TimedEventCollection::RegisterEvent(std::shared_ptr<AbstractTimedEvent> event, int frequency)
         {
-            this->eventMap[frequency].push_back(event);
+            this->eventMap[frequency].push_back(
+                {
+                    event,
+                    this->metrics->Register("Timed " + HandlerMetricsCollection::NameFromType(typeid(*event)))
+                }
+            );
         }
     }  // namespace TimedEvent
 }  // namespace UKControllerPlugin
@@ -5,6 +5,10 @@ namespace UKControllerPlugin {
     namespace TimedEvent {
         class AbstractTimedEvent;
     }  // namespace TimedEvent
+    namespace Performance {
+        class HandlerMetrics;
+        class HandlerMetricsCollection;
+    }  // namespace Performance
 }  // namespace UKControllerPlugin
 // END
 
@@ -18,6 +22,10 @@ namespace UKControllerPlugin {
         class TimedEventCollection
         {
             public:
+                TimedEventCollection(void);
+                explicit TimedEventCollection(
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics
+                );
                 int CountHandlers(void) const;
                 int CountHandlersForFrequency(int frequency) const;
                 void Tick(int seconds) const;
@@ -27,8 +35,17 @@ namespace UKControllerPlugin {
                 );
 
             private:
-                // Vector of registered handlers
-                std::map<int, std::vector<std::shared_ptr<AbstractTimedEvent>>> eventMap;
+
+                typedef struct RegisteredEvent {
+                    std::shared_ptr<AbstractTimedEvent> event;
+                    std::shared_ptr<UKControllerPlugin::Performance::HandlerMetrics> metrics;
+                } RegisteredEvent;
+
+                // Where event metrics are kept
+                const std::shared_ptr<UKControllerPlugin::Performance::HandlerMetricsCollection> metrics;
+
+                // Registered events, by frequency
+                std::map<int, std::vector<RegisteredEvent>> eventMap;
         };
     }  // namespace TimedEvent
 }  // namespace UKControllerPlugin
@@ -20,6 +20,9 @@ namespace UKControllerPlugin {
 
             // RECAT-EU Category + Aircraft Type
             std::string aircraftTypeRecatCategoryItem = noData;
+
+            // UK Wake Category + RECAT-EU Category
+            std::string ukRecatCombinedItem = noData;
         } CacheItem;
     }  // namespace Wake
 }  // namespace UKControllerPlugin
@@ -1,8 +1,11 @@
 #include "pch/stdafx.h"
 #include "wake/WakeCategoryEventHandler.h"
 #include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "flightplan/StoredFlightplan.h"
 
 using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Tag::TagData;
 
@@ -11,9 +14,10 @@ namespace UKControllerPlugin {
 
         WakeCategoryEventHandler::WakeCategoryEventHandler(
             const WakeCategoryMapper ukMapper,
-            const WakeCategoryMapper recatMapper
+            const WakeCategoryMapper recatMapper,
+            CallsignRegistry & aircraft
         )
-            : ukMapper(ukMapper), recatMapper(recatMapper)
+            : ukMapper(ukMapper), recatMapper(recatMapper), aircraft(aircraft)
         {
 
         }
@@ -25,7 +29,15 @@ namespace UKControllerPlugin {
             EuroScopeCFlightPlanInterface & flightPlan,
             EuroScopeCRadarTargetInterface & radarTarget
         ) {
-            this->cache.erase(flightPlan.GetCallsign());
+            this->cache.Erase(this->aircraft.Find(flightPlan.GetCallsign()));
+        }
+
+        /*
+            The categories only depend on the aircraft type and the wake category filed with it.
+        */
+        unsigned int WakeCategoryEventHandler::GetFlightplanFieldDependencies(void) const
+        {
+            return StoredFlightplan::aircraftTypeChanged | StoredFlightplan::wakeCategoryChanged;
         }
 
         /*
@@ -33,7 +45,7 @@ namespace UKControllerPlugin {
         */
         void WakeCategoryEventHandler::FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface & flightPlan)
         {
-            this->cache.erase(flightPlan.GetCallsign());
+            this->cache.Erase(this->aircraft.Find(flightPlan.GetCallsign()));
         }
 
         /*
@@ -58,16 +70,28 @@ namespace UKControllerPlugin {
         */
         void WakeCategoryEventHandler::SetTagItemData(TagData& tagData)
         {
+            if (
+                tagData.itemCode != this->tagItemIdAircraftTypeCategory &&
+                tagData.itemCode != this->tagItemIdStandaloneCategory &&
+                tagData.itemCode != this->tagItemIdRecat &&
+                tagData.itemCode != this->tagItemIdUkRecatCombined &&
+                tagData.itemCode != this->tagItemIdAircraftTypeRecat
+            ) {
+                return;
+            }
+
+            // Look the aircraft up once, the item data is then copied straight out of the cache
+            CacheItem & cached = this->FirstOrNewCacheItem(tagData.flightPlan.GetCallsign());
             if (tagData.itemCode == this->tagItemIdAircraftTypeCategory) {
-                tagData.SetItemString(this->GetAircraftTypeUkCategoryTagItemData(tagData));
+                tagData.SetItemString(this->GetAircraftTypeUkCategoryTagItemData(tagData, cached));
             } else if (tagData.itemCode == this->tagItemIdStandaloneCategory) {
-                tagData.SetItemString(this->GetStandaloneTagItemData(tagData));
+                tagData.SetItemString(this->GetStandaloneTagItemData(tagData, cached));
             } else if (tagData.itemCode == this->tagItemIdRecat) {
-                tagData.SetItemString(this->GetRecatTagItemData(tagData));
+                tagData.SetItemString(this->GetRecatTagItemData(tagData, cached));
             } else if (tagData.itemCode == this->tagItemIdUkRecatCombined) {
-                tagData.SetItemString(this->GetUkRecatCombinedTagItemData(tagData));
-            } else if (tagData.itemCode == this->tagItemIdAircraftTypeRecat) {
-                tagData.SetItemString(this->GetAircraftTypeRecatCategoryTagItemData(tagData));
+                tagData.SetItemString(this->GetUkRecatCombinedTagItemData(tagData, cached));
+            } else {
+                tagData.SetItemString(this->GetAircraftTypeRecatCategoryTagItemData(tagData, cached));
             }
         }
 
@@ -83,9 +107,10 @@ namespace UKControllerPlugin {
         /*
          * Get the data for the combined Aircraft Type / UK Category item.
          */
-        std::string WakeCategoryEventHandler::GetAircraftTypeUkCategoryTagItemData(TagData& tagData)
-        {
-            CacheItem& cached = this->FirstOrNewCacheItem(tagData.flightPlan.GetCallsign());
+        const std::string & WakeCategoryEventHandler::GetAircraftTypeUkCategoryTagItemData(
+            TagData& tagData,
+            CacheItem & cached
+        ) const {
             if (cached.aircraftTypeUKCategoryItem == cached.noData)
             {
                 cached.aircraftTypeUKCategoryItem = this->GetAircraftTypeCategoryString(
@@ -101,9 +126,10 @@ namespace UKControllerPlugin {
         /*
          * Get the data for the combined Aircraft Type / RECAT-EU category item.
          */
-        std::string WakeCategoryEventHandler::GetAircraftTypeRecatCategoryTagItemData(TagData& tagData)
-        {
-            CacheItem& cached = this->FirstOrNewCacheItem(tagData.flightPlan.GetCallsign());
+        const std::string & WakeCategoryEventHandler::GetAircraftTypeRecatCategoryTagItemData(
+            TagData& tagData,
+            CacheItem & cached
+        ) const {
             if (cached.aircraftTypeRecatCategoryItem == cached.noData)
             {
                 cached.aircraftTypeRecatCategoryItem = this->GetAircraftTypeCategoryString(
@@ -119,9 +145,10 @@ namespace UKControllerPlugin {
         /*
          * Get the data for the standalone category item.
          */
-        std::string WakeCategoryEventHandler::GetStandaloneTagItemData(TagData& tagData)
-        {
-            CacheItem& cached = this->FirstOrNewCacheItem(tagData.flightPlan.GetCallsign());
+        const std::string & WakeCategoryEventHandler::GetStandaloneTagItemData(
+            TagData& tagData,
+            CacheItem & cached
+        ) const {
             if (cached.standaloneItem == cached.noData)
             {
                 cached.standaloneItem = this->GetMappedCategory(
@@ -137,9 +164,10 @@ namespace UKControllerPlugin {
         /*
          * Get the data for the RECAT-EU category item.
          */
-        std::string WakeCategoryEventHandler::GetRecatTagItemData(TagData& tagData)
-        {
-            CacheItem& cached = this->FirstOrNewCacheItem(tagData.flightPlan.GetCallsign());
+        const std::string & WakeCategoryEventHandler::GetRecatTagItemData(
+            TagData& tagData,
+            CacheItem & cached
+        ) const {
             if (cached.recatItem == cached.noData)
             {
                 cached.recatItem = this->GetMappedCategory(
@@ -155,9 +183,17 @@ namespace UKControllerPlugin {
         /*
          * Return a combination of UK and RECAT categories
          */
-        std::string WakeCategoryEventHandler::GetUkRecatCombinedTagItemData(TagData& tagData)
-        {
-            return this->GetStandaloneTagItemData(tagData) + "/" + this->GetRecatTagItemData(tagData);
+        const std::string & WakeCategoryEventHandler::GetUkRecatCombinedTagItemData(
+            TagData& tagData,
+            CacheItem & cached
+        ) const {
+            if (cached.ukRecatCombinedItem == cached.noData)
+            {
+                cached.ukRecatCombinedItem = this->GetStandaloneTagItemData(tagData, cached) + "/" +
+                    this->GetRecatTagItemData(tagData, cached);
+            }
+
+            return cached.ukRecatCombinedItem;
         }
 
         /*
@@ -190,14 +226,9 @@ namespace UKControllerPlugin {
         /*
          * Return a fresh cache item, or the current item if it exists.
          */
-        CacheItem& WakeCategoryEventHandler::FirstOrNewCacheItem(const std::string callsign)
+        CacheItem& WakeCategoryEventHandler::FirstOrNewCacheItem(const std::string & callsign)
         {
-            if (!this->cache.count(callsign))
-            {
-                this->cache[callsign] = {};
-            }
-
-            return this->cache.at(callsign);
+            return this->cache.FirstOrNew(this->aircraft.Intern(callsign));
         }
     }  // namespace Wake
 }  // namespace UKControllerPlugin
@@ -4,6 +4,8 @@
 #include "tag/TagItemInterface.h"
 #include "tag/TagData.h"
 #include "wake/CacheItem.h"
+#include "flightplan/AircraftSlotMap.h"
+#include "flightplan/CallsignRegistry.h"
 
 namespace UKControllerPlugin {
     namespace Wake {
@@ -15,9 +17,10 @@ namespace UKControllerPlugin {
             public UKControllerPlugin::Tag::TagItemInterface
         {
             public:
-                explicit WakeCategoryEventHandler(
+                WakeCategoryEventHandler(
                     const UKControllerPlugin::Wake::WakeCategoryMapper ukMapper,
-                    const UKControllerPlugin::Wake::WakeCategoryMapper recatMapper
+                    const UKControllerPlugin::Wake::WakeCategoryMapper recatMapper,
+                    UKControllerPlugin::Flightplan::CallsignRegistry & aircraft
                 );
                 void FlightPlanEvent(
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
@@ -30,6 +33,7 @@ namespace UKControllerPlugin {
                     UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
                     int dataType
                 ) override;
+                unsigned int GetFlightplanFieldDependencies(void) const override;
                 std::string GetTagItemDescription(int tagItemId) const override;
                 void SetTagItemData(UKControllerPlugin::Tag::TagData& tagData) override;
 
@@ -50,23 +54,41 @@ namespace UKControllerPlugin {
                     const std::string aircraftType,
                     const std::string defaultValue
                 ) const;
-                std::string GetAircraftTypeUkCategoryTagItemData(UKControllerPlugin::Tag::TagData& tagData);
-                std::string GetAircraftTypeRecatCategoryTagItemData(UKControllerPlugin::Tag::TagData& tagData);
-                std::string GetStandaloneTagItemData(UKControllerPlugin::Tag::TagData& tagData);
-                std::string GetRecatTagItemData(UKControllerPlugin::Tag::TagData& tagData);
-                std::string GetUkRecatCombinedTagItemData(UKControllerPlugin::Tag::TagData& tagData);
+                const std::string & GetAircraftTypeUkCategoryTagItemData(
+                    UKControllerPlugin::Tag::TagData& tagData,
+                    CacheItem & cached
+                ) const;
+                const std::string & GetAircraftTypeRecatCategoryTagItemData(
+                    UKControllerPlugin::Tag::TagData& tagData,
+                    CacheItem & cached
+                ) const;
+                const std::string & GetStandaloneTagItemData(
+                    UKControllerPlugin::Tag::TagData& tagData,
+                    CacheItem & cached
+                ) const;
+                const std::string & GetRecatTagItemData(
+                    UKControllerPlugin::Tag::TagData& tagData,
+                    CacheItem & cached
+                ) const;
+                const std::string & GetUkRecatCombinedTagItemData(
+                    UKControllerPlugin::Tag::TagData& tagData,
+                    CacheItem & cached
+                ) const;
                 std::string GetAircraftTypeCategoryString(
                     const std::string aircraftType,
                     const UKControllerPlugin::Wake::WakeCategoryMapper& mapper,
                     const std::string defaultValue
                 ) const;
-                CacheItem & FirstOrNewCacheItem(const std::string callsign);
+                CacheItem & FirstOrNewCacheItem(const std::string & callsign);
 
                 // The maximum length we can have in a tag item
                 const size_t maxItemSize = 15;
 
+                // Interns callsigns for the cache
+                UKControllerPlugin::Flightplan::CallsignRegistry & aircraft;
+
                 // Cache any data
-                std::map<std::string, CacheItem> cache;
+                UKControllerPlugin::Flightplan::AircraftSlotMap<CacheItem> cache;
 
                 // Maps categories
                 const UKControllerPlugin::Wake::WakeCategoryMapper ukMapper;
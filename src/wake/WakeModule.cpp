@@ -35,7 +35,8 @@ namespace UKControllerPlugin {
                     recatData,
                     *container.userMessager,
                     "RECAT"
-                )
+                ),
+                *container.callsignRegistry
             );
 
             container.flightplanHandler->RegisterHandler(handler);
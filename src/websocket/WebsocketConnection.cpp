@@ -8,8 +8,6 @@ using UKControllerPlugin::Plugin::PluginVersion;
 namespace UKControllerPlugin {
     namespace Websocket {
 
-        boost::beast::flat_buffer buffer_;
-
         /*
             Start connection to the websocket by resolving the host
         */
@@ -18,11 +16,12 @@ namespace UKControllerPlugin {
             std::string port
         )
             : host(host), port(port), reconnectAttemptInterval(30), idleTimeout(30),
+            strand(boost::asio::make_strand(this->ioContext)), reconnectTimer(this->strand),
             sslContext(boost::asio::ssl::context::tlsv12_client),
             workGuard(boost::asio::make_work_guard(this->ioContext))
         {
             this->ResetWebsocket();
-            this->processThread = std::thread(std::bind(&WebsocketConnection::Loop, this));
+            boost::asio::post(this->strand, std::bind(&WebsocketConnection::Connect, this));
             this->websocketThread = std::thread(std::bind(&WebsocketConnection::RunWebsocket, this));
         }
 
@@ -31,37 +30,85 @@ namespace UKControllerPlugin {
         */
         WebsocketConnection::~WebsocketConnection(void)
         {
-            this->threadsRunning = false;
-            // Stop the IO Context and wait for threads to join
+            // Stop the IO Context and wait for the thread to join
             this->ioContext.stop();
-            this->processThread.join();
             this->websocketThread.join();
 
+            // Once the IO Context has stopped, close the connection to attain graceful shutdown.
+            if (this->connected) {
+                boost::system::error_code ec;
+                this->websocket->close(boost::beast::websocket::close_code::normal, ec);
+            }
+
             LogInfo("Disconnected from websocket");
         }
 
         /*
-            Handle the connection closing
+            Set the idle timeout on the current websocket.
         */
-        void WebsocketConnection::CloseHandler(boost::system::error_code ec)
+        void WebsocketConnection::ApplyIdleTimeout(std::chrono::seconds timeout)
         {
+            boost::beast::websocket::stream_base::timeout opt{
+                std::chrono::seconds(10),
+                std::chrono::seconds(timeout),
+                true
+            };
+            this->websocket->set_option(opt);
+        }
+
+        /*
+            Handle the connection closing
+        */
+        void WebsocketConnection::CloseHandler(
+            std::shared_ptr<WebsocketStream> websocket,
+            boost::system::error_code ec
+        ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             if (ec) {
                 this->ProcessErrorCode(ec);
             }
 
-            this->ResetWebsocket();
             LogInfo("Force closed websocket connection");
+            this->ConnectionLost();
         }
 
         /*
-            Called when we try to connect to the websocket
+            Start a connection attempt by resolving the host
         */
-        void WebsocketConnection::ConnectHandler(boost::system::error_code ec)
+        void WebsocketConnection::Connect(void)
         {
+            this->lastConnectionAttempt = std::chrono::steady_clock::now();
+            this->tcpResolver->async_resolve(
+                host,
+                port,
+                std::bind(
+                    &WebsocketConnection::ResolveHandler,
+                    this,
+                    this->websocket,
+                    std::placeholders::_1,
+                    std::placeholders::_2
+                )
+            );
+        }
+
+        /*
+            Called when we try to connect to the websocket
+        */
+        void WebsocketConnection::ConnectHandler(
+            std::shared_ptr<WebsocketStream> websocket,
+            boost::system::error_code ec
+        ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             if (ec) {
                 LogWarning("Websocket: connection error");
-                this->connectionInProgress = false;
                 this->ProcessErrorCode(ec);
+                this->ConnectionLost();
                 return;
             }
 
@@ -72,6 +119,7 @@ namespace UKControllerPlugin {
                 std::bind(
                     &WebsocketConnection::SSLHandshakeHandler,
                     this,
+                    this->websocket,
                     std::placeholders::_1
                 )
             );
@@ -79,23 +127,33 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Reset the websocket, ready for a reconnection attempt
+            The connection has gone or could not be made, start again with a fresh websocket
+        */
+        void WebsocketConnection::ConnectionLost(void)
+        {
+            this->ResetWebsocket();
+            this->ScheduleReconnect();
+        }
+
+        /*
+            Reset the websocket, ready for a reconnection attempt. Anything still outstanding
+            on the old websocket is cancelled.
         */
         void WebsocketConnection::ResetWebsocket(void)
         {
             this->connected = false;
-            this->connectionInProgress = false;
-            this->asyncReadInProgress = false;
             this->asyncWriteInProgress = false;
+            this->outboundMessages.clear();
+            this->incomingBuffer.consume(this->incomingBuffer.size());
 
-            this->tcpResolver.reset(new boost::asio::ip::tcp::resolver(boost::asio::make_strand(ioContext)));
-            this->websocket.reset(
-                new boost::beast::websocket::stream<boost::beast::ssl_stream<boost::beast::tcp_stream>>(
-                    boost::asio::make_strand(ioContext), this->sslContext
-                )
-            );
+            if (this->websocket) {
+                boost::beast::get_lowest_layer(*this->websocket).close();
+            }
+
+            this->tcpResolver.reset(new boost::asio::ip::tcp::resolver(this->strand));
+            this->websocket.reset(new WebsocketStream(this->strand, this->sslContext));
 
-            this->SetIdleTimeout(std::chrono::seconds(10));
+            this->ApplyIdleTimeout(std::chrono::seconds(10));
 
             this->websocket->control_callback(
                 [](
@@ -118,93 +176,42 @@ namespace UKControllerPlugin {
         /*
             Called after connection to the websocket to negotiate a protocol upgrade
         */
-        void WebsocketConnection::HandshakeHandler(boost::system::error_code ec)
-        {
+        void WebsocketConnection::HandshakeHandler(
+            std::shared_ptr<WebsocketStream> websocket,
+            boost::system::error_code ec
+        ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             if (ec) {
                 LogWarning("Websocket: handshake error");
-                this->connectionInProgress = false;
                 this->ProcessErrorCode(ec);
+                this->ConnectionLost();
                 return;
             }
 
             this->connected = true;
-            this->connectionInProgress = false;
             this->lastActivityTime = std::chrono::system_clock::now();
             LogInfo("Websocket handshake successful");
+            this->Read();
         }
 
         /*
-            Loop that runs to send any outgoing messages and read
-            any incoming message
+            Start reading the next message from the websocket
         */
-        void WebsocketConnection::Loop(void)
+        void WebsocketConnection::Read(void)
         {
-            while (this->threadsRunning) {
-
-                std::lock_guard<std::mutex>(this->eventGuard);
-
-                // If not connected, try and connect
-                if (!this->connected) {
-                    if (!this->connectionInProgress && std::chrono::system_clock::now() > this->nextReconnectAttempt) {
-                        this->nextReconnectAttempt = std::chrono::system_clock::now() + this->reconnectAttemptInterval;
-                        this->connectionInProgress = true;
-                        this->tcpResolver->async_resolve(
-                            host,
-                            port,
-                            std::bind(
-                                &WebsocketConnection::ResolveHandler,
-                                this,
-                                std::placeholders::_1,
-                                std::placeholders::_2
-                            )
-                        );
-                    }
-                    // Sleep for a bit to give the CPU a break
-                    std::this_thread::sleep_for(std::chrono::seconds(1));
-                    continue;
-                }
-
-                // Process an inbound message if we can
-                if (!this->asyncReadInProgress) {
-                    this->asyncReadInProgress = true;
-                    this->websocket->async_read(
-                        this->incomingBuffer,
-                        std::bind(
-                            &WebsocketConnection::ReadHandler,
-                            this,
-                            std::placeholders::_1,
-                            std::placeholders::_2
-                        )
-                    );
-                }
-
-                // Process an outbound message if we can
-                if (!this->asyncWriteInProgress && !this->outboundMessages.empty()) {
-                    std::lock_guard<std::mutex> lock(this->outboundMessageQueueGuard);
-                    this->asyncWriteInProgress = true;
-                    this->websocket->async_write(
-                        boost::asio::buffer(this->outboundMessages.front()),
-                        std::bind(
-                            &WebsocketConnection::MessageSentHandler,
-                            this,
-                            std::placeholders::_1,
-                            std::placeholders::_2
-                        )
-                    );
-                    LogDebug("Sending websocket message: " + this->outboundMessages.front());
-                    this->outboundMessages.pop();
-                }
-
-                // Sleep for a bit to give the CPU a break
-                std::this_thread::sleep_for(std::chrono::seconds(1));
-            }
-
-            // Once we get the instruction to terminate, throw away all the incoming messages until we
-            // get the close signal, to attain graceful shutdown.
-            if (this->connected) {
-                boost::system::error_code ec;
-                this->websocket->close(boost::beast::websocket::close_code::normal, ec);
-            }
+            this->websocket->async_read(
+                this->incomingBuffer,
+                std::bind(
+                    &WebsocketConnection::ReadHandler,
+                    this,
+                    this->websocket,
+                    std::placeholders::_1,
+                    std::placeholders::_2
+                )
+            );
         }
 
         /*
@@ -216,55 +223,91 @@ namespace UKControllerPlugin {
         }
 
         /*
-            Called when a message has been sent by the websocket.
+            Try to connect again once the reconnect interval has passed since the last attempt
         */
-        void WebsocketConnection::MessageSentHandler(boost::system::error_code ec, std::size_t bytes_transferred)
+        void WebsocketConnection::ScheduleReconnect(void)
         {
+            this->reconnectTimer.expires_at(this->lastConnectionAttempt + this->reconnectAttemptInterval);
+            this->reconnectTimer.async_wait([this](boost::system::error_code ec) {
+                if (ec) {
+                    return;
+                }
+
+                this->Connect();
+            });
+        }
+
+        /*
+            Called when a message has been sent by the websocket. Send the next one if there is one.
+        */
+        void WebsocketConnection::MessageSentHandler(
+            std::shared_ptr<WebsocketStream> websocket,
+            boost::system::error_code ec,
+            std::size_t bytes_transferred
+        ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             this->asyncWriteInProgress = false;
             if (ec) {
                 LogWarning("Websocket: message sending error");
                 this->ProcessErrorCode(ec);
+                this->ConnectionLost();
                 return;
             }
 
             this->lastActivityTime = std::chrono::system_clock::now();
+            this->outboundMessages.pop_front();
+            if (!this->outboundMessages.empty()) {
+                this->Write();
+            }
         }
 
         /*
-            Called when a message is received. Add it to the inbound message queue.
+            Called when a message is received. Add it to the inbound message queue and start the next read.
         */
-        void WebsocketConnection::ReadHandler(boost::beast::error_code ec, std::size_t bytes_transferred)
-        {
+        void WebsocketConnection::ReadHandler(
+            std::shared_ptr<WebsocketStream> websocket,
+            boost::beast::error_code ec,
+            std::size_t bytes_transferred
+        ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             if (ec) {
-                this->asyncReadInProgress = false;
                 this->ProcessErrorCode(ec);
+                this->ConnectionLost();
                 return;
             }
 
-            if (bytes_transferred == 0) {
-                this->asyncReadInProgress = false;
-                return;
+            if (bytes_transferred != 0) {
+                LogDebug("Incoming websocket message: " + boost::beast::buffers_to_string(this->incomingBuffer.data()));
+                this->inboundMessages.Push(boost::beast::buffers_to_string(this->incomingBuffer.data()));
+                this->incomingBuffer.consume(bytes_transferred);
+                this->lastActivityTime = std::chrono::system_clock::now();
             }
 
-            LogDebug("Incoming websocket message: " + boost::beast::buffers_to_string(this->incomingBuffer.data()));
-            std::lock_guard<std::mutex> lock(this->inboundMessageQueueGuard);
-            this->inboundMessages.push(boost::beast::buffers_to_string(this->incomingBuffer.data()));
-            this->incomingBuffer.consume(bytes_transferred);
-            this->asyncReadInProgress = false;
-            this->lastActivityTime = std::chrono::system_clock::now();
+            this->Read();
         }
 
         /*
             Handle when we resolve the websocket host
         */
         void WebsocketConnection::ResolveHandler(
+            std::shared_ptr<WebsocketStream> websocket,
             boost::system::error_code ec,
             boost::asio::ip::tcp::resolver::results_type results
         ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             if (ec) {
                 LogWarning("Websocket: resolve error");
-                this->ResetWebsocket();
                 this->ProcessErrorCode(ec);
+                this->ConnectionLost();
                 return;
             }
 
@@ -274,6 +317,7 @@ namespace UKControllerPlugin {
                 std::bind(
                     &WebsocketConnection::ConnectHandler,
                     this,
+                    this->websocket,
                     std::placeholders::_1
                 )
             );
@@ -282,12 +326,18 @@ namespace UKControllerPlugin {
         /*
             Called once the SSL handshake has been performed
         */
-        void WebsocketConnection::SSLHandshakeHandler(boost::system::error_code ec)
-        {
+        void WebsocketConnection::SSLHandshakeHandler(
+            std::shared_ptr<WebsocketStream> websocket,
+            boost::system::error_code ec
+        ) {
+            if (websocket != this->websocket) {
+                return;
+            }
+
             if (ec) {
                 LogWarning("Websocket: SSL handshake error");
-                this->connectionInProgress = false;
                 this->ProcessErrorCode(ec);
+                this->ConnectionLost();
                 return;
             }
 
@@ -311,27 +361,56 @@ namespace UKControllerPlugin {
                 std::bind(
                     &WebsocketConnection::HandshakeHandler,
                     this,
+                    this->websocket,
                     std::placeholders::_1
                 )
             );
             LogInfo("Websocket: SSL Handshake Successful");
         }
 
+        /*
+            Write the message at the front of the outbound queue
+        */
+        void WebsocketConnection::Write(void)
+        {
+            this->asyncWriteInProgress = true;
+            LogDebug("Sending websocket message: " + this->outboundMessages.front());
+            this->websocket->async_write(
+                boost::asio::buffer(this->outboundMessages.front()),
+                std::bind(
+                    &WebsocketConnection::MessageSentHandler,
+                    this,
+                    this->websocket,
+                    std::placeholders::_1,
+                    std::placeholders::_2
+                )
+            );
+        }
+
         bool WebsocketConnection::IsConnected(void) const
         {
             return this->connected;
         }
 
         /*
-            Add a message to the outbound queue
+            Add a message to the outbound queue, sending it straight away if nothing else is being sent.
         */
         void WebsocketConnection::WriteMessage(std::string message)
         {
-            std::lock_guard<std::mutex> lock(this->inboundMessageQueueGuard);
             if (!this->connected) {
                 return;
             }
-            this->outboundMessages.push(message);
+
+            boost::asio::post(this->strand, [this, message]() {
+                if (!this->connected) {
+                    return;
+                }
+
+                this->outboundMessages.push_back(message);
+                if (!this->asyncWriteInProgress) {
+                    this->Write();
+                }
+            });
         }
 
         /*
@@ -339,13 +418,8 @@ namespace UKControllerPlugin {
         */
         std::string WebsocketConnection::GetNextMessage(void)
         {
-            std::lock_guard<std::mutex> lock(this->inboundMessageQueueGuard);
-            if (this->inboundMessages.empty()) {
-                return this->noMessage;
-            }
-            std::string message = this->inboundMessages.front();
-            this->inboundMessages.pop();
-            return message;
+            std::string message;
+            return this->inboundMessages.TryPop(message) ? message : this->noMessage;
         }
 
         /*
@@ -353,12 +427,7 @@ namespace UKControllerPlugin {
         */
         void WebsocketConnection::SetIdleTimeout(std::chrono::seconds timeout)
         {
-            boost::beast::websocket::stream_base::timeout opt{
-                std::chrono::seconds(10),
-                std::chrono::seconds(timeout),
-                true
-            };
-            this->websocket->set_option(opt);
+            boost::asio::post(this->strand, std::bind(&WebsocketConnection::ApplyIdleTimeout, this, timeout));
         }
 
         /*
@@ -367,7 +436,7 @@ namespace UKControllerPlugin {
         std::chrono::seconds WebsocketConnection::GetTimeSinceLastActivity(void) const
         {
             return std::chrono::duration_cast<std::chrono::seconds>(
-                std::chrono::system_clock::now() - this->lastActivityTime
+                std::chrono::system_clock::now() - this->lastActivityTime.load()
             );
         }
 
@@ -376,24 +445,26 @@ namespace UKControllerPlugin {
         */
         void WebsocketConnection::ForceDisconnect(void)
         {
-            std::lock_guard<std::mutex>(this->eventGuard);
-            if (!this->connected) {
-                return;
-            }
+            boost::asio::post(this->strand, [this]() {
+                if (!this->connected) {
+                    return;
+                }
 
-            LogInfo("Forcing disconnect from websocket");
-            this->websocket->async_close(
-                boost::beast::websocket::close_code::normal,
-                std::bind(
-                    &WebsocketConnection::CloseHandler,
-                    this,
-                    std::placeholders::_1
-                )
-            );
+                LogInfo("Forcing disconnect from websocket");
+                this->websocket->async_close(
+                    boost::beast::websocket::close_code::normal,
+                    std::bind(
+                        &WebsocketConnection::CloseHandler,
+                        this,
+                        this->websocket,
+                        std::placeholders::_1
+                    )
+                );
+            });
         }
 
         /*
-            Processes an error code from the websocket.
+            Logs an error code from the websocket.
         */
         void WebsocketConnection::ProcessErrorCode(boost::system::error_code ec)
         {
@@ -409,7 +480,6 @@ namespace UKControllerPlugin {
                 ec == boost::beast::websocket::error::closed ||
                 ec.value() == 1236  // The network connection was aborted by the local system
             ) {
-                this->ResetWebsocket();
                 LogWarning("Disconnected from websocket: " + ec.message());
                 return;
             }
@@ -1,5 +1,6 @@
 #pragma once
 #include "websocket/WebsocketConnectionInterface.h"
+#include "task/LockFreeQueue.h"
 
 namespace UKControllerPlugin {
     namespace Websocket {
@@ -7,6 +8,10 @@ namespace UKControllerPlugin {
         /*
             Class that handles all of UKCPs connections to the
             APIs websocket.
+
+            All websocket operations run on a single strand. Once connected, each read
+            starts the next as soon as it completes and queued messages are written back to
+            back, so nothing waits on a polling interval.
         */
         class WebsocketConnection : public UKControllerPlugin::Websocket::WebsocketConnectionInterface
         {
@@ -31,19 +36,37 @@ namespace UKControllerPlugin {
 
             private:
 
-                void CloseHandler(boost::system::error_code ec);
-                void ConnectHandler(boost::system::error_code ec);
+                typedef boost::beast::websocket::stream<
+                    boost::beast::ssl_stream<boost::beast::tcp_stream>
+                > WebsocketStream;
+
+                void ApplyIdleTimeout(std::chrono::seconds timeout);
+                void CloseHandler(std::shared_ptr<WebsocketStream> websocket, boost::system::error_code ec);
+                void Connect(void);
+                void ConnectHandler(std::shared_ptr<WebsocketStream> websocket, boost::system::error_code ec);
+                void ConnectionLost(void);
                 void ResetWebsocket(void);
-                void HandshakeHandler(boost::system::error_code ec);
-                void Loop(void);
+                void HandshakeHandler(std::shared_ptr<WebsocketStream> websocket, boost::system::error_code ec);
+                void Read(void);
                 void RunWebsocket(void);
-                void MessageSentHandler(boost::system::error_code ec, std::size_t bytes_transferred);
-                void ReadHandler(boost::beast::error_code ec, std::size_t bytes_transferred);
+                void ScheduleReconnect(void);
+                void MessageSentHandler(
+                    std::shared_ptr<WebsocketStream> websocket,
+                    boost::system::error_code ec,
+                    std::size_t bytes_transferred
+                );
+                void ReadHandler(
+                    std::shared_ptr<WebsocketStream> websocket,
+                    boost::beast::error_code ec,
+                    std::size_t bytes_transferred
+                );
                 void ResolveHandler(
+                    std::shared_ptr<WebsocketStream> websocket,
                     boost::system::error_code ec,
                     boost::asio::ip::tcp::resolver::results_type results
                 );
-                void SSLHandshakeHandler(boost::system::error_code ec);
+                void SSLHandshakeHandler(std::shared_ptr<WebsocketStream> websocket, boost::system::error_code ec);
+                void Write(void);
 
                 void ProcessErrorCode(boost::system::error_code ec);
 
@@ -59,59 +82,46 @@ namespace UKControllerPlugin {
                 // Io context
                 boost::asio::io_context ioContext;
 
+                // Every websocket operation and handler runs on this strand
+                boost::asio::strand<boost::asio::io_context::executor_type> strand;
+
+                // Waits until the next reconnection attempt
+                boost::asio::steady_timer reconnectTimer;
+
                 // Resolving addresses
                 std::shared_ptr<boost::asio::ip::tcp::resolver> tcpResolver;
 
                 // SSL Context
                 boost::asio::ssl::context sslContext;
 
-                // The websocket itself
-                std::shared_ptr<
-                    boost::beast::websocket::stream<boost::beast::ssl_stream<boost::beast::tcp_stream>>
-                > websocket;
+                // The websocket itself, replaced on every reconnection. Handlers are given the
+                // websocket they were started on, so that they can ignore connections that have gone.
+                std::shared_ptr<WebsocketStream> websocket;
 
                 // The thread we're using to run the websocket.
                 std::thread websocketThread;
 
-                // The thread we're using to process websocket messages.
-                std::thread processThread;
-
-                // Messages that are yet to be processed by the rest of the plugin
-                std::queue<std::string> inboundMessages;
-
-                // Protects the inbound messages queue
-                std::mutex inboundMessageQueueGuard;
-
-                // Messages that are to be sent
-                std::queue<std::string> outboundMessages;
-
-                // Protects the outbound messages queue
-                std::mutex outboundMessageQueueGuard;
-
-                // Protects the websocket whilst an event takes place
-                std::mutex eventGuard;
-
-                // Are we connected
-                bool connected = false;
-
-                // Are we trying to connect at the moment?
-                bool connectionInProgress;
+                // Messages that are yet to be processed by the rest of the plugin, pushed on the strand
+                UKControllerPlugin::TaskManager::LockFreeQueue<std::string> inboundMessages;
 
-                // Threads are running
-                bool threadsRunning = true;
+                // Messages that are to be sent, only touched on the strand. The front message is
+                // the one being written.
+                std::deque<std::string> outboundMessages;
 
-                // Is an async read in progress?
-                bool asyncReadInProgress = false;
+                // Are we connected, written on the strand and read from the plugin thread
+                std::atomic<bool> connected { false };
 
                 // Is an async write in progress?
                 bool asyncWriteInProgress = false;
 
-                // The last time something happened
-                std::chrono::system_clock::time_point lastActivityTime;
+                // The last time something happened, written on the strand and read from the plugin thread
+                std::atomic<std::chrono::system_clock::time_point> lastActivityTime {
+                    std::chrono::system_clock::time_point()
+                };
 
-                // The next time to try reconnecting
-                std::chrono::system_clock::time_point nextReconnectAttempt =
-                    (std::chrono::system_clock::time_point::min)();
+                // The time of the last connection attempt
+                std::chrono::steady_clock::time_point lastConnectionAttempt =
+                    (std::chrono::steady_clock::time_point::min)();
 
                 // How long to allow idling for.
                 std::chrono::seconds idleTimeout;
@@ -199,6 +199,23 @@ namespace UKControllerPlugin {
             PlaySound(sound, this->dllInstance, SND_ASYNC | SND_RESOURCE);
         }
 
+        /*
+            Write data to a local file byte for byte, replacing anything that's already there.
+        */
+        void WinApi::WriteBinaryToFile(std::wstring filename, std::string data)
+        {
+            std::wstring newFilename = this->GetFullPathToLocalFile(filename);
+            this->CreateMissingDirectories(newFilename);
+            std::ofstream file(newFilename, std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+
+            if (!file.is_open()) {
+                LogWarning("Binary file not opened for writing: " + HelperFunctions::ConvertToRegularString(filename));
+                return;
+            }
+
+            file.write(data.data(), data.size());
+        }
+
         /*
             Write a given string into a file.
         */
@@ -242,6 +259,37 @@ namespace UKControllerPlugin {
             }
         }
 
+        /*
+            Return the entire contents of a local file, byte for byte, in a single read.
+        */
+        std::string WinApi::ReadBinaryFromFile(std::wstring filename)
+        {
+            std::ifstream file(
+                this->GetFullPathToLocalFile(filename),
+                std::ifstream::in | std::ifstream::binary | std::ifstream::ate
+            );
+
+            if (!file.is_open()) {
+                LogWarning("Binary file not opened for reading: " + HelperFunctions::ConvertToRegularString(filename));
+                return "";
+            }
+
+            std::streampos size = file.tellg();
+            if (size == std::streampos(-1)) {
+                LogWarning("Unable to size binary file: " + HelperFunctions::ConvertToRegularString(filename));
+                return "";
+            }
+
+            std::string data(static_cast<size_t>(size), '\0');
+            file.seekg(0);
+            if (!file.read(&data[0], data.size())) {
+                LogWarning("Unable to read binary file: " + HelperFunctions::ConvertToRegularString(filename));
+                return "";
+            }
+
+            return data;
+        }
+
         /*
             Return the entire contents of a file as a string.
         */
@@ -30,8 +30,10 @@ namespace UKControllerPlugin {
                 int OpenMessageBox(LPCWSTR message, LPCWSTR title, int options) override;
                 void OpenWebBrowser(std::wstring url) override;
                 void PlayWave(LPCTSTR sound);
+                std::string ReadBinaryFromFile(std::wstring filename) override;
                 std::string ReadFromFile(std::wstring filename, bool relativePath = true) override;
                 bool SetPermissions(std::wstring fileOrFolder, std::filesystem::perms permissions) override;
+                void WriteBinaryToFile(std::wstring filename, std::string data) override;
                 void WriteToFile(std::wstring filename, std::string data, bool truncate) override;
 
                 // Inherited via DialogProviderInterface
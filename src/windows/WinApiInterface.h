@@ -36,8 +36,10 @@ namespace UKControllerPlugin {
             virtual int OpenMessageBox(LPCWSTR message, LPCWSTR title, int options) = 0;
             virtual void OpenWebBrowser(std::wstring url) = 0;
             virtual void PlayWave(LPCTSTR sound) = 0;
+            virtual std::string ReadBinaryFromFile(std::wstring filename) = 0;
             virtual std::string ReadFromFile(std::wstring filename, bool relativePath = true) = 0;
             virtual bool SetPermissions(std::wstring fileOrFolder, std::filesystem::perms permissions) = 0;
+            virtual void WriteBinaryToFile(std::wstring filename, std::string data) = 0;
             virtual void WriteToFile(std::wstring filename, std::string data, bool truncate) = 0;
 
         private:
@@ -0,0 +1,147 @@
+#include "pch/pch.h"
+#include "airfield/AirfieldCollection.h"
+#include "airfield/AirfieldModel.h"
+#include "controller/ActiveCallsign.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "controller/ControllerPosition.h"
+#include "ownership/AirfieldOwnershipManager.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Airfield::AirfieldCollection;
+using UKControllerPlugin::Airfield::AirfieldModel;
+using UKControllerPlugin::Controller::ActiveCallsign;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Controller::ControllerPosition;
+using UKControllerPlugin::Ownership::AirfieldOwnershipManager;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Replays an evening of controllers logging on and off around the UK, comparing the cost
+            of refreshing every airfield in the controller's topdown order against only updating the
+            airfields that the position is in the ownership order of.
+
+            Each of the 120 airfields has a ground and tower, every three share an approach, every
+            twenty share a sector and London sits on top of them all.
+        */
+        class AirfieldOwnershipBenchmark : public Test
+        {
+            public:
+                AirfieldOwnershipBenchmark()
+                {
+                    std::map<std::string, std::vector<std::string>> topdowns;
+                    std::vector<std::string> icaos;
+                    for (int airfield = 0; airfield < airfieldCount; airfield++) {
+                        std::string icao = std::string("EG") + static_cast<char>('A' + airfield / 26) +
+                            static_cast<char>('A' + airfield % 26);
+                        std::vector<std::string> ownership = {
+                            icao + "_GND",
+                            icao + "_TWR",
+                            "APP" + std::to_string(airfield / 3) + "_APP",
+                            "SECTOR" + std::to_string(airfield / 20) + "_CTR",
+                            "LON_CTR"
+                        };
+
+                        for (const std::string & position : ownership) {
+                            topdowns[position].push_back(icao);
+                        }
+
+                        icaos.push_back(icao);
+                        this->incrementalAirfields.AddAirfield(std::make_unique<AirfieldModel>(icao, ownership));
+                        this->topdownAirfields.AddAirfield(std::make_unique<AirfieldModel>(icao, ownership));
+                    }
+
+                    for (const std::pair<const std::string, std::vector<std::string>> & topdown : topdowns) {
+                        this->positions.push_back(
+                            std::make_unique<ControllerPosition>(topdown.first, 199.998, "TWR", topdown.second)
+                        );
+                    }
+
+                    this->icaos = icaos;
+                }
+
+                /*
+                    A busy evening, where a random position logs on if it isn't staffed and off if it is.
+                */
+                std::vector<size_t> Evening(void) const
+                {
+                    std::vector<size_t> events;
+                    unsigned int seed = 1234;
+                    for (int event = 0; event < eventCount; event++) {
+                        seed = seed * 1103515245 + 12345;
+                        events.push_back((seed >> 8) % this->positions.size());
+                    }
+
+                    return events;
+                }
+
+                /*
+                    Replays the evening, calling the refresh function after each logon and logoff.
+                */
+                template <typename RefreshFunction>
+                long long Replay(
+                    std::string name,
+                    ActiveCallsignCollection & activeCallsigns,
+                    RefreshFunction refresh
+                ) {
+                    std::chrono::nanoseconds total(0);
+                    for (size_t positionIndex : this->Evening()) {
+                        const ControllerPosition & position = *this->positions[positionIndex];
+                        ActiveCallsign callsign(position.GetCallsign(), "Testy McTestface", position);
+
+                        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                        if (activeCallsigns.CallsignActive(position.GetCallsign())) {
+                            activeCallsigns.RemoveCallsign(callsign);
+                        } else {
+                            activeCallsigns.AddCallsign(callsign);
+                        }
+                        refresh(position);
+                        total += std::chrono::steady_clock::now() - start;
+                    }
+
+                    long long perEvent = total.count() / eventCount;
+                    std::cout << name << ": " << perEvent / 1000.0 << "us per logon or logoff" << std::endl;
+                    return perEvent;
+                }
+
+                static constexpr int airfieldCount = 120;
+                static constexpr int eventCount = 5000;
+
+                std::vector<std::string> icaos;
+                std::vector<std::unique_ptr<ControllerPosition>> positions;
+
+                AirfieldCollection topdownAirfields;
+                ActiveCallsignCollection topdownCallsigns;
+                AirfieldOwnershipManager topdownManager{ topdownAirfields, topdownCallsigns };
+
+                AirfieldCollection incrementalAirfields;
+                ActiveCallsignCollection incrementalCallsigns;
+                AirfieldOwnershipManager incrementalManager{ incrementalAirfields, incrementalCallsigns };
+        };
+
+        TEST_F(AirfieldOwnershipBenchmark, ItUpdatesOnlyTheAffectedAirfields)
+        {
+            this->Replay(
+                "Every airfield in the topdown",
+                this->topdownCallsigns,
+                [this](const ControllerPosition & position) {
+                    for (const std::string & icao : position.GetTopdown()) {
+                        this->topdownManager.RefreshOwner(icao);
+                    }
+                }
+            );
+
+            this->Replay("Incremental", this->incrementalCallsigns, [this](const ControllerPosition & position) {
+                this->incrementalManager.RefreshOwnersForPosition(position);
+            });
+
+            for (const std::string & icao : this->icaos) {
+                EXPECT_EQ(
+                    this->topdownManager.GetOwner(icao).GetCallsign(),
+                    this->incrementalManager.GetOwner(icao).GetCallsign()
+                ) << icao;
+            }
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,103 @@
+#include "pch/pch.h"
+#include "benchmark/AllocationCounter.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        // Whether or not we're counting allocations on this thread
+        thread_local bool counting = false;
+
+        // The number of allocations made on this thread whilst counting
+        thread_local size_t allocations = 0;
+
+        /*
+            Start counting allocations on this thread.
+        */
+        void AllocationCounter::Start(void)
+        {
+            counting = true;
+        }
+
+        /*
+            Stop counting allocations on this thread.
+        */
+        void AllocationCounter::Stop(void)
+        {
+            counting = false;
+        }
+
+        bool AllocationCounter::IsCounting(void)
+        {
+            return counting;
+        }
+
+        /*
+            Returns the total number of allocations counted on this thread. The value is
+            monotonic so callers should take the difference between two readings.
+        */
+        size_t AllocationCounter::GetAllocations(void)
+        {
+            return allocations;
+        }
+
+        void AllocationCounter::RecordAllocation(void)
+        {
+            if (counting) {
+                allocations++;
+            }
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
+
+using UKControllerPluginTest::Benchmark::AllocationCounter;
+
+/*
+    Replacements for the global allocation functions, so that we can count
+    how many times the code under benchmark hits the heap.
+*/
+void * operator new(size_t size)
+{
+    AllocationCounter::RecordAllocation();
+    void * memory = std::malloc(size == 0 ? 1 : size);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    AllocationCounter::RecordAllocation();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void * operator new[](size_t size, const std::nothrow_t & tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void * memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void * memory, size_t size) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void * memory, size_t size) noexcept
+{
+    std::free(memory);
+}
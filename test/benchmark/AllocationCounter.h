@@ -0,0 +1,24 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Counts heap allocations made on the current thread whilst counting is enabled.
+
+            The test executable replaces the global operator new so that every allocation
+            made by the plugin code under benchmark passes through here. Counting is per-thread
+            so that background threads (e.g. the task runner) don't pollute the figures for
+            the EuroScope thread that is being replayed.
+        */
+        class AllocationCounter
+        {
+            public:
+                static void Start(void);
+                static void Stop(void);
+                static bool IsCounting(void);
+                static size_t GetAllocations(void);
+                static void RecordAllocation(void);
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            A self-signed certificate for localhost in PEM format, and its private key, for the
+            benchmark servers that need TLS. As it is self-signed, the certificate is also its
+            own certificate authority.
+        */
+        extern const char * benchmarkCertificate;
+        extern const char * benchmarkPrivateKey;
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,124 @@
+#include "pch/pch.h"
+#include "controller/ControllerPosition.h"
+#include "controller/ControllerPositionCollection.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Controller::ControllerPosition;
+using UKControllerPlugin::Controller::ControllerPositionCollection;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Measures matching controller updates to positions, as happens every time an online
+            controller sends an update, against the old approach of checking every position.
+        */
+        class ControllerPositionLookupBenchmark : public Test
+        {
+            public:
+                ControllerPositionLookupBenchmark()
+                {
+                    const std::vector<std::string> types = { "DEL", "GND", "TWR", "APP", "CTR" };
+                    for (int position = 0; position < positionCount; position++) {
+                        std::string facility = position % 5 == 4
+                            ? "LON_" + std::to_string(position)
+                            : "EG" + std::string(1, 'A' + position / 26 % 26) + std::string(1, 'A' + position % 26);
+                        std::string type = types[position % 5];
+                        double frequency = 118.000 + (position * 37 % 1000) * 0.025;
+
+                        this->positions.push_back(
+                            std::make_unique<ControllerPosition>(
+                                facility + "_" + type,
+                                frequency,
+                                type,
+                                std::vector<std::string> {}
+                            )
+                        );
+                        this->collection.AddPosition(
+                            std::make_unique<ControllerPosition>(
+                                facility + "_" + type,
+                                frequency,
+                                type,
+                                std::vector<std::string> {}
+                            )
+                        );
+                    }
+                }
+
+                /*
+                    The lookup as it was before the index.
+                */
+                const ControllerPosition * FindLinear(
+                    const std::string & facility,
+                    const std::string & type,
+                    double frequency
+                ) const {
+                    const ControllerPosition * match = nullptr;
+                    for (const std::unique_ptr<ControllerPosition> & position : this->positions) {
+                        if (
+                            fabs(frequency - position->GetFrequency()) < 0.001 &&
+                            position->GetUnit() == facility &&
+                            position->GetType() == type &&
+                            (match == nullptr || position->GetCallsign() < match->GetCallsign())
+                        ) {
+                            match = position.get();
+                        }
+                    }
+
+                    return match;
+                }
+
+                // Roughly the number of positions in the UK
+                static constexpr int positionCount = 600;
+
+                // Online controllers sending updates
+                static constexpr int onlineCount = 150;
+
+                // How many rounds of updates to measure
+                const int rounds = 200;
+
+                std::vector<std::unique_ptr<ControllerPosition>> positions;
+                ControllerPositionCollection collection;
+        };
+
+        TEST_F(ControllerPositionLookupBenchmark, ItMatchesControllersFasterThanCheckingEveryPosition)
+        {
+            size_t linearMatches = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int round = 0; round < this->rounds; round++) {
+                for (int online = 0; online < onlineCount; online++) {
+                    const ControllerPosition & position = *this->positions[online * 4];
+                    linearMatches += this->FindLinear(
+                        position.GetUnit(),
+                        position.GetType(),
+                        position.GetFrequency()
+                    ) != nullptr;
+                }
+            }
+            std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+
+            size_t indexedMatches = 0;
+            for (int round = 0; round < this->rounds; round++) {
+                for (int online = 0; online < onlineCount; online++) {
+                    const ControllerPosition & position = *this->positions[online * 4];
+                    indexedMatches += this->collection.FetchPositionByFacilityTypeAndFrequency(
+                        position.GetUnit(),
+                        position.GetType(),
+                        position.GetFrequency()
+                    ).GetCallsign() == position.GetCallsign();
+                }
+            }
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+            long long updates = static_cast<long long>(this->rounds) * onlineCount;
+            std::cout << "Linear lookup: "
+                << std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count() / updates
+                << "ns, indexed lookup: "
+                << std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count() / updates
+                << "ns per update" << std::endl;
+
+            EXPECT_EQ(updates, linearMatches);
+            EXPECT_EQ(updates, indexedMatches);
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,114 @@
+#include "pch/pch.h"
+#include "benchmark/BenchmarkCertificate.h"
+#include "benchmark/StandInHttpsServer.h"
+#include "curl/CurlApi.h"
+#include "curl/CurlRequest.h"
+#include "curl/PooledCurlApi.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Curl::CurlApi;
+using UKControllerPlugin::Curl::CurlInterface;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Curl::PooledCurlApi;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Sends a burst of requests to a stand-in HTTPS API from as many threads as the task runner has,
+            as happens when squawks are requested at login, and compares a new handle per request against
+            pooled handles.
+        */
+        class CurlPoolBenchmark : public Test
+        {
+            public:
+                CurlPoolBenchmark()
+                    : server([](std::string target) { return "{\"target\": \"" + target + "\"}"; }, latency)
+                {
+                    std::ofstream certificateFile(this->certificateAuthority, std::ios::out | std::ios::trunc);
+                    certificateFile << benchmarkCertificate;
+                }
+
+                ~CurlPoolBenchmark()
+                {
+                    std::filesystem::remove(this->certificateAuthority);
+                }
+
+                /*
+                    Make every request, checking the responses, and report the throughput and latency.
+                */
+                void MakeRequests(CurlInterface & curl, std::string name)
+                {
+                    std::vector<std::chrono::microseconds> latencies(threads * requestsPerThread);
+                    std::vector<std::thread> senders;
+                    std::atomic<int> failures(0);
+
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    for (int thread = 0; thread < threads; thread++) {
+                        senders.push_back(std::thread([this, thread, &curl, &latencies, &failures]() {
+                            for (int request = 0; request < requestsPerThread; request++) {
+                                std::string target = "/squawk-assignment/BAW" + std::to_string(thread * 1000 + request);
+                                std::chrono::steady_clock::time_point requestStart = std::chrono::steady_clock::now();
+                                CurlResponse response = curl.MakeCurlRequest(
+                                    CurlRequest(this->server.GetUrl() + target, CurlRequest::METHOD_GET)
+                                );
+                                latencies[thread * requestsPerThread + request] =
+                                    std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - requestStart
+                                    );
+
+                                if (
+                                    !response.StatusOk() ||
+                                    nlohmann::json::parse(response.GetResponse()).at("target") != target
+                                ) {
+                                    failures++;
+                                }
+                            }
+                        }));
+                    }
+
+                    for (std::thread & sender : senders) {
+                        sender.join();
+                    }
+                    std::chrono::microseconds total = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start
+                    );
+
+                    EXPECT_EQ(0, failures);
+                    std::sort(latencies.begin(), latencies.end());
+                    std::cout << name << ": " << latencies.size() * 1000000 / total.count() << " requests/sec, p50 "
+                        << latencies[latencies.size() / 2].count() << "us, p99 "
+                        << latencies[latencies.size() * 99 / 100].count() << "us, "
+                        << this->server.CountConnections() << " connections" << std::endl;
+                }
+
+                // The task runner has three threads
+                static constexpr int threads = 3;
+                static constexpr int requestsPerThread = 100;
+
+                // Roughly how long the API takes to do the work for a request
+                const std::chrono::milliseconds latency = std::chrono::milliseconds(1);
+
+                const std::string certificateAuthority =
+                    (std::filesystem::temp_directory_path() / "ukcp-benchmark-ca.pem").string();
+
+                StandInHttpsServer server;
+        };
+
+        TEST_F(CurlPoolBenchmark, ItReportsTheCostOfANewHandlePerRequest)
+        {
+            CurlApi curl(this->certificateAuthority);
+            this->MakeRequests(curl, "New handle per request");
+            EXPECT_EQ(threads * requestsPerThread, this->server.CountConnections());
+        }
+
+        TEST_F(CurlPoolBenchmark, ItReportsTheCostOfPooledHandles)
+        {
+            PooledCurlApi curl(true, PooledCurlApi::defaultMaxIdleHandles, this->certificateAuthority);
+            this->MakeRequests(curl, "Pooled handles");
+            EXPECT_GE(threads, this->server.CountConnections());
+            EXPECT_EQ(this->server.CountConnections(), curl.CountIdleHandles());
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,151 @@
+#include "pch/pch.h"
+#include "benchmark/StandInApiServer.h"
+#include "api/ApiHelper.h"
+#include "api/ApiRequestBuilder.h"
+#include "curl/CurlApi.h"
+#include "dependency/DependencyLoader.h"
+#include "dependency/UpdateDependencies.h"
+#include "mock/MockWinApi.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Test;
+using UKControllerPlugin::Api::ApiHelper;
+using UKControllerPlugin::Api::ApiRequestBuilder;
+using UKControllerPlugin::Curl::CurlApi;
+using UKControllerPlugin::Dependency::DependencyLoader;
+using UKControllerPlugin::Dependency::UpdateDependencies;
+using UKControllerPlugin::Dependency::defaultConcurrentDownloads;
+using UKControllerPluginTest::Windows::MockWinApi;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Downloads a full set of dependencies from a stand-in API with a realistic round trip time, one
+            at a time and then concurrently, and compares loading them back off the filesystem with using
+            what was downloaded.
+        */
+        class DependencyDownloadBenchmark : public Test
+        {
+            public:
+                DependencyDownloadBenchmark()
+                    : server(
+                        [this](std::string target) { return this->Respond(target); },
+                        std::chrono::milliseconds(25)
+                    ),
+                    api(curl, ApiRequestBuilder(server.GetUrl(), "key"), mockWindows)
+                {
+                    // Keep what gets written, so that it can be read back
+                    ON_CALL(this->mockWindows, WriteToFile(_, _, _))
+                        .WillByDefault(testing::Invoke([this](std::wstring path, std::string contents, bool) {
+                            this->files[path] = contents;
+                        }));
+                    ON_CALL(this->mockWindows, FileExists(_))
+                        .WillByDefault(testing::Invoke([this](std::wstring path) {
+                            return this->files.count(path) == 1;
+                        }));
+                    ON_CALL(this->mockWindows, ReadFromFileMock(_, _))
+                        .WillByDefault(testing::Invoke([this](std::wstring path, bool) {
+                            return this->files.at(path);
+                        }));
+                }
+
+                /*
+                    Serve up the dependency list or a dependency with a few hundred entries in.
+                */
+                std::string Respond(std::string target)
+                {
+                    nlohmann::json response = nlohmann::json::array();
+                    if (target == "/dependency") {
+                        for (int dependency = 0; dependency < dependencyCount; dependency++) {
+                            response.push_back(
+                                {
+                                    {"key", "DEPENDENCY_" + std::to_string(dependency)},
+                                    {"local_file", "dependency" + std::to_string(dependency) + ".json"},
+                                    {"uri", this->server.GetUrl() + "/dependency/" + std::to_string(dependency)},
+                                    {"updated_at", 1}
+                                }
+                            );
+                        }
+
+                        return response.dump();
+                    }
+
+                    for (int entry = 0; entry < 500; entry++) {
+                        response.push_back(
+                            {
+                                {"id", entry},
+                                {"identifier", target + "/" + std::to_string(entry)},
+                                {"latitude", 51.0 + entry * 0.001},
+                                {"longitude", -1.0 + entry * 0.001}
+                            }
+                        );
+                    }
+                    return response.dump();
+                }
+
+                /*
+                    Update the dependencies from scratch, returning how long it took.
+                */
+                std::chrono::milliseconds TimeUpdate(size_t concurrentDownloads)
+                {
+                    this->files.clear();
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    this->downloaded = UpdateDependencies(this->api, this->mockWindows, concurrentDownloads);
+                    return std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - start
+                    );
+                }
+
+                /*
+                    Load every dependency, returning how long it took.
+                */
+                std::chrono::microseconds TimeLoad(DependencyLoader & loader)
+                {
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    for (int dependency = 0; dependency < dependencyCount; dependency++) {
+                        EXPECT_EQ(500, loader.LoadDependency("DEPENDENCY_" + std::to_string(dependency), {}).size());
+                    }
+                    return std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start
+                    );
+                }
+
+                static constexpr int dependencyCount = 30;
+
+                std::map<std::wstring, std::string> files;
+                std::map<std::string, nlohmann::json> downloaded;
+                NiceMock<MockWinApi> mockWindows;
+                StandInApiServer server;
+                CurlApi curl;
+                ApiHelper api;
+        };
+
+        TEST_F(DependencyDownloadBenchmark, ItReportsTheTimeToDownloadDependencies)
+        {
+            std::chrono::milliseconds oneAtATime = this->TimeUpdate(1);
+            EXPECT_EQ(dependencyCount, this->downloaded.size());
+
+            std::chrono::milliseconds concurrent = this->TimeUpdate(defaultConcurrentDownloads);
+            EXPECT_EQ(dependencyCount, this->downloaded.size());
+
+            std::cout << "Dependency update: " << oneAtATime.count() << "ms one at a time, " << concurrent.count()
+                << "ms with " << defaultConcurrentDownloads << " concurrent downloads" << std::endl;
+        }
+
+        TEST_F(DependencyDownloadBenchmark, ItReportsTheTimeToLoadDependencies)
+        {
+            this->TimeUpdate(defaultConcurrentDownloads);
+
+            DependencyLoader fromFiles(this->mockWindows);
+            std::chrono::microseconds readBack = this->TimeLoad(fromFiles);
+
+            DependencyLoader fromDownloads(this->mockWindows, this->downloaded);
+            std::chrono::microseconds handedOver = this->TimeLoad(fromDownloads);
+
+            std::cout << "Dependency load: " << readBack.count() << "us reading back from files, "
+                << handedOver.count() << "us using the downloads" << std::endl;
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
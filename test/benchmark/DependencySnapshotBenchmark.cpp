@@ -0,0 +1,110 @@
+#include "pch/pch.h"
+#include "dependency/DependencyLoader.h"
+#include "mock/MockWinApi.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Test;
+using UKControllerPlugin::Dependency::DependencyLoader;
+using UKControllerPluginTest::Windows::MockWinApi;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Compares loading a full set of dependencies at startup from the JSON files against
+            loading them from the binary snapshot that the previous startup left behind.
+        */
+        class DependencySnapshotBenchmark : public Test
+        {
+            public:
+                DependencySnapshotBenchmark()
+                {
+                    ON_CALL(this->mockWindows, WriteBinaryToFile(_, _))
+                        .WillByDefault(testing::Invoke([this](std::wstring path, std::string contents) {
+                            this->files[path] = contents;
+                        }));
+                    ON_CALL(this->mockWindows, ReadBinaryFromFile(_))
+                        .WillByDefault(testing::Invoke([this](std::wstring path) {
+                            return this->files.at(path);
+                        }));
+                    ON_CALL(this->mockWindows, FileExists(_))
+                        .WillByDefault(testing::Invoke([this](std::wstring path) {
+                            return this->files.count(path) == 1;
+                        }));
+                    ON_CALL(this->mockWindows, ReadFromFileMock(_, _))
+                        .WillByDefault(testing::Invoke([this](std::wstring path, bool) {
+                            this->jsonReads++;
+                            return this->files.at(path);
+                        }));
+
+                    nlohmann::json dependencyList = nlohmann::json::array();
+                    for (int dependency = 0; dependency < dependencyCount; dependency++) {
+                        std::string file = "dependency" + std::to_string(dependency) + ".json";
+                        dependencyList.push_back(
+                            {
+                                {"key", "DEPENDENCY_" + std::to_string(dependency)},
+                                {"local_file", file},
+                                {"uri", "dependency/" + std::to_string(dependency)},
+                                {"updated_at", 1}
+                            }
+                        );
+
+                        nlohmann::json entries = nlohmann::json::array();
+                        for (int entry = 0; entry < 500; entry++) {
+                            entries.push_back(
+                                {
+                                    {"id", entry},
+                                    {"identifier", file + "/" + std::to_string(entry)},
+                                    {"latitude", 51.0 + entry * 0.001},
+                                    {"longitude", -1.0 + entry * 0.001}
+                                }
+                            );
+                        }
+                        this->files[L"dependencies/" + std::wstring(file.cbegin(), file.cend())] = entries.dump();
+                    }
+                    this->files[L"dependencies/dependency-list.json"] = dependencyList.dump();
+                }
+
+                /*
+                    Start a loader and load every dependency, as the plugin does at startup,
+                    returning how long it took.
+                */
+                std::chrono::microseconds TimeStartup(void)
+                {
+                    this->jsonReads = 0;
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    DependencyLoader loader(this->mockWindows);
+                    for (int dependency = 0; dependency < dependencyCount; dependency++) {
+                        EXPECT_EQ(500, loader.LoadDependency("DEPENDENCY_" + std::to_string(dependency), {}).size());
+                    }
+                    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+                    loader.SaveSnapshot();
+                    return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+                }
+
+                static constexpr int dependencyCount = 30;
+
+                // How many times a JSON file was read
+                int jsonReads = 0;
+
+                std::map<std::wstring, std::string> files;
+                NiceMock<MockWinApi> mockWindows;
+        };
+
+        TEST_F(DependencySnapshotBenchmark, ItReportsTheCostOfStartingFromTheSnapshot)
+        {
+            std::chrono::microseconds fromJson = this->TimeStartup();
+            EXPECT_EQ(dependencyCount + 1, this->jsonReads);
+            ASSERT_EQ(1, this->files.count(L"dependencies/dependency-snapshot.bin"));
+
+            std::chrono::microseconds fromSnapshot = this->TimeStartup();
+            EXPECT_EQ(1, this->jsonReads);
+
+            std::cout << "Dependency startup: " << fromJson.count() << "us from the JSON files, "
+                << fromSnapshot.count() << "us from the snapshot ("
+                << this->files.at(L"dependencies/dependency-snapshot.bin").size() << " bytes)" << std::endl;
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
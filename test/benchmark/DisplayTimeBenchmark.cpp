@@ -0,0 +1,87 @@
+#include "pch/pch.h"
+#include "benchmark/AllocationCounter.h"
+#include "datablock/DisplayTime.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Datablock::DisplayTime;
+using UKControllerPluginTest::Benchmark::AllocationCounter;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Compares formatting the time tag items with the date library, as the off-block
+            and departure time tag items used to on every refresh, against looking the
+            string up by minute of the day.
+        */
+        class DisplayTimeBenchmark : public Test
+        {
+            public:
+                DisplayTimeBenchmark()
+                {
+                    std::chrono::system_clock::time_point start = std::chrono::system_clock::from_time_t(1403549100);
+                    for (int item = 0; item < itemCount; item++) {
+                        this->times.push_back(start + std::chrono::seconds(item * 37));
+                    }
+                }
+
+                /*
+                    Copy each time into a tag item sized buffer, reporting the time taken
+                    and allocations made.
+                */
+                template <typename Formatter>
+                size_t FillItems(std::string description, Formatter formatter)
+                {
+                    char itemString[16];
+                    size_t checksum = 0;
+                    size_t allocationsBefore = AllocationCounter::GetAllocations();
+                    AllocationCounter::Start();
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    for (const std::chrono::system_clock::time_point & time : this->times) {
+                        formatter(time, itemString);
+                        checksum += itemString[4];
+                    }
+                    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+                    AllocationCounter::Stop();
+                    size_t allocations = AllocationCounter::GetAllocations() - allocationsBefore;
+
+                    std::cout << description << ": "
+                        << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / itemCount
+                        << "ns and " << static_cast<double>(allocations) / itemCount
+                        << " allocations per item (checksum " << checksum << ")" << std::endl;
+
+                    return allocations;
+                }
+
+                // Roughly a refresh of every departure strip on a busy evening, several times over
+                static const int itemCount = 50000;
+
+                DisplayTime displayTime;
+                std::vector<std::chrono::system_clock::time_point> times;
+        };
+
+        TEST_F(DisplayTimeBenchmark, ItReportsTheCostOfFormattingWithTheDateLibrary)
+        {
+            this->FillItems(
+                "date::format",
+                [this](std::chrono::system_clock::time_point time, char * itemString) {
+                    std::string formatted = date::format(this->displayTime.timeFormat, time);
+                    memcpy(itemString, formatted.c_str(), formatted.size() + 1);
+                }
+            );
+        }
+
+        TEST_F(DisplayTimeBenchmark, ItLooksUpTimesWithoutAllocating)
+        {
+            size_t allocations = this->FillItems(
+                "DisplayTime::GetTimeString",
+                [this](std::chrono::system_clock::time_point time, char * itemString) {
+                    const std::string & formatted = this->displayTime.GetTimeString(time);
+                    memcpy(itemString, formatted.c_str(), formatted.size() + 1);
+                }
+            );
+
+            EXPECT_EQ(0, allocations);
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,382 @@
+#include "pch/pch.h"
+#include <iomanip>
+#include "benchmark/EventReplayHarness.h"
+#include "benchmark/AllocationCounter.h"
+#include "benchmark/ProfiledEventHandlers.h"
+#include "tag/TagData.h"
+
+using UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface;
+using UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Tag::TagItemInterface;
+using UKControllerPlugin::Tag::TagData;
+using UKControllerPlugin::TimedEvent::AbstractTimedEvent;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        // Data used to generate a plausible UK fleet
+        const std::vector<std::string> airlines = { "BAW", "EZY", "RYR", "VIR", "SHT", "EXS", "TOM", "DLH" };
+        const std::vector<std::string> origins = { "EGLL", "EGKK", "EGSS", "EGGW", "EGCC", "EGPH", "EGBB" };
+        const std::vector<std::string> destinations = { "LFPG", "EHAM", "EDDF", "LEMD", "EIDW", "KJFK" };
+        const std::vector<std::string> sids = { "CPT3F", "MODMI1J", "DET2F", "BPK7F", "LAM3Z", "SAM3X" };
+        const std::vector<std::string> types = { "A320", "B738", "A388", "B77W", "A21N", "E190", "DH8D" };
+
+        EventReplayHarness::EventReplayHarness(size_t aircraftCount)
+            : itemString(""), euroscopeColourCode(0), tagColour(0), fontSize(0.0)
+        {
+            for (size_t i = 0; i < aircraftCount; i++) {
+                std::unique_ptr<ReplayFlightplan> flightplan = std::make_unique<ReplayFlightplan>();
+                flightplan->callsign = airlines[i % airlines.size()] + std::to_string(100 + i);
+                flightplan->origin = origins[i % origins.size()];
+                flightplan->destination = destinations[i % destinations.size()];
+                flightplan->sid = sids[i % sids.size()];
+                flightplan->aircraftType = types[i % types.size()];
+                flightplan->route = flightplan->sid.substr(0, 3) + " L9 KENET UL9 STU";
+                flightplan->cruiseLevel = 25000 + static_cast<int>(i % 15) * 1000;
+                flightplan->squawk = std::to_string(2000 + i % 5000);
+
+                std::unique_ptr<ReplayRadarTarget> radarTarget = std::make_unique<ReplayRadarTarget>();
+                radarTarget->callsign = flightplan->callsign;
+                radarTarget->flightLevel = 5000 + static_cast<int>(i % 30) * 1000;
+                radarTarget->groundSpeed = 250 + static_cast<int>(i % 200);
+                radarTarget->verticalSpeed = (i % 3 == 0) ? -1000 : 0;
+                radarTarget->position.m_Latitude = 50.0 + static_cast<double>(i % 400) / 100.0;
+                radarTarget->position.m_Longitude = -4.0 + static_cast<double>(i % 500) / 100.0;
+
+                this->flightplans.push_back(std::move(flightplan));
+                this->radarTargets.push_back(std::move(radarTarget));
+            }
+
+            this->CreateProfile(this->radarTargetCollectionProfile);
+            this->CreateProfile(this->flightplanCollectionProfile);
+            this->CreateProfile(this->tagItemCollectionProfile);
+            this->CreateProfile(this->timedEventCollectionProfile);
+        }
+
+        void EventReplayHarness::AddEvent(ReplayEvent event)
+        {
+            if (event.type != ReplayEventType::Timer && event.aircraft >= this->flightplans.size()) {
+                throw std::invalid_argument("Replay event for unknown aircraft " + std::to_string(event.aircraft));
+            }
+
+            this->events.push_back(event);
+        }
+
+        void EventReplayHarness::AddFlightplanHandler(
+            std::string name,
+            std::shared_ptr<FlightPlanEventHandlerInterface> handler
+        ) {
+            this->flightplanHandlers.RegisterHandler(
+                std::make_shared<ProfiledFlightPlanEventHandler>(handler, this->CreateProfile(name))
+            );
+        }
+
+        void EventReplayHarness::AddRadarTargetHandler(
+            std::string name,
+            std::shared_ptr<RadarTargetEventHandlerInterface> handler
+        ) {
+            this->radarTargetHandlers.RegisterHandler(
+                std::make_shared<ProfiledRadarTargetEventHandler>(handler, this->CreateProfile(name))
+            );
+        }
+
+        void EventReplayHarness::AddTagItem(std::string name, int itemId, std::shared_ptr<TagItemInterface> tagItem)
+        {
+            this->tagItems.RegisterTagItem(
+                itemId,
+                std::make_shared<ProfiledTagItem>(tagItem, this->CreateProfile(name))
+            );
+            this->tagItemIds.push_back(itemId);
+        }
+
+        void EventReplayHarness::AddTimedEvent(
+            std::string name,
+            std::shared_ptr<AbstractTimedEvent> event,
+            int frequency
+        ) {
+            this->timedEvents.RegisterEvent(
+                std::make_shared<ProfiledTimedEvent>(event, this->CreateProfile(name)),
+                frequency
+            );
+        }
+
+        size_t EventReplayHarness::CountAircraft(void) const
+        {
+            return this->flightplans.size();
+        }
+
+        size_t EventReplayHarness::CountEvents(void) const
+        {
+            return this->events.size();
+        }
+
+        /*
+            Create a profile, or return the existing one if a handler is registered under
+            the same name more than once (e.g. a handler that is both a tag item and a flightplan handler).
+        */
+        std::shared_ptr<HandlerProfile> EventReplayHarness::CreateProfile(std::string name)
+        {
+            if (this->profiles.count(name)) {
+                return this->profiles.at(name);
+            }
+
+            std::shared_ptr<HandlerProfile> profile = std::make_shared<HandlerProfile>(name);
+            this->profiles[name] = profile;
+            this->profileOrder.push_back(profile);
+            return profile;
+        }
+
+        /*
+            Generate a stream of events that looks like a busy period in EuroScope:
+
+            - Every aircraft gets a radar update every few seconds, staggered across the period.
+            - Every registered tag item is requested for every aircraft once a second.
+            - A small proportion of aircraft get a flightplan update each second.
+            - The timer fires once a second.
+        */
+        void EventReplayHarness::GenerateBusyPeriod(int seconds)
+        {
+            for (int second = 1; second <= seconds; second++) {
+                for (size_t aircraft = 0; aircraft < this->flightplans.size(); aircraft++) {
+                    if (aircraft % this->radarUpdateInterval == second % this->radarUpdateInterval) {
+                        this->AddEvent({ ReplayEventType::RadarTargetPositionUpdate, aircraft, 0 });
+                    }
+
+                    if ((aircraft + second) % this->flightplanUpdateRatio == 0) {
+                        this->AddEvent({ ReplayEventType::FlightPlanDataUpdate, aircraft, 0 });
+                    }
+
+                    for (
+                        std::vector<int>::const_iterator itemId = this->tagItemIds.cbegin();
+                        itemId != this->tagItemIds.cend();
+                        ++itemId
+                    ) {
+                        this->AddEvent({ ReplayEventType::GetTagItem, aircraft, *itemId });
+                    }
+                }
+
+                this->AddEvent({ ReplayEventType::Timer, 0, second });
+            }
+        }
+
+        ReplayFlightplan & EventReplayHarness::GetFlightplan(size_t aircraft)
+        {
+            return *this->flightplans.at(aircraft);
+        }
+
+        const HandlerProfile & EventReplayHarness::GetProfile(std::string name) const
+        {
+            return *this->profiles.at(name);
+        }
+
+        ReplayRadarTarget & EventReplayHarness::GetRadarTarget(size_t aircraft)
+        {
+            return *this->radarTargets.at(aircraft);
+        }
+
+        /*
+            Returns a human readable table of results.
+        */
+        std::string EventReplayHarness::GetReport(void) const
+        {
+            std::ostringstream report;
+            report << std::left << std::setw(40) << "Handler"
+                << std::right << std::setw(10) << "Events"
+                << std::setw(12) << "ns/event"
+                << std::setw(14) << "allocs/event"
+                << std::setw(12) << "p99 ns" << std::endl;
+
+            for (
+                std::vector<std::shared_ptr<HandlerProfile>>::const_iterator it = this->profileOrder.cbegin();
+                it != this->profileOrder.cend();
+                ++it
+            ) {
+                report << std::left << std::setw(40) << (*it)->GetName()
+                    << std::right << std::setw(10) << (*it)->GetEvents()
+                    << std::setw(12) << std::fixed << std::setprecision(1) << (*it)->GetNanosecondsPerEvent()
+                    << std::setw(14) << std::setprecision(2) << (*it)->GetAllocationsPerEvent()
+                    << std::setw(12) << (*it)->GetPercentileNanoseconds(0.99) << std::endl;
+            }
+
+            return report.str();
+        }
+
+        const char * EventReplayHarness::GetLastTagItemString(void) const
+        {
+            return this->itemString;
+        }
+
+        bool EventReplayHarness::HasProfile(std::string name) const
+        {
+            return this->profiles.count(name) != 0;
+        }
+
+        /*
+            Load a recorded event stream. Each line is one event, in the form:
+
+            R <aircraft>           - radar target position update
+            F <aircraft>           - flightplan data update
+            D <aircraft>           - flightplan disconnect
+            T <aircraft> <item id> - tag item request
+            S <seconds>            - timer
+
+            Blank lines and lines starting with # are ignored.
+        */
+        void EventReplayHarness::LoadRecording(std::istream & recording)
+        {
+            std::string line;
+            while (std::getline(recording, line)) {
+                if (line.empty() || line[0] == '#') {
+                    continue;
+                }
+
+                std::istringstream tokens(line);
+                char type;
+                size_t aircraft = 0;
+                int value = 0;
+                tokens >> type;
+
+                if (type == 'S') {
+                    tokens >> value;
+                } else {
+                    tokens >> aircraft;
+                    if (type == 'T') {
+                        tokens >> value;
+                    }
+                }
+
+                if (tokens.fail()) {
+                    throw std::invalid_argument("Invalid replay event: " + line);
+                }
+
+                switch (type) {
+                    case 'R':
+                        this->AddEvent({ ReplayEventType::RadarTargetPositionUpdate, aircraft, value });
+                        break;
+                    case 'F':
+                        this->AddEvent({ ReplayEventType::FlightPlanDataUpdate, aircraft, value });
+                        break;
+                    case 'D':
+                        this->AddEvent({ ReplayEventType::FlightPlanDisconnect, aircraft, value });
+                        break;
+                    case 'T':
+                        this->AddEvent({ ReplayEventType::GetTagItem, aircraft, value });
+                        break;
+                    case 'S':
+                        this->AddEvent({ ReplayEventType::Timer, aircraft, value });
+                        break;
+                    default:
+                        throw std::invalid_argument("Invalid replay event: " + line);
+                }
+            }
+        }
+
+        /*
+            Clear the results of any previous replays, so that a warm-up pass isn't
+            counted against the handlers.
+        */
+        void EventReplayHarness::ResetProfiles(void)
+        {
+            for (
+                std::vector<std::shared_ptr<HandlerProfile>>::const_iterator it = this->profileOrder.cbegin();
+                it != this->profileOrder.cend();
+                ++it
+            ) {
+                (*it)->Reset();
+            }
+        }
+
+        /*
+            Set the stored flightplans on the flightplan collection, so that field-dependent handlers
+            added from now on are skipped when their fields haven't changed.
+        */
+        void EventReplayHarness::SetStoredFlightplans(const StoredFlightplanCollection & plans)
+        {
+            this->flightplanHandlers.SetStoredFlightplans(plans);
+        }
+
+        /*
+            Replay all the recorded events the given number of times.
+        */
+        void EventReplayHarness::Replay(int passes)
+        {
+            // Make sure recording the results doesn't count as an allocation
+            for (
+                std::vector<std::shared_ptr<HandlerProfile>>::const_iterator it = this->profileOrder.cbegin();
+                it != this->profileOrder.cend();
+                ++it
+            ) {
+                (*it)->Reserve(this->events.size() * passes);
+            }
+
+            AllocationCounter::Start();
+            for (int pass = 0; pass < passes; pass++) {
+                for (
+                    std::vector<ReplayEvent>::const_iterator event = this->events.cbegin();
+                    event != this->events.cend();
+                    ++event
+                ) {
+                    this->ReplayEventOnce(*event);
+                }
+            }
+            AllocationCounter::Stop();
+        }
+
+        void EventReplayHarness::ReplayEventOnce(const ReplayEvent & event)
+        {
+            switch (event.type) {
+                case ReplayEventType::RadarTargetPositionUpdate: {
+                    // Move the aircraft along a little, as it would between updates
+                    ReplayRadarTarget & radarTarget = *this->radarTargets[event.aircraft];
+                    radarTarget.position.m_Latitude += 0.001;
+                    radarTarget.position.m_Longitude += 0.001;
+                    ProfileCall(*this->profiles.at(this->radarTargetCollectionProfile), [this, &radarTarget]() {
+                        this->radarTargetHandlers.RadarTargetEvent(radarTarget);
+                    });
+                    break;
+                }
+                case ReplayEventType::FlightPlanDataUpdate: {
+                    ReplayFlightplan & flightplan = *this->flightplans[event.aircraft];
+                    ReplayRadarTarget & radarTarget = *this->radarTargets[event.aircraft];
+                    ProfileCall(
+                        *this->profiles.at(this->flightplanCollectionProfile),
+                        [this, &flightplan, &radarTarget]() {
+                            this->flightplanHandlers.FlightPlanEvent(flightplan, radarTarget);
+                        }
+                    );
+                    break;
+                }
+                case ReplayEventType::FlightPlanDisconnect: {
+                    ReplayFlightplan & flightplan = *this->flightplans[event.aircraft];
+                    ProfileCall(*this->profiles.at(this->flightplanCollectionProfile), [this, &flightplan]() {
+                        this->flightplanHandlers.FlightPlanDisconnectEvent(flightplan);
+                    });
+                    break;
+                }
+                case ReplayEventType::GetTagItem: {
+                    TagData tagData(
+                        *this->flightplans[event.aircraft],
+                        *this->radarTargets[event.aircraft],
+                        event.value,
+                        EuroScopePlugIn::TAG_DATA_CORRELATED,
+                        this->itemString,
+                        &this->euroscopeColourCode,
+                        &this->tagColour,
+                        &this->fontSize
+                    );
+                    ProfileCall(*this->profiles.at(this->tagItemCollectionProfile), [this, &tagData]() {
+                        this->tagItems.TagItemUpdate(tagData);
+                    });
+                    break;
+                }
+                case ReplayEventType::Timer: {
+                    ProfileCall(*this->profiles.at(this->timedEventCollectionProfile), [this, &event]() {
+                        this->timedEvents.Tick(event.value);
+                    });
+                    break;
+                }
+            }
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
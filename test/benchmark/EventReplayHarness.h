@@ -0,0 +1,142 @@
+#pragma once
+#include "benchmark/HandlerProfile.h"
+#include "benchmark/ReplayFlightplan.h"
+#include "benchmark/ReplayRadarTarget.h"
+#include "euroscope/RadarTargetEventHandlerCollection.h"
+#include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "tag/TagItemCollection.h"
+#include "timedevent/TimedEventCollection.h"
+
+// Forward declare
+namespace UKControllerPlugin {
+    namespace Euroscope {
+        class RadarTargetEventHandlerInterface;
+    }  // namespace Euroscope
+    namespace Flightplan {
+        class FlightPlanEventHandlerInterface;
+        class StoredFlightplanCollection;
+    }  // namespace Flightplan
+    namespace Tag {
+        class TagItemInterface;
+    }  // namespace Tag
+    namespace TimedEvent {
+        class AbstractTimedEvent;
+    }  // namespace TimedEvent
+}  // namespace UKControllerPlugin
+// END
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            The types of EuroScope event that can be replayed.
+        */
+        enum class ReplayEventType
+        {
+            RadarTargetPositionUpdate,
+            FlightPlanDataUpdate,
+            FlightPlanDisconnect,
+            GetTagItem,
+            Timer
+        };
+
+        /*
+            A single recorded EuroScope event. For tag items, value is the tag item id,
+            for timer events it is the number of seconds since startup.
+        */
+        typedef struct ReplayEvent
+        {
+            ReplayEventType type;
+            size_t aircraft;
+            int value;
+        } ReplayEvent;
+
+        /*
+            Replays a recorded stream of EuroScope events through the plugin's event collections
+            without a running EuroScope instance, using lightweight fake flightplans and radar targets.
+
+            Each registered handler is wrapped so that we can report the time taken, allocations
+            made and tail latency per handler, as well as the total for each collection.
+        */
+        class EventReplayHarness
+        {
+            public:
+                explicit EventReplayHarness(size_t aircraftCount);
+                void AddEvent(ReplayEvent event);
+                void AddFlightplanHandler(
+                    std::string name,
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface> handler
+                );
+                void AddRadarTargetHandler(
+                    std::string name,
+                    std::shared_ptr<UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface> handler
+                );
+                void AddTagItem(
+                    std::string name,
+                    int itemId,
+                    std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem
+                );
+                void AddTimedEvent(
+                    std::string name,
+                    std::shared_ptr<UKControllerPlugin::TimedEvent::AbstractTimedEvent> event,
+                    int frequency
+                );
+                size_t CountAircraft(void) const;
+                size_t CountEvents(void) const;
+                void GenerateBusyPeriod(int seconds);
+                ReplayFlightplan & GetFlightplan(size_t aircraft);
+                const HandlerProfile & GetProfile(std::string name) const;
+                ReplayRadarTarget & GetRadarTarget(size_t aircraft);
+                std::string GetReport(void) const;
+                const char * GetLastTagItemString(void) const;
+                bool HasProfile(std::string name) const;
+                void LoadRecording(std::istream & recording);
+                void Replay(int passes);
+                void ResetProfiles(void);
+                void SetStoredFlightplans(const UKControllerPlugin::Flightplan::StoredFlightplanCollection & plans);
+
+                // Profile names for the collections themselves
+                const std::string radarTargetCollectionProfile = "RadarTargetEventHandlerCollection";
+                const std::string flightplanCollectionProfile = "FlightPlanEventHandlerCollection";
+                const std::string tagItemCollectionProfile = "TagItemCollection";
+                const std::string timedEventCollectionProfile = "TimedEventCollection";
+
+                // How often EuroScope updates each radar target, in seconds
+                const int radarUpdateInterval = 5;
+
+                // Out of every this many aircraft, one has a flightplan update each second
+                const size_t flightplanUpdateRatio = 50;
+
+            private:
+
+                std::shared_ptr<HandlerProfile> CreateProfile(std::string name);
+                void ReplayEventOnce(const ReplayEvent & event);
+
+                // The collections that events are replayed through
+                UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection radarTargetHandlers;
+                UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection flightplanHandlers;
+                UKControllerPlugin::Tag::TagItemCollection tagItems;
+                UKControllerPlugin::TimedEvent::TimedEventCollection timedEvents;
+
+                // The aircraft in the replay
+                std::vector<std::unique_ptr<ReplayFlightplan>> flightplans;
+                std::vector<std::unique_ptr<ReplayRadarTarget>> radarTargets;
+
+                // The recorded events
+                std::vector<ReplayEvent> events;
+
+                // Tag item ids that have been registered, for generating events
+                std::vector<int> tagItemIds;
+
+                // Profiles by name and in the order they were added
+                std::map<std::string, std::shared_ptr<HandlerProfile>> profiles;
+                std::vector<std::shared_ptr<HandlerProfile>> profileOrder;
+
+                // Tag item output buffers, as EuroScope would provide them
+                char itemString[16];
+                int euroscopeColourCode;
+                COLORREF tagColour;
+                double fontSize;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,205 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "benchmark/AllocationCounter.h"
+#include "mock/MockFlightPlanEventHandlerInterface.h"
+#include "mock/MockRadarTargetEventHandlerInterface.h"
+#include "mock/MockAbstractTimedEvent.h"
+#include "tag/TagItemInterface.h"
+#include "tag/TagData.h"
+
+using ::testing::Test;
+using ::testing::NiceMock;
+using ::testing::Ref;
+using ::testing::_;
+using UKControllerPlugin::Tag::TagData;
+using UKControllerPluginTest::Benchmark::AllocationCounter;
+using UKControllerPluginTest::Benchmark::EventReplayHarness;
+using UKControllerPluginTest::Benchmark::ReplayEvent;
+using UKControllerPluginTest::Benchmark::ReplayEventType;
+using UKControllerPluginTest::Flightplan::MockFlightPlanEventHandlerInterface;
+using UKControllerPluginTest::EventHandler::MockRadarTargetEventHandlerInterface;
+using UKControllerPluginTest::EventHandler::MockAbstractTimedEvent;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        class AllocatingTagItem : public UKControllerPlugin::Tag::TagItemInterface
+        {
+            public:
+                std::string GetTagItemDescription(int tagItemId) const override
+                {
+                    return "Allocating";
+                }
+
+                void SetTagItemData(TagData & tagData) override
+                {
+                    this->lastAllocation = std::make_unique<int>(tagData.itemCode);
+                    tagData.SetItemString("TEST");
+                }
+
+                std::unique_ptr<int> lastAllocation;
+        };
+
+        class EventReplayHarnessTest : public Test
+        {
+            public:
+                EventReplayHarnessTest()
+                    : harness(5)
+                {
+
+                }
+
+                EventReplayHarness harness;
+        };
+
+        TEST_F(EventReplayHarnessTest, ItCreatesAircraft)
+        {
+            EXPECT_EQ(5, this->harness.CountAircraft());
+            EXPECT_EQ(this->harness.GetFlightplan(3).GetCallsign(), this->harness.GetRadarTarget(3).GetCallsign());
+            EXPECT_NE(this->harness.GetFlightplan(2).GetCallsign(), this->harness.GetFlightplan(3).GetCallsign());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItHasProfilesForEachCollection)
+        {
+            EXPECT_TRUE(this->harness.HasProfile(this->harness.radarTargetCollectionProfile));
+            EXPECT_TRUE(this->harness.HasProfile(this->harness.flightplanCollectionProfile));
+            EXPECT_TRUE(this->harness.HasProfile(this->harness.tagItemCollectionProfile));
+            EXPECT_TRUE(this->harness.HasProfile(this->harness.timedEventCollectionProfile));
+        }
+
+        TEST_F(EventReplayHarnessTest, ItThrowsOnEventsForUnknownAircraft)
+        {
+            EXPECT_THROW(
+                this->harness.AddEvent({ ReplayEventType::RadarTargetPositionUpdate, 5, 0 }),
+                std::invalid_argument
+            );
+        }
+
+        TEST_F(EventReplayHarnessTest, ItReplaysRadarTargetEvents)
+        {
+            std::shared_ptr<NiceMock<MockRadarTargetEventHandlerInterface>> handler =
+                std::make_shared<NiceMock<MockRadarTargetEventHandlerInterface>>();
+            this->harness.AddRadarTargetHandler("radar", handler);
+            this->harness.AddEvent({ ReplayEventType::RadarTargetPositionUpdate, 2, 0 });
+
+            EXPECT_CALL(*handler, RadarTargetPositionUpdateEvent(Ref(this->harness.GetRadarTarget(2))))
+                .Times(2);
+
+            this->harness.Replay(2);
+            EXPECT_EQ(2, this->harness.GetProfile("radar").GetEvents());
+            EXPECT_EQ(2, this->harness.GetProfile(this->harness.radarTargetCollectionProfile).GetEvents());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItReplaysFlightplanEvents)
+        {
+            std::shared_ptr<NiceMock<MockFlightPlanEventHandlerInterface>> handler =
+                std::make_shared<NiceMock<MockFlightPlanEventHandlerInterface>>();
+            this->harness.AddFlightplanHandler("flightplan", handler);
+            this->harness.AddEvent({ ReplayEventType::FlightPlanDataUpdate, 1, 0 });
+            this->harness.AddEvent({ ReplayEventType::FlightPlanDisconnect, 1, 0 });
+
+            EXPECT_CALL(
+                *handler,
+                FlightPlanEvent(Ref(this->harness.GetFlightplan(1)), Ref(this->harness.GetRadarTarget(1)))
+            )
+                .Times(1);
+
+            EXPECT_CALL(*handler, FlightPlanDisconnectEvent(Ref(this->harness.GetFlightplan(1))))
+                .Times(1);
+
+            this->harness.Replay(1);
+            EXPECT_EQ(2, this->harness.GetProfile("flightplan").GetEvents());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItReplaysTimedEventsAtTheirFrequency)
+        {
+            std::shared_ptr<NiceMock<MockAbstractTimedEvent>> event =
+                std::make_shared<NiceMock<MockAbstractTimedEvent>>();
+            this->harness.AddTimedEvent("timer", event, 5);
+            for (int i = 1; i <= 10; i++) {
+                this->harness.AddEvent({ ReplayEventType::Timer, 0, i });
+            }
+
+            EXPECT_CALL(*event, TimedEventTrigger())
+                .Times(2);
+
+            this->harness.Replay(1);
+            EXPECT_EQ(2, this->harness.GetProfile("timer").GetEvents());
+            EXPECT_EQ(10, this->harness.GetProfile(this->harness.timedEventCollectionProfile).GetEvents());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItReplaysTagItemsAndCountsAllocations)
+        {
+            this->harness.AddTagItem("tag", 101, std::make_shared<AllocatingTagItem>());
+            this->harness.AddEvent({ ReplayEventType::GetTagItem, 0, 101 });
+            this->harness.AddEvent({ ReplayEventType::GetTagItem, 1, 101 });
+            this->harness.Replay(1);
+
+            EXPECT_STREQ("TEST", this->harness.GetLastTagItemString());
+            EXPECT_EQ(2, this->harness.GetProfile("tag").GetEvents());
+            EXPECT_EQ(2, this->harness.GetProfile("tag").GetAllocations());
+            EXPECT_DOUBLE_EQ(1.0, this->harness.GetProfile("tag").GetAllocationsPerEvent());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItResetsProfiles)
+        {
+            this->harness.AddTagItem("tag", 101, std::make_shared<AllocatingTagItem>());
+            this->harness.AddEvent({ ReplayEventType::GetTagItem, 0, 101 });
+            this->harness.Replay(1);
+            this->harness.ResetProfiles();
+
+            EXPECT_EQ(0, this->harness.GetProfile("tag").GetEvents());
+            EXPECT_EQ(0, this->harness.GetProfile("tag").GetAllocations());
+            EXPECT_EQ(0, this->harness.GetProfile(this->harness.tagItemCollectionProfile).GetEvents());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItStopsCountingAllocationsAfterReplay)
+        {
+            this->harness.Replay(1);
+            EXPECT_FALSE(AllocationCounter::IsCounting());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItGeneratesABusyPeriod)
+        {
+            this->harness.AddTagItem("tag", 101, std::make_shared<AllocatingTagItem>());
+            this->harness.GenerateBusyPeriod(10);
+
+            // 5 aircraft, 10 seconds: 10 radar updates, 50 tag items and 10 timer events
+            EXPECT_EQ(70, this->harness.CountEvents());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItLoadsARecording)
+        {
+            std::istringstream recording(
+                "# A recording\n"
+                "R 0\n"
+                "F 1\n"
+                "\n"
+                "D 1\n"
+                "T 2 101\n"
+                "S 4\n"
+            );
+            this->harness.LoadRecording(recording);
+            EXPECT_EQ(5, this->harness.CountEvents());
+        }
+
+        TEST_F(EventReplayHarnessTest, ItThrowsOnInvalidRecording)
+        {
+            std::istringstream recording("X 0\n");
+            EXPECT_THROW(this->harness.LoadRecording(recording), std::invalid_argument);
+        }
+
+        TEST_F(EventReplayHarnessTest, ItProducesAReport)
+        {
+            std::shared_ptr<NiceMock<MockRadarTargetEventHandlerInterface>> handler =
+                std::make_shared<NiceMock<MockRadarTargetEventHandlerInterface>>();
+            this->harness.AddRadarTargetHandler("HistoryTrails", handler);
+            this->harness.AddEvent({ ReplayEventType::RadarTargetPositionUpdate, 2, 0 });
+            this->harness.Replay(1);
+
+            std::string report = this->harness.GetReport();
+            EXPECT_NE(std::string::npos, report.find("HistoryTrails"));
+            EXPECT_NE(std::string::npos, report.find("allocs/event"));
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
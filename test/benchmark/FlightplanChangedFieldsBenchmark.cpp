@@ -0,0 +1,182 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "flightplan/CallsignRegistry.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanEventHandler.h"
+#include "handoff/HandoffCollection.h"
+#include "handoff/HandoffEventHandler.h"
+#include "wake/WakeCategoryEventHandler.h"
+#include "wake/WakeCategoryMapper.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+using UKControllerPlugin::Handoff::HandoffCollection;
+using UKControllerPlugin::Handoff::HandoffEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryMapper;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Passes every flightplan event on to the wrapped handler, regardless of the fields
+            it depends on, as the collection did before it checked the stored flightplan's changed fields.
+        */
+        class EveryEventHandler : public FlightPlanEventHandlerInterface
+        {
+            public:
+                explicit EveryEventHandler(std::shared_ptr<FlightPlanEventHandlerInterface> handler)
+                    : handler(handler)
+                {
+                }
+
+                void FlightPlanEvent(
+                    EuroScopeCFlightPlanInterface & flightPlan,
+                    EuroScopeCRadarTargetInterface & radarTarget
+                ) override {
+                    this->handler->FlightPlanEvent(flightPlan, radarTarget);
+                }
+
+                void FlightPlanDisconnectEvent(EuroScopeCFlightPlanInterface & flightPlan) override
+                {
+                    this->handler->FlightPlanDisconnectEvent(flightPlan);
+                }
+
+                void ControllerFlightPlanDataEvent(EuroScopeCFlightPlanInterface & flightPlan, int dataType) override
+                {
+                    this->handler->ControllerFlightPlanDataEvent(flightPlan, dataType);
+                }
+
+            private:
+                std::shared_ptr<FlightPlanEventHandlerInterface> handler;
+        };
+
+        /*
+            Replays a busy period of flightplan updates and tag item requests and reports how often
+            the wake and handoff tag items are served from their caches. Every flightplan event that
+            reaches one of these handlers throws away the cached item for that aircraft, which then
+            has to be rebuilt on the next paint.
+        */
+        class FlightplanChangedFieldsBenchmark : public Test
+        {
+            public:
+                FlightplanChangedFieldsBenchmark()
+                    : harness(aircraftCount)
+                {
+                    this->ukMapper.AddCategoryMapping("A320", "LM");
+                    this->ukMapper.AddCategoryMapping("B738", "LM");
+                    this->recatMapper.AddCategoryMapping("A320", "D");
+                    this->recatMapper.AddCategoryMapping("B738", "D");
+                    this->wake = std::make_shared<WakeCategoryEventHandler>(
+                        this->ukMapper,
+                        this->recatMapper,
+                        *this->aircraft
+                    );
+                    this->handoff = std::make_shared<HandoffEventHandler>(
+                        this->handoffs,
+                        this->activeCallsigns,
+                        *this->aircraft
+                    );
+                }
+
+                std::shared_ptr<FlightPlanEventHandlerInterface> Wrap(
+                    std::shared_ptr<FlightPlanEventHandlerInterface> handler,
+                    bool filtered
+                ) {
+                    if (filtered) {
+                        return handler;
+                    }
+
+                    return std::make_shared<EveryEventHandler>(handler);
+                }
+
+                /*
+                    Replay the busy period once to warm everything up, amend the SIDs of some of the
+                    aircraft, then replay it again and report the cache hit rate.
+                */
+                void ReplayBusyPeriod(bool filtered)
+                {
+                    this->harness.AddFlightplanHandler("CallsignRegistry", this->aircraft);
+                    this->harness.AddFlightplanHandler(
+                        "StoredFlightplanEventHandler",
+                        std::make_shared<StoredFlightplanEventHandler>(this->storedFlightplans)
+                    );
+                    this->harness.SetStoredFlightplans(this->storedFlightplans);
+                    this->harness.AddFlightplanHandler(
+                        "WakeCategoryEventHandler",
+                        this->Wrap(this->wake, filtered)
+                    );
+                    this->harness.AddFlightplanHandler(
+                        "HandoffEventHandler",
+                        this->Wrap(this->handoff, filtered)
+                    );
+                    this->harness.AddTagItem("WakeCategoryEventHandler (105)", 105, this->wake);
+                    this->harness.AddTagItem("HandoffEventHandler (107)", 107, this->handoff);
+                    this->harness.GenerateBusyPeriod(this->seconds);
+
+                    this->harness.Replay(1);
+                    this->harness.ResetProfiles();
+                    for (size_t aircraft = 0; aircraft < aircraftCount; aircraft += amendedAircraftRatio) {
+                        this->harness.GetFlightplan(aircraft).sid = "BPK7G";
+                    }
+                    this->harness.Replay(1);
+                    std::cout << this->harness.GetReport();
+
+                    for (std::string handler : { "WakeCategoryEventHandler", "HandoffEventHandler" }) {
+                        size_t invalidations = this->harness.GetProfile(handler).GetEvents();
+                        size_t items = aircraftCount * this->seconds;
+                        std::cout << handler << ": " << invalidations << " cache invalidations for " << items
+                            << " tag items, " << 100.0 * (items - invalidations) / items << "% cache hit rate"
+                            << std::endl;
+                    }
+                }
+
+                // Roughly what a busy evening looks like across the UK
+                static constexpr size_t aircraftCount = 1500;
+
+                // One in this many aircraft has its SID amended during the measured period
+                static constexpr size_t amendedAircraftRatio = 10;
+
+                // How long the busy period lasts
+                const int seconds = 60;
+
+                WakeCategoryMapper ukMapper;
+                WakeCategoryMapper recatMapper;
+                HandoffCollection handoffs;
+                StoredFlightplanCollection storedFlightplans;
+                ActiveCallsignCollection activeCallsigns;
+                std::shared_ptr<CallsignRegistry> aircraft = std::make_shared<CallsignRegistry>();
+                std::shared_ptr<WakeCategoryEventHandler> wake;
+                std::shared_ptr<HandoffEventHandler> handoff;
+                EventReplayHarness harness;
+        };
+
+        TEST_F(FlightplanChangedFieldsBenchmark, ItReportsTheCacheHitRateWhenEveryEventIsPassedOn)
+        {
+            this->ReplayBusyPeriod(false);
+            EXPECT_EQ(
+                this->harness.GetProfile(this->harness.flightplanCollectionProfile).GetEvents(),
+                this->harness.GetProfile("HandoffEventHandler").GetEvents()
+            );
+        }
+
+        TEST_F(FlightplanChangedFieldsBenchmark, ItReportsTheCacheHitRateWhenUnchangedFieldsAreSkipped)
+        {
+            this->ReplayBusyPeriod(true);
+
+            // Only the first event after an amendment gets through, and only to the handler that uses the SID
+            EXPECT_EQ(0, this->harness.GetProfile("WakeCategoryEventHandler").GetEvents());
+            EXPECT_EQ(
+                aircraftCount / amendedAircraftRatio,
+                this->harness.GetProfile("HandoffEventHandler").GetEvents()
+            );
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,109 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "flightplan/CallsignRegistry.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanEventHandler.h"
+#include "handoff/HandoffCollection.h"
+#include "handoff/HandoffEventHandler.h"
+#include "wake/WakeCategoryEventHandler.h"
+#include "wake/WakeCategoryMapper.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+using UKControllerPlugin::Handoff::HandoffCollection;
+using UKControllerPlugin::Handoff::HandoffEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryMapper;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Compares the cost of pushing every flightplan through the flightplan event handlers
+            each time a timed event walks all the flightplans, against only pushing through those
+            that have been marked as dirty.
+        */
+        class FlightplanSweepBenchmark : public Test
+        {
+            public:
+                FlightplanSweepBenchmark()
+                    : harness(aircraftCount)
+                {
+                    this->harness.AddFlightplanHandler("CallsignRegistry", this->aircraft);
+                    this->harness.AddFlightplanHandler(
+                        "WakeCategoryEventHandler",
+                        std::make_shared<WakeCategoryEventHandler>(this->ukMapper, this->recatMapper, *this->aircraft)
+                    );
+                    this->harness.AddFlightplanHandler(
+                        "HandoffEventHandler",
+                        std::make_shared<HandoffEventHandler>(this->handoffs, this->activeCallsigns, *this->aircraft)
+                    );
+                    this->harness.AddFlightplanHandler(
+                        "StoredFlightplanEventHandler",
+                        std::make_shared<StoredFlightplanEventHandler>(this->storedFlightplans)
+                    );
+                }
+
+                /*
+                    Each tick, send a flightplan update for the given number of aircraft.
+                */
+                void ReplayTicks(size_t aircraftPerTick)
+                {
+                    for (int tick = 0; tick < this->ticks; tick++) {
+                        for (size_t aircraft = 0; aircraft < aircraftPerTick; aircraft++) {
+                            this->harness.AddEvent(
+                                {
+                                    ReplayEventType::FlightPlanDataUpdate,
+                                    (tick * aircraftPerTick + aircraft) % aircraftCount,
+                                    0
+                                }
+                            );
+                        }
+                    }
+
+                    this->harness.Replay(1);
+                    std::cout << this->harness.GetReport();
+
+                    const HandlerProfile & collection = this->harness.GetProfile(
+                        this->harness.flightplanCollectionProfile
+                    );
+                    std::cout << "Flightplan handlers per tick: "
+                        << (collection.GetNanosecondsPerEvent() * collection.GetEvents() / this->ticks) / 1000.0
+                        << "us" << std::endl;
+                }
+
+                static constexpr size_t aircraftCount = 1500;
+
+                // How many timed event ticks to replay
+                const int ticks = 30;
+
+                WakeCategoryMapper ukMapper;
+                WakeCategoryMapper recatMapper;
+                HandoffCollection handoffs;
+                ActiveCallsignCollection activeCallsigns;
+                std::shared_ptr<CallsignRegistry> aircraft = std::make_shared<CallsignRegistry>();
+                StoredFlightplanCollection storedFlightplans;
+                EventReplayHarness harness;
+        };
+
+        TEST_F(FlightplanSweepBenchmark, ItReportsTheCostOfUpdatingEveryFlightplanEachTick)
+        {
+            this->ReplayTicks(aircraftCount);
+            EXPECT_EQ(
+                aircraftCount * this->ticks,
+                this->harness.GetProfile(this->harness.flightplanCollectionProfile).GetEvents()
+            );
+        }
+
+        TEST_F(FlightplanSweepBenchmark, ItReportsTheCostOfOnlyUpdatingDirtyFlightplans)
+        {
+            // Roughly how many aircraft enter or leave the proximity of a hold each tick
+            this->ReplayTicks(15);
+            EXPECT_EQ(15 * this->ticks, this->harness.GetProfile(this->harness.flightplanCollectionProfile).GetEvents());
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,85 @@
+#include "pch/pch.h"
+#include "benchmark/HandlerProfile.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        HandlerProfile::HandlerProfile(std::string name)
+            : name(name)
+        {
+
+        }
+
+        /*
+            Record a single event.
+        */
+        void HandlerProfile::Record(long long nanoseconds, size_t allocations)
+        {
+            this->samples.push_back(nanoseconds);
+            this->totalNanoseconds += nanoseconds;
+            this->totalAllocations += allocations;
+        }
+
+        /*
+            Reserve space for samples up front, so that recording them doesn't
+            allocate whilst we're measuring.
+        */
+        void HandlerProfile::Reserve(size_t events)
+        {
+            this->samples.reserve(this->samples.size() + events);
+        }
+
+        void HandlerProfile::Reset(void)
+        {
+            this->samples.clear();
+            this->totalNanoseconds = 0;
+            this->totalAllocations = 0;
+        }
+
+        std::string HandlerProfile::GetName(void) const
+        {
+            return this->name;
+        }
+
+        size_t HandlerProfile::GetEvents(void) const
+        {
+            return this->samples.size();
+        }
+
+        size_t HandlerProfile::GetAllocations(void) const
+        {
+            return this->totalAllocations;
+        }
+
+        double HandlerProfile::GetNanosecondsPerEvent(void) const
+        {
+            return this->samples.empty()
+                ? 0.0
+                : static_cast<double>(this->totalNanoseconds) / this->samples.size();
+        }
+
+        double HandlerProfile::GetAllocationsPerEvent(void) const
+        {
+            return this->samples.empty()
+                ? 0.0
+                : static_cast<double>(this->totalAllocations) / this->samples.size();
+        }
+
+        /*
+            Returns the time taken by the given percentile of events, e.g. 0.99 for p99.
+        */
+        long long HandlerProfile::GetPercentileNanoseconds(double percentile) const
+        {
+            if (this->samples.empty()) {
+                return 0;
+            }
+
+            std::vector<long long> sorted = this->samples;
+            size_t rank = static_cast<size_t>(std::ceil(percentile * sorted.size()));
+            rank = rank == 0 ? 0 : rank - 1;
+            rank = (std::min)(rank, sorted.size() - 1);
+            std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+            return sorted[rank];
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,40 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            The cost of a single handler (or collection) over the course of a replay.
+            Records the time taken and the number of heap allocations for every event
+            so that we can report averages as well as tail latency.
+        */
+        class HandlerProfile
+        {
+            public:
+                explicit HandlerProfile(std::string name);
+                void Record(long long nanoseconds, size_t allocations);
+                void Reserve(size_t events);
+                void Reset(void);
+                std::string GetName(void) const;
+                size_t GetEvents(void) const;
+                size_t GetAllocations(void) const;
+                double GetNanosecondsPerEvent(void) const;
+                double GetAllocationsPerEvent(void) const;
+                long long GetPercentileNanoseconds(double percentile) const;
+
+            private:
+
+                // The name of the handler
+                const std::string name;
+
+                // Time taken for every event, in nanoseconds
+                std::vector<long long> samples;
+
+                // The total time taken
+                long long totalNanoseconds = 0;
+
+                // The total number of allocations
+                size_t totalAllocations = 0;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
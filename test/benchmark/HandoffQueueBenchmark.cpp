@@ -0,0 +1,104 @@
+#include "pch/pch.h"
+#include "task/LockFreeQueue.h"
+
+using ::testing::Test;
+using UKControllerPlugin::TaskManager::LockFreeQueue;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Compares handing results from several worker threads to the EuroScope thread through
+            a mutex guarded queue against the lock free queue. The consumer drains on a loop, as the
+            timed events do. Alongside throughput, we record the longest any single push takes, which
+            is how long a worker can be held up by the EuroScope thread or by other workers.
+        */
+        class HandoffQueueBenchmark : public Test
+        {
+            public:
+
+                /*
+                    Runs the producers and the consumer, returns the worst push in microseconds.
+                */
+                template <typename PushFunction, typename DrainFunction>
+                long long Run(std::string name, PushFunction push, DrainFunction drain)
+                {
+                    std::vector<std::thread> threads;
+                    std::vector<long long> worstPushes(producers, 0);
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    for (int producer = 0; producer < producers; producer++) {
+                        threads.push_back(std::thread([push, &worstPushes, producer]() {
+                            for (int item = 0; item < itemsPerProducer; item++) {
+                                std::string message = "message " + std::to_string(item);
+                                std::chrono::steady_clock::time_point pushStart = std::chrono::steady_clock::now();
+                                push(std::move(message));
+                                worstPushes[producer] = (std::max)(
+                                    worstPushes[producer],
+                                    static_cast<long long>(
+                                        std::chrono::duration_cast<std::chrono::microseconds>(
+                                            std::chrono::steady_clock::now() - pushStart
+                                        ).count()
+                                    )
+                                );
+                            }
+                        }));
+                    }
+
+                    int received = 0;
+                    while (received < producers * itemsPerProducer) {
+                        received += drain();
+                    }
+                    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+                    for (std::thread & thread : threads) {
+                        thread.join();
+                    }
+
+                    long long elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+                    long long worstPush = *std::max_element(worstPushes.cbegin(), worstPushes.cend());
+                    std::cout << name << ": " << (producers * itemsPerProducer) / ((std::max)(elapsed, 1LL) / 1000.0)
+                        << " items/ms, worst push " << worstPush << "us" << std::endl;
+
+                    EXPECT_EQ(producers * itemsPerProducer, received);
+                    return worstPush;
+                }
+
+                static constexpr int producers = 4;
+                static constexpr int itemsPerProducer = 200000;
+        };
+
+        TEST_F(HandoffQueueBenchmark, ItHandsOffThroughAMutexGuardedQueue)
+        {
+            std::mutex lock;
+            std::queue<std::string> queue;
+
+            this->Run(
+                "Mutex",
+                [&lock, &queue](std::string item) {
+                    std::lock_guard<std::mutex> guard(lock);
+                    queue.push(item);
+                },
+                [&lock, &queue]() {
+                    std::lock_guard<std::mutex> guard(lock);
+                    int drained = 0;
+                    while (!queue.empty()) {
+                        queue.pop();
+                        drained++;
+                    }
+                    return drained;
+                }
+            );
+        }
+
+        TEST_F(HandoffQueueBenchmark, ItHandsOffThroughTheLockFreeQueue)
+        {
+            LockFreeQueue<std::string> queue;
+
+            this->Run(
+                "Lock free",
+                [&queue](std::string item) { queue.Push(item); },
+                [&queue]() { return static_cast<int>(queue.Drain([](std::string item) {})); }
+            );
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,91 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "benchmark/AllocationCounter.h"
+#include "historytrail/AircraftHistoryTrail.h"
+#include "historytrail/HistoryTrailEventHandler.h"
+#include "historytrail/HistoryTrailRepository.h"
+
+using ::testing::Test;
+using UKControllerPlugin::HistoryTrail::AircraftHistoryTrail;
+using UKControllerPlugin::HistoryTrail::HistoryTrailEventHandler;
+using UKControllerPlugin::HistoryTrail::HistoryTrailRepository;
+using UKControllerPluginTest::Benchmark::AllocationCounter;
+using UKControllerPluginTest::Benchmark::EventReplayHarness;
+using UKControllerPluginTest::Benchmark::ReplayEventType;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Fills the history trails of a very busy sky and then measures the cost of
+            adding positions once every trail is full, and of walking every position
+            as the renderer does.
+        */
+        class HistoryTrailBenchmark : public Test
+        {
+            public:
+                HistoryTrailBenchmark()
+                    : harness(aircraftCount)
+                {
+                    this->harness.AddRadarTargetHandler(
+                        "HistoryTrailEventHandler",
+                        std::make_shared<HistoryTrailEventHandler>(this->trails)
+                    );
+
+                    for (unsigned int point = 0; point < AircraftHistoryTrail::maxSize; point++) {
+                        for (size_t aircraft = 0; aircraft < aircraftCount; aircraft++) {
+                            this->harness.AddEvent({ ReplayEventType::RadarTargetPositionUpdate, aircraft, 0 });
+                        }
+                    }
+                }
+
+                static constexpr size_t aircraftCount = 2000;
+
+                HistoryTrailRepository trails;
+                EventReplayHarness harness;
+        };
+
+        TEST_F(HistoryTrailBenchmark, ItAddsPositionsWithoutAllocating)
+        {
+            // Fill every trail, then measure with the rings wrapping around
+            this->harness.Replay(1);
+            this->harness.ResetProfiles();
+            this->harness.Replay(1);
+            std::cout << this->harness.GetReport();
+
+            EXPECT_EQ(aircraftCount, this->trails.CountAircraft());
+            EXPECT_EQ(
+                aircraftCount * AircraftHistoryTrail::maxSize,
+                this->harness.GetProfile("HistoryTrailEventHandler").GetEvents()
+            );
+            EXPECT_EQ(0, this->harness.GetProfile("HistoryTrailEventHandler").GetAllocations());
+        }
+
+        TEST_F(HistoryTrailBenchmark, ItWalksEveryPositionWithoutAllocating)
+        {
+            this->harness.Replay(1);
+
+            double checksum = 0.0;
+            size_t positions = 0;
+            size_t allocationsBefore = AllocationCounter::GetAllocations();
+            AllocationCounter::Start();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (size_t slot = 0; slot < this->trails.CountAircraft(); slot++) {
+                AircraftHistoryTrail trail = this->trails.GetTrail(slot);
+                for (unsigned int age = 0; age < trail.Size(); age++) {
+                    checksum += trail.GetLatitude(age) + trail.GetLongitude(age);
+                    positions++;
+                }
+            }
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            AllocationCounter::Stop();
+
+            std::cout << "Walked " << positions << " positions in "
+                << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+                << "us (checksum " << checksum << ")" << std::endl;
+
+            EXPECT_EQ(aircraftCount * AircraftHistoryTrail::maxSize, positions);
+            EXPECT_EQ(allocationsBefore, AllocationCounter::GetAllocations());
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,282 @@
+#include "pch/pch.h"
+#include "benchmark/AllocationCounter.h"
+#include "benchmark/ReplayFlightplan.h"
+#include "benchmark/ReplayRadarTarget.h"
+#include "dialog/DialogManager.h"
+#include "graphics/GdiGraphicsInterface.h"
+#include "hold/DeemedSeparatedHold.h"
+#include "hold/HoldDisplay.h"
+#include "hold/HoldManager.h"
+#include "hold/HoldingData.h"
+#include "hold/HoldingSnapshot.h"
+#include "hold/PublishedHoldCollection.h"
+#include "navaids/Navaid.h"
+#include "mock/MockApiInterface.h"
+#include "mock/MockDialogProvider.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "mock/MockEuroscopeRadarScreenLoopbackInterface.h"
+#include "mock/MockTaskRunnerInterface.h"
+
+using ::testing::NiceMock;
+using ::testing::Test;
+using UKControllerPlugin::Dialog::DialogManager;
+using UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface;
+using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Hold::DeemedSeparatedHold;
+using UKControllerPlugin::Hold::HoldDisplay;
+using UKControllerPlugin::Hold::HoldManager;
+using UKControllerPlugin::Hold::HoldingData;
+using UKControllerPlugin::Hold::HoldingSnapshot;
+using UKControllerPlugin::Hold::PublishedHoldCollection;
+using UKControllerPlugin::Navaids::Navaid;
+using UKControllerPlugin::Windows::GdiGraphicsInterface;
+using UKControllerPluginTest::Api::MockApiInterface;
+using UKControllerPluginTest::Benchmark::AllocationCounter;
+using UKControllerPluginTest::Dialog::MockDialogProvider;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using UKControllerPluginTest::Euroscope::MockEuroscopeRadarScreenLoopbackInterface;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Graphics that draw nothing, so that only the work done by the hold displays is measured.
+        */
+        class NullGraphics : public GdiGraphicsInterface
+        {
+            public:
+                void DrawRect(const Gdiplus::RectF & area, const Gdiplus::Pen & pen) override {}
+                void DrawRect(const Gdiplus::Rect & area, const Gdiplus::Pen & pen) override {}
+                void DrawRect(const RECT & area, const Gdiplus::Pen & pen) override {}
+                void DrawCircle(const Gdiplus::RectF & area, const Gdiplus::Pen & pen) override {}
+                void DrawCircle(const Gdiplus::Rect & area, const Gdiplus::Pen & pen) override {}
+                void DrawDiamond(const Gdiplus::RectF & area, const Gdiplus::Pen & pen) override {}
+                void DrawLine(
+                    const Gdiplus::Pen & pen,
+                    const Gdiplus::Point & start,
+                    const Gdiplus::Point & end
+                ) override {}
+                void DrawPath(const Gdiplus::GraphicsPath & path, const Gdiplus::Pen & pen) override {}
+                void DrawString(
+                    std::wstring text,
+                    const Gdiplus::RectF & area,
+                    const Gdiplus::Brush & brush
+                ) override {}
+                void DrawString(std::wstring text, const Gdiplus::Rect & area, const Gdiplus::Brush & brush) override {}
+                void DrawString(std::wstring text, const RECT & area, const Gdiplus::Brush & brush) override {}
+                void FillRect(const Gdiplus::RectF & area, const Gdiplus::Brush & brush) override {}
+                void FillRect(const Gdiplus::Rect & area, const Gdiplus::Brush & brush) override {}
+                void FillRect(const RECT & area, const Gdiplus::Brush & brush) override {}
+                void SetAntialias(bool setting) override {}
+                void SetDeviceHandle(HDC & handle) override {}
+        };
+
+        /*
+            A radar screen that ignores screen objects.
+        */
+        class NullRadarScreen : public NiceMock<MockEuroscopeRadarScreenLoopbackInterface>
+        {
+            public:
+                void RegisterScreenObject(int objectType, std::string objectId, RECT location, bool moveable) override
+                {
+                }
+        };
+
+        /*
+            Hands out a fresh wrapper for every lookup, as EuroScope does, and counts the lookups.
+        */
+        class HoldDisplayPlugin : public NiceMock<MockEuroscopePluginLoopbackInterface>
+        {
+            public:
+                std::shared_ptr<EuroScopeCFlightPlanInterface> GetFlightplanForCallsign(
+                    std::string callsign
+                ) const override {
+                    this->lookups++;
+                    auto flightplan = this->flightplans.find(callsign);
+                    return flightplan == this->flightplans.cend()
+                        ? nullptr
+                        : std::make_shared<ReplayFlightplan>(flightplan->second);
+                }
+
+                std::shared_ptr<EuroScopeCRadarTargetInterface> GetRadarTargetForCallsign(
+                    std::string callsign
+                ) const override {
+                    this->lookups++;
+                    auto radarTarget = this->radarTargets.find(callsign);
+                    return radarTarget == this->radarTargets.cend()
+                        ? nullptr
+                        : std::make_shared<ReplayRadarTarget>(radarTarget->second);
+                }
+
+                std::map<std::string, ReplayFlightplan> flightplans;
+                std::map<std::string, ReplayRadarTarget> radarTargets;
+                mutable size_t lookups = 0;
+        };
+
+        /*
+            Paints four hold displays with 40 aircraft between them. Each stack is deemed separated from
+            its neighbours and every aircraft is also in proximity of the next stack along, so the VSL
+            filtering has to compare aircraft across stacks at every level.
+        */
+        class HoldDisplayBenchmark : public Test
+        {
+            public:
+                HoldDisplayBenchmark()
+                    : holdManager(mockApi, mockTaskRunner), dialogManager(mockDialogProvider),
+                    holdingSnapshot(holdManager, plugin)
+                {
+                    const std::vector<std::string> fixes = { "BNN", "BIG", "LAM", "OCK" };
+                    const std::vector<std::pair<double, double>> coordinates = {
+                        { 51.7261, -0.5500 }, { 51.3308, 0.0325 }, { 51.6461, 0.1517 }, { 51.3050, -0.4475 }
+                    };
+
+                    for (unsigned int hold = 0; hold < fixes.size(); hold++) {
+                        EuroScopePlugIn::CPosition position;
+                        position.m_Latitude = coordinates[hold].first;
+                        position.m_Longitude = coordinates[hold].second;
+                        this->navaids.push_back({ static_cast<int>(hold), fixes[hold], position });
+
+                        std::set<std::unique_ptr<DeemedSeparatedHold>> deemedSeparated;
+                        deemedSeparated.insert(std::make_unique<DeemedSeparatedHold>((hold + 1) % 4 + 1, 7));
+                        deemedSeparated.insert(std::make_unique<DeemedSeparatedHold>((hold + 3) % 4 + 1, 7));
+                        this->publishedHolds.Add(
+                            {
+                                hold + 1,
+                                fixes[hold],
+                                fixes[hold],
+                                7000,
+                                16000,
+                                90,
+                                HoldingData::TURN_DIRECTION_RIGHT,
+                                {},
+                                std::move(deemedSeparated)
+                            }
+                        );
+                    }
+
+                    for (int aircraft = 0; aircraft < aircraftCount; aircraft++) {
+                        int hold = aircraft % 4;
+                        std::string callsign = "BAW" + std::to_string(aircraft);
+
+                        ReplayRadarTarget radarTarget;
+                        radarTarget.callsign = callsign;
+                        radarTarget.flightLevel = 7000 + (aircraft / 4) * 1000;
+                        radarTarget.verticalSpeed = aircraft % 3 == 0 ? -1000 : 0;
+                        radarTarget.position = this->navaids[hold].coordinates;
+                        radarTarget.position.m_Latitude += 0.01 * (aircraft % 5);
+                        this->plugin.radarTargets[callsign] = radarTarget;
+
+                        ReplayFlightplan flightplan;
+                        flightplan.callsign = callsign;
+                        flightplan.clearedAltitude = radarTarget.flightLevel;
+                        this->plugin.flightplans[callsign] = flightplan;
+
+                        this->holdManager.AssignAircraftToHold(callsign, fixes[hold], false);
+                        this->holdManager.AddAircraftToProximityHold(callsign, fixes[(hold + 1) % 4]);
+                    }
+
+                    for (const Navaid & navaid : this->navaids) {
+                        this->displays.push_back(
+                            std::make_unique<HoldDisplay>(
+                                plugin,
+                                holdManager,
+                                navaid,
+                                publishedHolds,
+                                dialogManager,
+                                holdingSnapshot
+                            )
+                        );
+                        this->displays.back()->SetMaximumLevel(16000);
+                    }
+                }
+
+                /*
+                    Paint every display once, as the renderer does on each screen refresh.
+                */
+                void PaintFrame(void)
+                {
+                    this->holdingSnapshot.Refresh();
+                    for (const std::unique_ptr<HoldDisplay> & display : this->displays) {
+                        display->PaintWindow(this->graphics, this->radarScreen, 1);
+                    }
+                }
+
+                static constexpr int aircraftCount = 40;
+
+                // How many frames to measure
+                const int frames = 2000;
+
+                NiceMock<MockApiInterface> mockApi;
+                NiceMock<MockTaskRunnerInterface> mockTaskRunner;
+                NiceMock<MockDialogProvider> mockDialogProvider;
+                HoldDisplayPlugin plugin;
+                NullGraphics graphics;
+                NullRadarScreen radarScreen;
+                HoldManager holdManager;
+                DialogManager dialogManager;
+                HoldingSnapshot holdingSnapshot;
+                PublishedHoldCollection publishedHolds;
+                std::vector<Navaid> navaids;
+                std::vector<std::unique_ptr<HoldDisplay>> displays;
+        };
+
+        TEST_F(HoldDisplayBenchmark, ItReportsTheCostOfPaintingFourHoldDisplays)
+        {
+            // Warm up
+            this->PaintFrame();
+            this->plugin.lookups = 0;
+
+            size_t allocationsBefore = AllocationCounter::GetAllocations();
+            AllocationCounter::Start();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < this->frames; frame++) {
+                this->PaintFrame();
+            }
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            AllocationCounter::Stop();
+
+            std::cout << "Painted 4 holds with " << aircraftCount << " aircraft: "
+                << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / this->frames / 1000.0
+                << "us, " << (AllocationCounter::GetAllocations() - allocationsBefore) / this->frames
+                << " allocations and " << this->plugin.lookups / this->frames << " plugin lookups per frame"
+                << std::endl;
+
+            EXPECT_EQ(aircraftCount * 2 * this->frames, this->plugin.lookups);
+        }
+
+        TEST_F(HoldDisplayBenchmark, ItReportsTheCostOfFilteringTheVsl)
+        {
+            this->holdingSnapshot.Refresh();
+            size_t levels = 0;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < this->frames; frame++) {
+                for (const std::unique_ptr<HoldDisplay> & display : this->displays) {
+                    levels += display->MapAircraftToLevels(
+                        this->holdManager.GetAircraftForHold(display->navaid.identifier),
+                        this->holdingSnapshot
+                    ).size();
+                }
+            }
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+            std::cout << "Filtered the VSL of 4 holds with " << aircraftCount << " aircraft: "
+                << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / this->frames / 1000.0
+                << "us per frame" << std::endl;
+
+            EXPECT_EQ(4 * 10 * this->frames, levels);
+        }
+
+        TEST_F(HoldDisplayBenchmark, ItFiltersTheSameAircraftWithTheSharedSnapshot)
+        {
+            this->holdingSnapshot.Refresh();
+            for (const std::unique_ptr<HoldDisplay> & display : this->displays) {
+                const auto & aircraft = this->holdManager.GetAircraftForHold(display->navaid.identifier);
+                EXPECT_EQ(
+                    display->MapAircraftToLevels(aircraft),
+                    display->MapAircraftToLevels(aircraft, this->holdingSnapshot)
+                );
+            }
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
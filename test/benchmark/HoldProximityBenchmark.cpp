@@ -0,0 +1,159 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "benchmark/ReplayFlightplan.h"
+#include "benchmark/ReplayRadarTarget.h"
+#include "hold/HoldEventHandler.h"
+#include "hold/HoldManager.h"
+#include "navaids/NavaidCollection.h"
+#include "timedevent/AbstractTimedEvent.h"
+#include "mock/MockApiInterface.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "mock/MockTaskRunnerInterface.h"
+
+using ::testing::NiceMock;
+using ::testing::Test;
+using UKControllerPlugin::Hold::HoldEventHandler;
+using UKControllerPlugin::Hold::HoldManager;
+using UKControllerPlugin::Navaids::Navaid;
+using UKControllerPlugin::Navaids::NavaidCollection;
+using UKControllerPlugin::TimedEvent::AbstractTimedEvent;
+using UKControllerPluginTest::Api::MockApiInterface;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Moves every aircraft a little way east each time it is triggered, roughly what
+            a jet covers between hold proximity checks.
+        */
+        class AircraftMover : public AbstractTimedEvent
+        {
+            public:
+                explicit AircraftMover(std::vector<std::shared_ptr<ReplayRadarTarget>> & radarTargets)
+                    : radarTargets(radarTargets)
+                {
+                }
+
+                void TimedEventTrigger(void) override
+                {
+                    for (const std::shared_ptr<ReplayRadarTarget> & radarTarget : this->radarTargets) {
+                        radarTarget->position.m_Longitude += 0.02;
+                    }
+                }
+
+            private:
+                std::vector<std::shared_ptr<ReplayRadarTarget>> & radarTargets;
+        };
+
+        /*
+            Measures the per-tick cost of working out which holds every aircraft is near,
+            with 1,500 aircraft spread over the UK and 300 navaids.
+        */
+        class HoldProximityBenchmark : public Test
+        {
+            public:
+                HoldProximityBenchmark()
+                    : harness(0), manager(mockApi, mockTaskRunner),
+                    handler(std::make_shared<HoldEventHandler>(manager, navaids, mockPlugin, 1))
+                {
+                    // A 20 x 15 grid of navaids, about 30nm apart
+                    for (int row = 0; row < 20; row++) {
+                        for (int column = 0; column < 15; column++) {
+                            EuroScopePlugIn::CPosition position;
+                            position.m_Latitude = 49.5 + row * 0.5;
+                            position.m_Longitude = -8.0 + column * 0.7;
+                            int id = row * 15 + column;
+                            this->navaids.AddNavaid({ id, "NAV" + std::to_string(id), position });
+                        }
+                    }
+
+                    // Aircraft spread evenly but irregularly over the same area
+                    for (size_t aircraft = 0; aircraft < aircraftCount; aircraft++) {
+                        std::shared_ptr<ReplayFlightplan> flightplan = std::make_shared<ReplayFlightplan>();
+                        flightplan->callsign = "BAW" + std::to_string(aircraft);
+
+                        std::shared_ptr<ReplayRadarTarget> radarTarget = std::make_shared<ReplayRadarTarget>();
+                        radarTarget->callsign = flightplan->callsign;
+                        radarTarget->position.m_Latitude = 49.5 + std::fmod(aircraft * 0.6180339887, 1.0) * 10.0;
+                        radarTarget->position.m_Longitude = -8.0 + std::fmod(aircraft * 0.7548776662, 1.0) * 10.0;
+
+                        this->radarTargets.push_back(radarTarget);
+                        this->mockPlugin.AddAllFlightplansItem({ flightplan, radarTarget });
+                    }
+
+                    this->harness.AddTimedEvent("HoldEventHandler", this->handler, 1);
+                }
+
+                /*
+                    Check the hold manager against the old approach of checking every navaid.
+                */
+                void AssertProximityHoldsMatchBruteForce(void)
+                {
+                    for (const std::shared_ptr<ReplayRadarTarget> & radarTarget : this->radarTargets) {
+                        std::set<std::string> expected;
+                        for (auto navaid = this->navaids.cbegin(); navaid != this->navaids.cend(); ++navaid) {
+                            if (radarTarget->position.DistanceTo(navaid->coordinates) <= handler->proximityDistance) {
+                                expected.insert(navaid->identifier);
+                            }
+                        }
+
+                        auto aircraft = this->manager.GetHoldingAircraft(radarTarget->callsign);
+                        EXPECT_EQ(expected, aircraft ? aircraft->GetProximityHolds() : std::set<std::string>());
+                    }
+                }
+
+                void AddTicks(int ticks)
+                {
+                    for (int second = 1; second <= ticks; second++) {
+                        this->harness.AddEvent({ ReplayEventType::Timer, 0, second });
+                    }
+                }
+
+                static constexpr size_t aircraftCount = 1500;
+
+                // How many ticks to measure
+                const int ticks = 30;
+
+                EventReplayHarness harness;
+                NavaidCollection navaids;
+                NiceMock<MockApiInterface> mockApi;
+                NiceMock<MockTaskRunnerInterface> mockTaskRunner;
+                NiceMock<MockEuroscopePluginLoopbackInterface> mockPlugin;
+                HoldManager manager;
+                std::shared_ptr<HoldEventHandler> handler;
+                std::vector<std::shared_ptr<ReplayRadarTarget>> radarTargets;
+        };
+
+        TEST_F(HoldProximityBenchmark, ItDoesNotAllocateWhenNothingChanges)
+        {
+            this->AddTicks(this->ticks);
+
+            // The first tick puts everybody in their proximity holds
+            this->handler->TimedEventTrigger();
+            this->harness.Replay(1);
+            std::cout << this->harness.GetReport();
+
+            EXPECT_EQ(this->ticks, this->harness.GetProfile("HoldEventHandler").GetEvents());
+            EXPECT_EQ(0, this->harness.GetProfile("HoldEventHandler").GetAllocations());
+            this->AssertProximityHoldsMatchBruteForce();
+        }
+
+        TEST_F(HoldProximityBenchmark, ItTracksAircraftAsTheyFly)
+        {
+            this->harness.AddTimedEvent("AircraftMover", std::make_shared<AircraftMover>(this->radarTargets), 1);
+            this->AddTicks(this->ticks);
+
+            this->handler->TimedEventTrigger();
+            this->harness.Replay(1);
+            std::cout << this->harness.GetReport();
+
+            EXPECT_EQ(this->ticks, this->harness.GetProfile("HoldEventHandler").GetEvents());
+
+            // Catch up with the last move
+            this->handler->TimedEventTrigger();
+            this->AssertProximityHoldsMatchBruteForce();
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,109 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "flightplan/CallsignRegistry.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanEventHandler.h"
+#include "handoff/HandoffCollection.h"
+#include "handoff/HandoffEventHandler.h"
+#include "historytrail/HistoryTrailEventHandler.h"
+#include "historytrail/HistoryTrailRepository.h"
+#include "wake/WakeCategoryEventHandler.h"
+#include "wake/WakeCategoryMapper.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+using UKControllerPlugin::Handoff::HandoffCollection;
+using UKControllerPlugin::Handoff::HandoffEventHandler;
+using UKControllerPlugin::HistoryTrail::HistoryTrailEventHandler;
+using UKControllerPlugin::HistoryTrail::HistoryTrailRepository;
+using UKControllerPlugin::Wake::WakeCategoryEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryMapper;
+using UKControllerPluginTest::Benchmark::EventReplayHarness;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Replays a busy period through the per-frame hot path handlers and
+            reports what each one costs.
+        */
+        class HotPathBenchmark : public Test
+        {
+            public:
+                HotPathBenchmark()
+                    : harness(aircraftCount)
+                {
+                    this->ukMapper.AddCategoryMapping("A320", "LM");
+                    this->ukMapper.AddCategoryMapping("B738", "LM");
+                    this->ukMapper.AddCategoryMapping("A388", "J");
+                    this->ukMapper.AddCategoryMapping("B77W", "H");
+                    this->recatMapper.AddCategoryMapping("A320", "D");
+                    this->recatMapper.AddCategoryMapping("B738", "D");
+                    this->recatMapper.AddCategoryMapping("A388", "A");
+                    this->recatMapper.AddCategoryMapping("B77W", "B");
+                }
+
+                // Roughly what a busy evening looks like across the UK
+                static const size_t aircraftCount = 1500;
+
+                // How long a period to replay
+                const int seconds = 30;
+
+                WakeCategoryMapper ukMapper;
+                WakeCategoryMapper recatMapper;
+                HandoffCollection handoffs;
+                ActiveCallsignCollection activeCallsigns;
+                CallsignRegistry aircraft;
+                HistoryTrailRepository trails;
+                StoredFlightplanCollection storedFlightplans;
+                EventReplayHarness harness;
+        };
+
+        TEST_F(HotPathBenchmark, ItReportsTheCostOfTheHotPath)
+        {
+            std::shared_ptr<HistoryTrailEventHandler> historyTrails =
+                std::make_shared<HistoryTrailEventHandler>(this->trails);
+            std::shared_ptr<WakeCategoryEventHandler> wake =
+                std::make_shared<WakeCategoryEventHandler>(
+                    this->ukMapper,
+                    this->recatMapper,
+                    this->aircraft
+                );
+            std::shared_ptr<HandoffEventHandler> handoff =
+                std::make_shared<HandoffEventHandler>(
+                    this->handoffs,
+                    this->activeCallsigns,
+                    this->aircraft
+                );
+            std::shared_ptr<StoredFlightplanEventHandler> storedFlightplan =
+                std::make_shared<StoredFlightplanEventHandler>(this->storedFlightplans);
+
+            this->harness.AddRadarTargetHandler("HistoryTrailEventHandler", historyTrails);
+            this->harness.AddFlightplanHandler("HistoryTrailEventHandler (fp)", historyTrails);
+            this->harness.AddFlightplanHandler("WakeCategoryEventHandler (fp)", wake);
+            this->harness.AddFlightplanHandler("HandoffEventHandler (fp)", handoff);
+            this->harness.AddFlightplanHandler("StoredFlightplanEventHandler (fp)", storedFlightplan);
+            this->harness.AddTagItem("WakeCategoryEventHandler (105)", wake->tagItemIdAircraftTypeCategory, wake);
+            this->harness.AddTagItem("WakeCategoryEventHandler (114)", wake->tagItemIdUkRecatCombined, wake);
+            this->harness.AddTagItem("HandoffEventHandler (107)", 107, handoff);
+            this->harness.AddTimedEvent("StoredFlightplanEventHandler (timer)", storedFlightplan, 1);
+
+            this->harness.GenerateBusyPeriod(this->seconds);
+            this->harness.Replay(1);
+            std::cout << this->harness.GetReport();
+
+            EXPECT_EQ(
+                aircraftCount * 3 * this->seconds,
+                this->harness.GetProfile(this->harness.tagItemCollectionProfile).GetEvents()
+            );
+            EXPECT_EQ(
+                aircraftCount * this->seconds / this->harness.radarUpdateInterval,
+                this->harness.GetProfile("HistoryTrailEventHandler").GetEvents()
+            );
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,77 @@
+#include "pch/pch.h"
+#include "benchmark/StandInApiServer.h"
+#include "curl/CurlRequest.h"
+#include "curl/PooledCurlApi.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Curl::PooledCurlApi;
+using UKControllerPluginTest::Benchmark::StandInApiServer;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Makes real requests through the pool to a stand-in API server on the loopback interface.
+        */
+        class PooledCurlApiIntegrationTest : public Test
+        {
+            public:
+                PooledCurlApiIntegrationTest()
+                    : server([](std::string target) { return "{\"target\": \"" + target + "\"}"; },
+                        std::chrono::milliseconds(0)),
+                    curl(false, 2, "")
+                {
+                }
+
+                StandInApiServer server;
+                PooledCurlApi curl;
+        };
+
+        TEST_F(PooledCurlApiIntegrationTest, ItMakesRequests)
+        {
+            CurlResponse response = this->curl.MakeCurlRequest(
+                CurlRequest(this->server.GetUrl() + "/test", CurlRequest::METHOD_GET)
+            );
+
+            EXPECT_FALSE(response.IsCurlError());
+            EXPECT_EQ(200, response.GetStatusCode());
+            EXPECT_EQ(nlohmann::json({ {"target", "/test"} }), nlohmann::json::parse(response.GetResponse()));
+        }
+
+        TEST_F(PooledCurlApiIntegrationTest, ItReusesHandlesForLaterRequests)
+        {
+            this->curl.MakeCurlRequest(CurlRequest(this->server.GetUrl() + "/one", CurlRequest::METHOD_GET));
+            EXPECT_EQ(1, this->curl.CountIdleHandles());
+
+            CurlResponse response = this->curl.MakeCurlRequest(
+                CurlRequest(this->server.GetUrl() + "/two", CurlRequest::METHOD_POST)
+            );
+            EXPECT_EQ(1, this->curl.CountIdleHandles());
+            EXPECT_EQ(nlohmann::json({ {"target", "/two"} }), nlohmann::json::parse(response.GetResponse()));
+        }
+
+        TEST_F(PooledCurlApiIntegrationTest, ItOnlyKeepsTheMaximumIdleHandles)
+        {
+            PooledCurlApi noIdleHandles(false, 0, "");
+            CurlResponse response = noIdleHandles.MakeCurlRequest(
+                CurlRequest(this->server.GetUrl() + "/test", CurlRequest::METHOD_GET)
+            );
+
+            EXPECT_EQ(200, response.GetStatusCode());
+            EXPECT_EQ(0, noIdleHandles.CountIdleHandles());
+        }
+
+        TEST_F(PooledCurlApiIntegrationTest, ItReturnsCurlErrorsAndKeepsTheHandle)
+        {
+            // Nothing listens on the discard port
+            CurlResponse response = this->curl.MakeCurlRequest(
+                CurlRequest("http://127.0.0.1:9", CurlRequest::METHOD_GET)
+            );
+
+            EXPECT_TRUE(response.IsCurlError());
+            EXPECT_EQ(1, this->curl.CountIdleHandles());
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
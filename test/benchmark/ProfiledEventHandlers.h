@@ -0,0 +1,160 @@
+#pragma once
+#include "benchmark/AllocationCounter.h"
+#include "benchmark/HandlerProfile.h"
+#include "euroscope/RadarTargetEventHandlerInterface.h"
+#include "flightplan/FlightPlanEventHandlerInterface.h"
+#include "tag/TagItemInterface.h"
+#include "timedevent/AbstractTimedEvent.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Time a call and count its allocations, recording the result against the profile.
+        */
+        template <typename Callable>
+        inline void ProfileCall(HandlerProfile & profile, Callable call)
+        {
+            size_t allocationsBefore = AllocationCounter::GetAllocations();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            call();
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            size_t allocationsAfter = AllocationCounter::GetAllocations();
+
+            profile.Record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                allocationsAfter - allocationsBefore
+            );
+        }
+
+        /*
+            Wraps a radar target event handler so that its cost can be profiled.
+        */
+        class ProfiledRadarTargetEventHandler : public UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface
+        {
+            public:
+                ProfiledRadarTargetEventHandler(
+                    std::shared_ptr<UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface> handler,
+                    std::shared_ptr<HandlerProfile> profile
+                ) : handler(handler), profile(profile)
+                {
+                }
+
+                void RadarTargetPositionUpdateEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) override {
+                    ProfileCall(*this->profile, [this, &radarTarget]() {
+                        this->handler->RadarTargetPositionUpdateEvent(radarTarget);
+                    });
+                }
+
+            private:
+                std::shared_ptr<UKControllerPlugin::Euroscope::RadarTargetEventHandlerInterface> handler;
+                std::shared_ptr<HandlerProfile> profile;
+        };
+
+        /*
+            Wraps a flightplan event handler so that its cost can be profiled.
+        */
+        class ProfiledFlightPlanEventHandler : public UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface
+        {
+            public:
+                ProfiledFlightPlanEventHandler(
+                    std::shared_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface> handler,
+                    std::shared_ptr<HandlerProfile> profile
+                ) : handler(handler), profile(profile)
+                {
+                }
+
+                void FlightPlanEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface & radarTarget
+                ) override {
+                    ProfileCall(*this->profile, [this, &flightPlan, &radarTarget]() {
+                        this->handler->FlightPlanEvent(flightPlan, radarTarget);
+                    });
+                }
+
+                void FlightPlanDisconnectEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan
+                ) override {
+                    ProfileCall(*this->profile, [this, &flightPlan]() {
+                        this->handler->FlightPlanDisconnectEvent(flightPlan);
+                    });
+                }
+
+                void ControllerFlightPlanDataEvent(
+                    UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface & flightPlan,
+                    int dataType
+                ) override {
+                    ProfileCall(*this->profile, [this, &flightPlan, dataType]() {
+                        this->handler->ControllerFlightPlanDataEvent(flightPlan, dataType);
+                    });
+                }
+
+                unsigned int GetFlightplanFieldDependencies(void) const override
+                {
+                    return this->handler->GetFlightplanFieldDependencies();
+                }
+
+            private:
+                std::shared_ptr<UKControllerPlugin::Flightplan::FlightPlanEventHandlerInterface> handler;
+                std::shared_ptr<HandlerProfile> profile;
+        };
+
+        /*
+            Wraps a tag item so that its cost can be profiled.
+        */
+        class ProfiledTagItem : public UKControllerPlugin::Tag::TagItemInterface
+        {
+            public:
+                ProfiledTagItem(
+                    std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem,
+                    std::shared_ptr<HandlerProfile> profile
+                ) : tagItem(tagItem), profile(profile)
+                {
+                }
+
+                std::string GetTagItemDescription(int tagItemId) const override
+                {
+                    return this->tagItem->GetTagItemDescription(tagItemId);
+                }
+
+                void SetTagItemData(UKControllerPlugin::Tag::TagData & tagData) override
+                {
+                    ProfileCall(*this->profile, [this, &tagData]() {
+                        this->tagItem->SetTagItemData(tagData);
+                    });
+                }
+
+            private:
+                std::shared_ptr<UKControllerPlugin::Tag::TagItemInterface> tagItem;
+                std::shared_ptr<HandlerProfile> profile;
+        };
+
+        /*
+            Wraps a timed event so that its cost can be profiled.
+        */
+        class ProfiledTimedEvent : public UKControllerPlugin::TimedEvent::AbstractTimedEvent
+        {
+            public:
+                ProfiledTimedEvent(
+                    std::shared_ptr<UKControllerPlugin::TimedEvent::AbstractTimedEvent> event,
+                    std::shared_ptr<HandlerProfile> profile
+                ) : event(event), profile(profile)
+                {
+                }
+
+                void TimedEventTrigger(void) override
+                {
+                    ProfileCall(*this->profile, [this]() {
+                        this->event->TimedEventTrigger();
+                    });
+                }
+
+            private:
+                std::shared_ptr<UKControllerPlugin::TimedEvent::AbstractTimedEvent> event;
+                std::shared_ptr<HandlerProfile> profile;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
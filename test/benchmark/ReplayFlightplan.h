@@ -0,0 +1,174 @@
+#pragma once
+#include "euroscope/EuroScopeCFlightPlanInterface.h"
+#include "euroscope/EuroscopeExtractedRouteInterface.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            A lightweight flightplan for replaying events. Unlike the gmock version, calls
+            to this don't allocate or do expectation matching, so it doesn't skew the
+            benchmark figures.
+
+            The extracted route is backed by an empty EuroScope route, so handlers that walk
+            the route can't be replayed through this class.
+        */
+        class ReplayFlightplan : public UKControllerPlugin::Euroscope::EuroScopeCFlightPlanInterface
+        {
+            public:
+                void AnnotateFlightStrip(int index, std::string data) const override
+                {
+                }
+
+                std::string GetAnnotation(int index) const override
+                {
+                    return "";
+                }
+
+                const std::string GetCallsign(void) const override
+                {
+                    return this->callsign;
+                }
+
+                const int GetClearedAltitude(void) const override
+                {
+                    return this->clearedAltitude;
+                }
+
+                const int GetCruiseLevel(void) const override
+                {
+                    return this->cruiseLevel;
+                }
+
+                const std::string GetDestination(void) const override
+                {
+                    return this->destination;
+                }
+
+                const double GetDistanceFromOrigin(void) const override
+                {
+                    return this->distanceFromOrigin;
+                }
+
+                std::string GetExpectedDepartureTime(void) const override
+                {
+                    return this->expectedDepartureTime;
+                }
+
+                UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface GetExtractedRoute(
+                    void
+                ) const override {
+                    return UKControllerPlugin::Euroscope::EuroscopeExtractedRouteInterface(
+                        EuroScopePlugIn::CFlightPlanExtractedRoute()
+                    );
+                }
+
+                std::string GetFlightRules(void) const override
+                {
+                    return this->flightRules;
+                }
+
+                std::string GetGroundState(void) const override
+                {
+                    return this->groundState;
+                }
+
+                const std::string GetOrigin(void) const override
+                {
+                    return this->origin;
+                }
+
+                std::string GetRawRouteString(void) const override
+                {
+                    return this->route;
+                }
+
+                const std::string GetSidName(void) const override
+                {
+                    return this->sid;
+                }
+
+                std::string GetAssignedSquawk(void) const override
+                {
+                    return this->squawk;
+                }
+
+                std::string GetAircraftType(void) const override
+                {
+                    return this->aircraftType;
+                }
+
+                std::string GetIcaoWakeCategory(void) const override
+                {
+                    return this->icaoWakeCategory;
+                }
+
+                bool HasAssignedSquawk(void) const override
+                {
+                    return this->squawk != "";
+                }
+
+                const bool HasControllerClearedAltitude(void) const override
+                {
+                    return this->clearedAltitude != 0;
+                }
+
+                bool HasSid(void) const override
+                {
+                    return this->sid != "";
+                }
+
+                void SetClearedAltitude(int cleared) override
+                {
+                    this->clearedAltitude = cleared;
+                }
+
+                void SetSquawk(std::string squawk) override
+                {
+                    this->squawk = squawk;
+                }
+
+                bool IsSimulated(void) const override
+                {
+                    return false;
+                }
+
+                const bool IsTracked(void) const override
+                {
+                    return this->tracked;
+                }
+
+                const bool IsTrackedByUser(void) const override
+                {
+                    return this->trackedByUser;
+                }
+
+                bool IsValid(void) const override
+                {
+                    return true;
+                }
+
+                bool IsVfr(void) const override
+                {
+                    return this->flightRules == "V";
+                }
+
+                std::string callsign;
+                std::string origin;
+                std::string destination;
+                std::string sid;
+                std::string route;
+                std::string squawk;
+                std::string aircraftType;
+                std::string icaoWakeCategory = "M";
+                std::string flightRules = "I";
+                std::string groundState = "";
+                std::string expectedDepartureTime = "";
+                int cruiseLevel = 0;
+                int clearedAltitude = 0;
+                double distanceFromOrigin = 0.0;
+                bool tracked = false;
+                bool trackedByUser = false;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,45 @@
+#pragma once
+#include "euroscope/EuroScopeCRadarTargetInterface.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            A lightweight radar target for replaying events, see ReplayFlightplan.
+        */
+        class ReplayRadarTarget : public UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface
+        {
+            public:
+                const std::string GetCallsign(void) const override
+                {
+                    return this->callsign;
+                }
+
+                int GetFlightLevel(void) const override
+                {
+                    return this->flightLevel;
+                }
+
+                const EuroScopePlugIn::CPosition GetPosition(void) const override
+                {
+                    return this->position;
+                }
+
+                const int GetGroundSpeed(void) const override
+                {
+                    return this->groundSpeed;
+                }
+
+                int GetVerticalSpeed(void) const override
+                {
+                    return this->verticalSpeed;
+                }
+
+                std::string callsign;
+                int flightLevel = 0;
+                EuroScopePlugIn::CPosition position;
+                int groundSpeed = 0;
+                int verticalSpeed = 0;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
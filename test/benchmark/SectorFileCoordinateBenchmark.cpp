@@ -0,0 +1,112 @@
+#include "pch/pch.h"
+#include "sectorfile/SectorFileCoordinates.h"
+#include "helper/RegexSectorFileCoordinates.h"
+
+using ::testing::Test;
+using UKControllerPlugin::SectorFile::ParseSectorFileCoordinateBuffer;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Compares the bulk coordinate parser against parsing each pair using the regular
+            expressions that the sector file coordinates used to be checked with.
+        */
+        class SectorFileCoordinateBenchmark : public Test
+        {
+            public:
+                SectorFileCoordinateBenchmark()
+                {
+                    // Pairs spread over the UK, as found in sector files
+                    for (int pair = 0; pair < pairs; pair++) {
+                        this->buffer += this->FormatCoordinate(
+                            pair % 7 == 0 ? 'S' : 'N',
+                            49 + pair % 12,
+                            (pair * 7) % 60,
+                            (pair * 13) % 60,
+                            (pair * 37) % 1000
+                        );
+                        this->buffer += " ";
+                        this->buffer += this->FormatCoordinate(
+                            pair % 3 == 0 ? 'E' : 'W',
+                            pair % 9,
+                            (pair * 11) % 60,
+                            (pair * 17) % 60,
+                            (pair * 71) % 1000
+                        );
+                        this->buffer += "\r\n";
+                    }
+                }
+
+                std::string FormatCoordinate(char hemisphere, int degrees, int minutes, int seconds, int thousandths)
+                {
+                    char coordinate[16];
+                    snprintf(
+                        coordinate,
+                        sizeof(coordinate),
+                        "%c%03d.%02d.%02d.%03d",
+                        hemisphere,
+                        degrees,
+                        minutes,
+                        seconds,
+                        thousandths
+                    );
+                    return coordinate;
+                }
+
+                /*
+                    Splits the buffer into pairs and parses each one using the regex parser.
+                */
+                std::vector<EuroScopePlugIn::CPosition> ParseBufferWithRegex(void) const
+                {
+                    std::vector<EuroScopePlugIn::CPosition> positions;
+                    std::istringstream stream(this->buffer);
+                    std::string latitude;
+                    std::string longitude;
+                    while (stream >> latitude >> longitude) {
+                        positions.push_back(ParseSectorFileCoordinatesWithRegex(latitude, longitude));
+                    }
+
+                    return positions;
+                }
+
+                template <typename Function>
+                std::vector<EuroScopePlugIn::CPosition> Time(std::string name, Function function)
+                {
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    std::vector<EuroScopePlugIn::CPosition> positions = function();
+                    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+                    double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()
+                        / 1000000.0;
+                    std::cout << name << ": " << (this->buffer.size() / (1024.0 * 1024.0)) / seconds << "MB/s"
+                        << std::endl;
+
+                    return positions;
+                }
+
+                static constexpr int pairs = 100000;
+
+                std::string buffer;
+        };
+
+        TEST_F(SectorFileCoordinateBenchmark, ItParsesABufferFasterThanTheRegex)
+        {
+            std::vector<EuroScopePlugIn::CPosition> regexPositions = this->Time(
+                "Regex",
+                [this]() { return this->ParseBufferWithRegex(); }
+            );
+            std::vector<EuroScopePlugIn::CPosition> bulkPositions = this->Time(
+                "Bulk",
+                [this]() { return ParseSectorFileCoordinateBuffer(this->buffer); }
+            );
+
+            ASSERT_EQ(pairs, regexPositions.size());
+            ASSERT_EQ(pairs, bulkPositions.size());
+            for (int pair = 0; pair < pairs; pair++) {
+                EXPECT_EQ(regexPositions[pair].m_Latitude, bulkPositions[pair].m_Latitude);
+                EXPECT_EQ(regexPositions[pair].m_Longitude, bulkPositions[pair].m_Longitude);
+            }
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,93 @@
+#include "pch/pch.h"
+#include "benchmark/StandInApiServer.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        StandInApiServer::StandInApiServer(
+            std::function<std::string(std::string target)> responder,
+            std::chrono::milliseconds latency
+        )
+            : responder(responder), latency(latency), requests(0),
+            acceptor(this->ioContext, { boost::asio::ip::address_v4::loopback(), 0 })
+        {
+            this->Accept();
+            this->serverThread = std::thread([this]() { this->ioContext.run(); });
+        }
+
+        StandInApiServer::~StandInApiServer(void)
+        {
+            this->ioContext.stop();
+            this->serverThread.join();
+        }
+
+        std::string StandInApiServer::GetUrl(void) const
+        {
+            return "http://127.0.0.1:" + std::to_string(this->acceptor.local_endpoint().port());
+        }
+
+        size_t StandInApiServer::CountRequests(void) const
+        {
+            return this->requests;
+        }
+
+        void StandInApiServer::Accept(void)
+        {
+            this->acceptor.async_accept(
+                this->ioContext,
+                [this](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
+                    if (ec) {
+                        return;
+                    }
+
+                    this->Respond(std::make_shared<boost::beast::tcp_stream>(std::move(socket)));
+                    this->Accept();
+                }
+            );
+        }
+
+        /*
+            Read a request, wait for the latency to pass and then send the response and close the connection.
+        */
+        void StandInApiServer::Respond(std::shared_ptr<boost::beast::tcp_stream> stream)
+        {
+            std::shared_ptr<boost::beast::flat_buffer> buffer = std::make_shared<boost::beast::flat_buffer>();
+            std::shared_ptr<boost::beast::http::request<boost::beast::http::string_body>> request =
+                std::make_shared<boost::beast::http::request<boost::beast::http::string_body>>();
+
+            boost::beast::http::async_read(
+                *stream,
+                *buffer,
+                *request,
+                [this, stream, buffer, request](boost::system::error_code ec, std::size_t bytesRead) {
+                    if (ec) {
+                        return;
+                    }
+
+                    std::shared_ptr<boost::asio::steady_timer> timer =
+                        std::make_shared<boost::asio::steady_timer>(this->ioContext, this->latency);
+                    timer->async_wait([this, stream, request, timer](boost::system::error_code ec) {
+                        std::shared_ptr<boost::beast::http::response<boost::beast::http::string_body>> response =
+                            std::make_shared<boost::beast::http::response<boost::beast::http::string_body>>(
+                                boost::beast::http::status::ok,
+                                request->version()
+                            );
+                        response->set(boost::beast::http::field::content_type, "application/json");
+                        response->body() = this->responder(std::string(request->target()));
+                        response->keep_alive(false);
+                        response->prepare_payload();
+                        this->requests++;
+
+                        boost::beast::http::async_write(
+                            *stream,
+                            *response,
+                            [stream, response](boost::system::error_code ec, std::size_t bytesWritten) {
+                                stream->socket().shutdown(boost::asio::ip::tcp::socket::shutdown_send, ec);
+                            }
+                        );
+                    });
+                }
+            );
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
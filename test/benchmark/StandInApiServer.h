@@ -0,0 +1,46 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            A plain HTTP server on the loopback interface that stands in for the web API. Every
+            response is held back by a fixed latency, roughly a round trip to the real API, and
+            requests are answered concurrently.
+        */
+        class StandInApiServer
+        {
+            public:
+                StandInApiServer(
+                    std::function<std::string(std::string target)> responder,
+                    std::chrono::milliseconds latency
+                );
+                ~StandInApiServer(void);
+                std::string GetUrl(void) const;
+                size_t CountRequests(void) const;
+
+            private:
+
+                void Accept(void);
+                void Respond(std::shared_ptr<boost::beast::tcp_stream> stream);
+
+                // Produces the JSON body for a request target
+                const std::function<std::string(std::string target)> responder;
+
+                // How long to wait before responding
+                const std::chrono::milliseconds latency;
+
+                // How many requests have been answered
+                std::atomic<size_t> requests;
+
+                // Io context for the server
+                boost::asio::io_context ioContext;
+
+                // Accepts connections
+                boost::asio::ip::tcp::acceptor acceptor;
+
+                // Runs the io context
+                std::thread serverThread;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
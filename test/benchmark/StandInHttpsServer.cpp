@@ -0,0 +1,130 @@
+#include "pch/pch.h"
+#include "benchmark/StandInHttpsServer.h"
+#include "benchmark/BenchmarkCertificate.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        StandInHttpsServer::StandInHttpsServer(
+            std::function<std::string(std::string target)> responder,
+            std::chrono::milliseconds latency
+        )
+            : responder(responder), latency(latency), connections(0), requests(0),
+            sslContext(boost::asio::ssl::context::tlsv12_server),
+            acceptor(this->ioContext, { boost::asio::ip::address_v4::loopback(), 0 })
+        {
+            this->sslContext.use_certificate_chain(boost::asio::buffer(std::string(benchmarkCertificate)));
+            this->sslContext.use_private_key(
+                boost::asio::buffer(std::string(benchmarkPrivateKey)),
+                boost::asio::ssl::context::file_format::pem
+            );
+
+            this->Accept();
+            this->serverThread = std::thread([this]() { this->ioContext.run(); });
+        }
+
+        StandInHttpsServer::~StandInHttpsServer(void)
+        {
+            this->ioContext.stop();
+            this->serverThread.join();
+        }
+
+        /*
+            The certificate is for localhost, so that's the name to use.
+        */
+        std::string StandInHttpsServer::GetUrl(void) const
+        {
+            return "https://localhost:" + std::to_string(this->acceptor.local_endpoint().port());
+        }
+
+        size_t StandInHttpsServer::CountConnections(void) const
+        {
+            return this->connections;
+        }
+
+        size_t StandInHttpsServer::CountRequests(void) const
+        {
+            return this->requests;
+        }
+
+        void StandInHttpsServer::Accept(void)
+        {
+            this->acceptor.async_accept(
+                this->ioContext,
+                [this](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
+                    if (ec) {
+                        return;
+                    }
+
+                    this->connections++;
+                    std::shared_ptr<HttpsStream> stream = std::make_shared<HttpsStream>(
+                        std::move(socket),
+                        this->sslContext
+                    );
+                    stream->async_handshake(
+                        boost::asio::ssl::stream_base::server,
+                        [this, stream](boost::system::error_code ec) {
+                            if (ec) {
+                                return;
+                            }
+
+                            this->Respond(stream, std::make_shared<boost::beast::flat_buffer>());
+                        }
+                    );
+
+                    this->Accept();
+                }
+            );
+        }
+
+        /*
+            Read a request, wait for the latency to pass and then send the response. If the client
+            wants to keep the connection alive, wait for the next request.
+        */
+        void StandInHttpsServer::Respond(
+            std::shared_ptr<HttpsStream> stream,
+            std::shared_ptr<boost::beast::flat_buffer> buffer
+        ) {
+            std::shared_ptr<boost::beast::http::request<boost::beast::http::string_body>> request =
+                std::make_shared<boost::beast::http::request<boost::beast::http::string_body>>();
+
+            boost::beast::http::async_read(
+                *stream,
+                *buffer,
+                *request,
+                [this, stream, buffer, request](boost::system::error_code ec, std::size_t bytesRead) {
+                    if (ec) {
+                        return;
+                    }
+
+                    std::shared_ptr<boost::asio::steady_timer> timer =
+                        std::make_shared<boost::asio::steady_timer>(this->ioContext, this->latency);
+                    timer->async_wait([this, stream, buffer, request, timer](boost::system::error_code ec) {
+                        std::shared_ptr<boost::beast::http::response<boost::beast::http::string_body>> response =
+                            std::make_shared<boost::beast::http::response<boost::beast::http::string_body>>(
+                                boost::beast::http::status::ok,
+                                request->version()
+                            );
+                        response->set(boost::beast::http::field::content_type, "application/json");
+                        response->body() = this->responder(std::string(request->target()));
+                        response->keep_alive(request->keep_alive());
+                        response->prepare_payload();
+                        this->requests++;
+
+                        boost::beast::http::async_write(
+                            *stream,
+                            *response,
+                            [this, stream, buffer, response](boost::system::error_code ec, std::size_t bytesWritten) {
+                                if (ec || !response->keep_alive()) {
+                                    return;
+                                }
+
+                                this->Respond(stream, buffer);
+                            }
+                        );
+                    });
+                }
+            );
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            An HTTPS server on the loopback interface that stands in for the web API. It uses TLS
+            with the self-signed benchmark certificate and keeps connections alive between requests,
+            as the real API does, so that clients can reuse them.
+        */
+        class StandInHttpsServer
+        {
+            public:
+                StandInHttpsServer(
+                    std::function<std::string(std::string target)> responder,
+                    std::chrono::milliseconds latency
+                );
+                ~StandInHttpsServer(void);
+                std::string GetUrl(void) const;
+                size_t CountConnections(void) const;
+                size_t CountRequests(void) const;
+
+            private:
+
+                typedef boost::beast::ssl_stream<boost::beast::tcp_stream> HttpsStream;
+
+                void Accept(void);
+                void Respond(std::shared_ptr<HttpsStream> stream, std::shared_ptr<boost::beast::flat_buffer> buffer);
+
+                // Produces the JSON body for a request target
+                const std::function<std::string(std::string target)> responder;
+
+                // How long to wait before responding
+                const std::chrono::milliseconds latency;
+
+                // How many connections have been accepted
+                std::atomic<size_t> connections;
+
+                // How many requests have been answered
+                std::atomic<size_t> requests;
+
+                // Io context for the server
+                boost::asio::io_context ioContext;
+
+                // SSL context with the benchmark certificate
+                boost::asio::ssl::context sslContext;
+
+                // Accepts connections
+                boost::asio::ip::tcp::acceptor acceptor;
+
+                // Runs the io context
+                std::thread serverThread;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
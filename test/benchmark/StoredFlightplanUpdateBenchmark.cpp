@@ -0,0 +1,80 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanEventHandler.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Replays repeated flightplan updates through the stored flightplan handler, where
+            almost nothing in each flightplan changes between updates, as is the case for
+            most of the updates EuroScope sends.
+        */
+        class StoredFlightplanUpdateBenchmark : public Test
+        {
+            public:
+                StoredFlightplanUpdateBenchmark()
+                    : harness(aircraftCount)
+                {
+                    this->harness.AddFlightplanHandler(
+                        "StoredFlightplanEventHandler",
+                        std::make_shared<StoredFlightplanEventHandler>(this->storedFlightplans)
+                    );
+
+                    for (size_t aircraft = 0; aircraft < aircraftCount; aircraft++) {
+                        this->harness.GetFlightplan(aircraft).expectedDepartureTime =
+                            std::to_string(1000 + (aircraft % 12) * 100 + aircraft % 60);
+                        this->harness.AddEvent({ ReplayEventType::FlightPlanDataUpdate, aircraft, 0 });
+                    }
+                }
+
+                static constexpr size_t aircraftCount = 1500;
+
+                StoredFlightplanCollection storedFlightplans;
+                EventReplayHarness harness;
+        };
+
+        TEST_F(StoredFlightplanUpdateBenchmark, ItReportsAllocationsPerUnchangedFlightplanEvent)
+        {
+            // The first pass stores every flightplan
+            this->harness.Replay(1);
+            this->harness.ResetProfiles();
+            this->harness.Replay(10);
+            std::cout << this->harness.GetReport();
+
+            const HandlerProfile & profile = this->harness.GetProfile("StoredFlightplanEventHandler");
+            std::cout << "Allocations per flightplan event: "
+                << static_cast<double>(profile.GetAllocations()) / profile.GetEvents() << std::endl;
+
+            // The route is too long to fit in a small string, so copying it out of EuroScope is the one allocation
+            EXPECT_EQ(aircraftCount * 10, profile.GetEvents());
+            EXPECT_EQ(profile.GetEvents(), profile.GetAllocations());
+        }
+
+        TEST_F(StoredFlightplanUpdateBenchmark, ItReportsAllocationsPerChangedFlightplanEvent)
+        {
+            this->harness.Replay(1);
+            this->harness.ResetProfiles();
+            for (size_t aircraft = 0; aircraft < aircraftCount; aircraft++) {
+                this->harness.GetFlightplan(aircraft).destination = "EGLL";
+                this->harness.GetFlightplan(aircraft).expectedDepartureTime = "1545";
+            }
+            this->harness.Replay(1);
+            std::cout << this->harness.GetReport();
+
+            const HandlerProfile & profile = this->harness.GetProfile("StoredFlightplanEventHandler");
+            std::cout << "Allocations per flightplan event: "
+                << static_cast<double>(profile.GetAllocations()) / profile.GetEvents() << std::endl;
+
+            EXPECT_EQ(aircraftCount, profile.GetEvents());
+            EXPECT_EQ("EGLL", this->storedFlightplans.GetFlightplanForCallsign(
+                this->harness.GetFlightplan(0).callsign
+            ).GetDestination());
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
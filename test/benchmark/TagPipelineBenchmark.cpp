@@ -0,0 +1,100 @@
+#include "pch/pch.h"
+#include "benchmark/EventReplayHarness.h"
+#include "controller/ActiveCallsignCollection.h"
+#include "flightplan/CallsignRegistry.h"
+#include "handoff/HandoffCollection.h"
+#include "handoff/HandoffEventHandler.h"
+#include "wake/WakeCategoryEventHandler.h"
+#include "wake/WakeCategoryMapper.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Controller::ActiveCallsignCollection;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Handoff::HandoffCollection;
+using UKControllerPlugin::Handoff::HandoffEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryEventHandler;
+using UKControllerPlugin::Wake::WakeCategoryMapper;
+using UKControllerPluginTest::Benchmark::EventReplayHarness;
+using UKControllerPluginTest::Benchmark::ReplayEvent;
+using UKControllerPluginTest::Benchmark::ReplayEventType;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Replays tag item requests for every aircraft, as EuroScope does on each
+            refresh, and checks that once the handler caches are warm, rendering a tag
+            item doesn't touch the heap.
+        */
+        class TagPipelineBenchmark : public Test
+        {
+            public:
+                TagPipelineBenchmark()
+                    : harness(aircraftCount)
+                {
+                    this->ukMapper.AddCategoryMapping("A320", "LM");
+                    this->ukMapper.AddCategoryMapping("B738", "LM");
+                    this->ukMapper.AddCategoryMapping("A388", "J");
+                    this->ukMapper.AddCategoryMapping("B77W", "H");
+                    this->recatMapper.AddCategoryMapping("A320", "D");
+                    this->recatMapper.AddCategoryMapping("B738", "D");
+                    this->recatMapper.AddCategoryMapping("A388", "A");
+                    this->recatMapper.AddCategoryMapping("B77W", "B");
+
+                    this->wake = std::make_shared<WakeCategoryEventHandler>(
+                        this->ukMapper,
+                        this->recatMapper,
+                        this->aircraft
+                    );
+                    this->handoff = std::make_shared<HandoffEventHandler>(
+                        this->handoffs,
+                        this->activeCallsigns,
+                        this->aircraft
+                    );
+                    this->harness.AddTagItem("WakeCategoryEventHandler (105)", 105, this->wake);
+                    this->harness.AddTagItem("WakeCategoryEventHandler (114)", 114, this->wake);
+                    this->harness.AddTagItem("WakeCategoryEventHandler (115)", 115, this->wake);
+                    this->harness.AddTagItem("HandoffEventHandler (107)", 107, this->handoff);
+                }
+
+                // Roughly what a busy evening looks like across the UK
+                static const size_t aircraftCount = 1500;
+
+                // How many screen refreshes to replay
+                const int refreshes = 10;
+
+                WakeCategoryMapper ukMapper;
+                WakeCategoryMapper recatMapper;
+                HandoffCollection handoffs;
+                ActiveCallsignCollection activeCallsigns;
+                CallsignRegistry aircraft;
+                std::shared_ptr<WakeCategoryEventHandler> wake;
+                std::shared_ptr<HandoffEventHandler> handoff;
+                EventReplayHarness harness;
+        };
+
+        TEST_F(TagPipelineBenchmark, ItRendersTagItemsWithoutAllocating)
+        {
+            const int tagItems[] = { 105, 114, 115, 107 };
+            for (int refresh = 0; refresh < this->refreshes; refresh++) {
+                for (size_t aircraft = 0; aircraft < aircraftCount; aircraft++) {
+                    for (int tagItem : tagItems) {
+                        this->harness.AddEvent({ ReplayEventType::GetTagItem, aircraft, tagItem });
+                    }
+                }
+            }
+
+            // Warm the handler caches, then measure
+            this->harness.Replay(1);
+            this->harness.ResetProfiles();
+            this->harness.Replay(1);
+            std::cout << this->harness.GetReport();
+
+            EXPECT_EQ(
+                aircraftCount * 4 * this->refreshes,
+                this->harness.GetProfile(this->harness.tagItemCollectionProfile).GetEvents()
+            );
+            EXPECT_EQ(0, this->harness.GetProfile(this->harness.tagItemCollectionProfile).GetAllocations());
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,152 @@
+#include "pch/pch.h"
+#include "benchmark/AllocationCounter.h"
+#include "helper/StringScanners.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Helper::IsAsciiLetter;
+using UKControllerPlugin::Helper::IsCircuitRoute;
+using UKControllerPlugin::Helper::ScanCommandArgument;
+using UKControllerPlugin::Helper::ScanQnh;
+using UKControllerPluginTest::Benchmark::AllocationCounter;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Compares the hand written scanners against building a regex on every call, as we used
+            to, and against a regex that is only compiled once. Uses METARs and routes of the sort
+            that we see over the UK.
+        */
+        class TextScanningBenchmark : public Test
+        {
+            public:
+
+                /*
+                    Runs the function over the corpus a number of times, printing the time per item.
+                */
+                template <typename Function>
+                size_t Time(std::string name, const std::vector<std::string> & corpus, Function function)
+                {
+                    size_t matches = 0;
+                    size_t allocationsBefore = AllocationCounter::GetAllocations();
+                    AllocationCounter::Start();
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    for (int pass = 0; pass < passes; pass++) {
+                        for (const std::string & text : corpus) {
+                            matches += function(text) ? 1 : 0;
+                        }
+                    }
+                    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+                    AllocationCounter::Stop();
+
+                    std::cout << name << ": "
+                        << std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()
+                            / (passes * corpus.size())
+                        << "ns per item, "
+                        << (AllocationCounter::GetAllocations() - allocationsBefore) / (passes * corpus.size())
+                        << " allocations per item" << std::endl;
+
+                    return matches;
+                }
+
+                const int passes = 2000;
+
+                const std::vector<std::string> metars = {
+                    "EGLL 261250Z AUTO 24012KT 9999 FEW035 14/07 Q1013 NOSIG",
+                    "EGKK 261250Z 23010G20KT 200V270 9999 -RA BKN012 OVC020 12/10 Q1002 TEMPO 4000 RA",
+                    "EGSS 261250Z 25008KT CAVOK 15/06 Q1014",
+                    "EGCC 261250Z 27015KT 9999 SCT025 BKN040 11/05 Q1009 NOSIG",
+                    "EGPH 261250Z 26018G29KT 9999 FEW020 10/03 Q0998 RETS",
+                    "EGPF 261250Z 25020G32KT 9999 SCT018 09/04 Q0996",
+                    "EGBB 261250Z 24011KT 9999 BKN030 13/06 Q1010",
+                    "EGGD 261250Z 22014KT 6000 -DZ BKN006 OVC010 12/11 Q1006 TEMPO 3000 DZ BKN004",
+                    "EGNX 261250Z 25009KT 9999 FEW040 14/05 Q1011",
+                    "EGLC 261250Z 23007KT 9999 FEW038 15/07 Q1013",
+                    "EGJJ 261250Z 24016KT 9999 SCT020 14/11 Q1008 NOSIG",
+                    "EGAA 261250Z 21012KT 9999 -SHRA FEW014 SCT025CB 10/07 Q0999",
+                    "EGNT 261250Z 26013KT 9999 FEW030 12/04 Q1004",
+                    "EGHI 261250Z 23010KT 9999 BKN025 14/09 Q1010 RMK QFE1009",
+                    "EGPD 261250Z 24023KT 9999 FEW022 09/02 Q0993",
+                    "EGSC 261250Z AUTO 24010KT //// NCD 14/06 ////",
+                };
+
+                const std::vector<std::string> routes = {
+                    "CPT3F/27R CPT L9 KENET UL9 STU",
+                    "VFR CIRCUITS",
+                    "MAXI1X MAXIT Q41 SAM M195 REDFA",
+                    "DVR L9 KONAN UL607 SPI",
+                    "circuits",
+                    "LAM3A LAM L10 BPK Q295 BRAIN",
+                    "SOPAV1F SOPAV N864 NOKIN",
+                    "VFR EGBJ CHELTENHAM BROADWAY",
+                    "POL1B POL N864 DCS DCS1A",
+                    "NUGRA1G NUGRA UL612 NIGIT",
+                    "CIRCUIT",
+                    "DTY2F DTY N57 WELIN T420 TNT",
+                };
+
+                const std::vector<std::string> commands = {
+                    ".ukcp owner EGKK",
+                    ".ukcp owned EGKK_APP",
+                    ".ukcp owner EGLL",
+                    ".ukcp minstack",
+                    ".ukcp owner EG1",
+                    ".sb EGLL",
+                };
+        };
+
+        TEST_F(TextScanningBenchmark, ItScansQnhs)
+        {
+            size_t regexMatches = this->Time("QNH regex per call", this->metars, [](const std::string & metar) {
+                std::smatch match;
+                return std::regex_search(metar, match, std::regex(" Q([0-9]{4})( |$)"));
+            });
+
+            static const std::regex qnhPattern(" Q([0-9]{4})( |$)");
+            size_t staticMatches = this->Time("QNH static regex", this->metars, [](const std::string & metar) {
+                std::smatch match;
+                return std::regex_search(metar, match, qnhPattern);
+            });
+
+            size_t scannerMatches = this->Time("QNH scanner", this->metars, [](const std::string & metar) {
+                return !ScanQnh(metar).empty();
+            });
+
+            EXPECT_EQ(regexMatches, scannerMatches);
+            EXPECT_EQ(staticMatches, scannerMatches);
+        }
+
+        TEST_F(TextScanningBenchmark, ItScansCircuitRoutes)
+        {
+            size_t regexMatches = this->Time("Circuit regex per call", this->routes, [](const std::string & route) {
+                return std::regex_search(route, std::regex("^(?:VFR )?CIRCUIT(?:S)?", std::regex::icase));
+            });
+
+            static const std::regex circuitPattern("^(?:VFR )?CIRCUIT(?:S)?", std::regex::icase);
+            size_t staticMatches = this->Time("Circuit static regex", this->routes, [](const std::string & route) {
+                return std::regex_search(route, circuitPattern);
+            });
+
+            size_t scannerMatches = this->Time("Circuit scanner", this->routes, [](const std::string & route) {
+                return IsCircuitRoute(route);
+            });
+
+            EXPECT_EQ(regexMatches, scannerMatches);
+            EXPECT_EQ(staticMatches, scannerMatches);
+        }
+
+        TEST_F(TextScanningBenchmark, ItScansCommands)
+        {
+            size_t regexMatches = this->Time("Command regex per call", this->commands, [](const std::string & command) {
+                std::smatch match;
+                return std::regex_search(command, match, std::regex(".ukcp owner ([A-Za-z]{4})"));
+            });
+
+            size_t scannerMatches = this->Time("Command scanner", this->commands, [](const std::string & command) {
+                return ScanCommandArgument(command, ".ukcp owner ", IsAsciiLetter, 4).size() == 4;
+            });
+
+            EXPECT_EQ(regexMatches, scannerMatches);
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
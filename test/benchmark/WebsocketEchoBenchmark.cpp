@@ -0,0 +1,93 @@
+#include "pch/pch.h"
+#include "benchmark/WebsocketEchoServer.h"
+#include "websocket/WebsocketConnection.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Websocket::WebsocketConnection;
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            Connects the plugin's websocket to a local echo server, then measures how long
+            messages take to go there and back, and how many frames a second get through.
+        */
+        class WebsocketEchoBenchmark : public Test
+        {
+            public:
+                WebsocketEchoBenchmark()
+                    : connection("127.0.0.1", server.GetPort())
+                {
+                    std::chrono::steady_clock::time_point giveUp = std::chrono::steady_clock::now() + timeout;
+                    while (!this->connection.IsConnected() && std::chrono::steady_clock::now() < giveUp) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+
+                /*
+                    Wait for the next message to come back, returning no message if it never does.
+                */
+                std::string WaitForMessage(void)
+                {
+                    std::chrono::steady_clock::time_point giveUp = std::chrono::steady_clock::now() + timeout;
+                    std::string message = this->connection.GetNextMessage();
+                    while (message == this->connection.noMessage && std::chrono::steady_clock::now() < giveUp) {
+                        std::this_thread::yield();
+                        message = this->connection.GetNextMessage();
+                    }
+
+                    return message;
+                }
+
+                // How long to wait for anything to happen before failing
+                const std::chrono::seconds timeout = std::chrono::seconds(10);
+
+                // The server must outlive the connection, so that it can close gracefully
+                WebsocketEchoServer server;
+                WebsocketConnection connection;
+        };
+
+        TEST_F(WebsocketEchoBenchmark, ItReportsRoundTripLatency)
+        {
+            ASSERT_TRUE(this->connection.IsConnected());
+
+            const int roundTrips = 200;
+            std::chrono::microseconds total(0);
+            std::chrono::microseconds worst(0);
+            for (int trip = 0; trip < roundTrips; trip++) {
+                std::string message = "message" + std::to_string(trip);
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                this->connection.WriteMessage(message);
+                ASSERT_EQ(message, this->WaitForMessage());
+
+                std::chrono::microseconds latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start
+                );
+                total += latency;
+                worst = (std::max)(worst, latency);
+            }
+
+            std::cout << "Websocket round trip: " << total.count() / roundTrips << "us average, "
+                << worst.count() << "us worst" << std::endl;
+        }
+
+        TEST_F(WebsocketEchoBenchmark, ItReportsFramesPerSecond)
+        {
+            ASSERT_TRUE(this->connection.IsConnected());
+
+            const int frames = 5000;
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < frames; frame++) {
+                this->connection.WriteMessage("frame" + std::to_string(frame));
+            }
+
+            for (int frame = 0; frame < frames; frame++) {
+                ASSERT_EQ("frame" + std::to_string(frame), this->WaitForMessage());
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << "Websocket echoed " << frames << " frames at " << frames / seconds
+                << " frames/sec" << std::endl;
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
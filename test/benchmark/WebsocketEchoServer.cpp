@@ -0,0 +1,101 @@
+#include "pch/pch.h"
+#include "benchmark/WebsocketEchoServer.h"
+#include "benchmark/BenchmarkCertificate.h"
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        WebsocketEchoServer::WebsocketEchoServer(void)
+            : sslContext(boost::asio::ssl::context::tlsv12_server),
+            acceptor(this->ioContext, { boost::asio::ip::address_v4::loopback(), 0 })
+        {
+            this->sslContext.use_certificate_chain(boost::asio::buffer(std::string(benchmarkCertificate)));
+            this->sslContext.use_private_key(
+                boost::asio::buffer(std::string(benchmarkPrivateKey)),
+                boost::asio::ssl::context::file_format::pem
+            );
+
+            this->Accept();
+            this->serverThread = std::thread([this]() { this->ioContext.run(); });
+        }
+
+        WebsocketEchoServer::~WebsocketEchoServer(void)
+        {
+            this->ioContext.stop();
+            this->serverThread.join();
+        }
+
+        std::string WebsocketEchoServer::GetPort(void) const
+        {
+            return std::to_string(this->acceptor.local_endpoint().port());
+        }
+
+        /*
+            Accept the next connection and go through the TLS and websocket handshakes.
+        */
+        void WebsocketEchoServer::Accept(void)
+        {
+            this->acceptor.async_accept(
+                boost::asio::make_strand(this->ioContext),
+                [this](boost::system::error_code ec, boost::asio::ip::tcp::socket socket) {
+                    if (ec) {
+                        return;
+                    }
+
+                    std::shared_ptr<WebsocketStream> websocket = std::make_shared<WebsocketStream>(
+                        std::move(socket),
+                        this->sslContext
+                    );
+                    websocket->next_layer().async_handshake(
+                        boost::asio::ssl::stream_base::server,
+                        [this, websocket](boost::system::error_code ec) {
+                            if (ec) {
+                                return;
+                            }
+
+                            websocket->async_accept([this, websocket](boost::system::error_code ec) {
+                                if (ec) {
+                                    return;
+                                }
+
+                                this->Echo(websocket, std::make_shared<boost::beast::flat_buffer>());
+                            });
+                        }
+                    );
+
+                    this->Accept();
+                }
+            );
+        }
+
+        /*
+            Read a frame and send it straight back, then wait for the next one.
+        */
+        void WebsocketEchoServer::Echo(
+            std::shared_ptr<WebsocketStream> websocket,
+            std::shared_ptr<boost::beast::flat_buffer> buffer
+        ) {
+            websocket->async_read(
+                *buffer,
+                [this, websocket, buffer](boost::system::error_code ec, std::size_t bytesRead) {
+                    if (ec) {
+                        return;
+                    }
+
+                    websocket->text(websocket->got_text());
+                    websocket->async_write(
+                        buffer->data(),
+                        [this, websocket, buffer](boost::system::error_code ec, std::size_t bytesWritten) {
+                            if (ec) {
+                                return;
+                            }
+
+                            buffer->consume(buffer->size());
+                            this->Echo(websocket, buffer);
+                        }
+                    );
+                }
+            );
+        }
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,43 @@
+#pragma once
+
+namespace UKControllerPluginTest {
+    namespace Benchmark {
+
+        /*
+            A websocket server on the loopback interface that sends every frame it receives
+            straight back. It uses TLS with a self-signed certificate, so that the plugin's
+            real websocket connection can talk to it.
+        */
+        class WebsocketEchoServer
+        {
+            public:
+                WebsocketEchoServer(void);
+                ~WebsocketEchoServer(void);
+                std::string GetPort(void) const;
+
+            private:
+
+                typedef boost::beast::websocket::stream<
+                    boost::beast::ssl_stream<boost::beast::tcp_stream>
+                > WebsocketStream;
+
+                void Accept(void);
+                void Echo(
+                    std::shared_ptr<WebsocketStream> websocket,
+                    std::shared_ptr<boost::beast::flat_buffer> buffer
+                );
+
+                // Io context for the server
+                boost::asio::io_context ioContext;
+
+                // SSL context with the self-signed certificate
+                boost::asio::ssl::context sslContext;
+
+                // Accepts connections
+                boost::asio::ip::tcp::acceptor acceptor;
+
+                // Runs the io context
+                std::thread serverThread;
+        };
+    }  // namespace Benchmark
+}  // namespace UKControllerPluginTest
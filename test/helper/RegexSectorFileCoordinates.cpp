@@ -0,0 +1,58 @@
+#include "pch/pch.h"
+#include "helper/RegexSectorFileCoordinates.h"
+#include "sectorfile/SectorFileCoordinates.h"
+
+using UKControllerPlugin::SectorFile::GetInvalidPosition;
+
+/*
+    Parses a pair of sector file coordinates using the regular expressions that they used to be
+    checked with.
+*/
+EuroScopePlugIn::CPosition ParseSectorFileCoordinatesWithRegex(std::string latitude, std::string longitude)
+{
+    static const std::regex latitudePattern("^([N,S])(\\d{3})\\.(\\d{2})\\.(\\d{2})\\.(\\d{3})$");
+    static const std::regex longitudePattern("^([E,W])(\\d{3})\\.(\\d{2})\\.(\\d{2})\\.(\\d{3})$");
+    std::match_results<std::string::const_iterator> latitudeMatch;
+    std::match_results<std::string::const_iterator> longitudeMatch;
+
+    if (
+        !std::regex_match(latitude, latitudeMatch, latitudePattern) ||
+        !std::regex_match(longitude, longitudeMatch, longitudePattern)
+    ) {
+        return GetInvalidPosition();
+    }
+
+    int latitudeDegrees = std::stoi(latitudeMatch[2].str());
+    int latitudeMinutes = std::stoi(latitudeMatch[3].str());
+    double latitudeSeconds = std::stod(latitudeMatch[4].str() + "." + latitudeMatch[5].str());
+    int longitudeDegrees = std::stoi(longitudeMatch[2].str());
+    int longitudeMinutes = std::stoi(longitudeMatch[3].str());
+    double longitudeSeconds = std::stod(longitudeMatch[4].str() + "." + longitudeMatch[5].str());
+
+    if (
+        (latitudeDegrees == 90 && (latitudeMinutes != 0 || latitudeSeconds != 0)) ||
+        latitudeDegrees > 90 ||
+        latitudeMinutes >= 60 ||
+        latitudeSeconds >= 60.0 ||
+        (longitudeDegrees == 180 && (longitudeMinutes != 0 || longitudeSeconds != 0)) ||
+        longitudeDegrees > 180 ||
+        longitudeMinutes >= 60 ||
+        longitudeSeconds >= 60.0
+    ) {
+        return GetInvalidPosition();
+    }
+
+    EuroScopePlugIn::CPosition position;
+    position.m_Latitude = latitudeDegrees + (latitudeMinutes / 60.0) + (latitudeSeconds / 3600.0);
+    position.m_Longitude = longitudeDegrees + (longitudeMinutes / 60.0) + (longitudeSeconds / 3600.0);
+
+    if (latitudeMatch[1] == "S") {
+        position.m_Latitude *= -1;
+    }
+
+    if (longitudeMatch[1] == "W") {
+        position.m_Longitude *= -1;
+    }
+
+    return position;
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "pch/pch.h"
+
+/*
+    Parses a pair of sector file coordinates using the regular expressions that they used to be
+    checked with, to compare the hand written parser against.
+*/
+EuroScopePlugIn::CPosition ParseSectorFileCoordinatesWithRegex(std::string latitude, std::string longitude);
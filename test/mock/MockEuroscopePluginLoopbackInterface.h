@@ -48,6 +48,7 @@ namespace UKControllerPluginTest {
                 MOCK_METHOD2(RegisterTagFunction, void(int, std::string));
                 MOCK_METHOD2(RegisterTagItem, void(int, std::string));
                 MOCK_METHOD1(TriggerFlightplanUpdateForCallsign, void(std::string));
+                MOCK_METHOD1(MarkFlightplanDirty, void(std::string));
                 MOCK_METHOD8(
                     ChatAreaMessage,
                     void(
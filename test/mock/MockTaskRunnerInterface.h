@@ -27,6 +27,11 @@ namespace UKControllerPluginTest {
                     if (this->runTask) callback();
                 };
 
+                void QueueInteractiveTask(std::function<void()> callback)
+                {
+                    if (this->runTask) callback();
+                };
+
             private:
                 // Whether we actually want to run the task.
                 bool runTask;
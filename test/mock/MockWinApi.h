@@ -19,6 +19,8 @@ namespace UKControllerPluginTest {
             MOCK_METHOD1(OpenWebBrowser, void(std::wstring));
             MOCK_METHOD1(PlayWave, void(LPCTSTR));
             MOCK_METHOD3(WriteToFile, void(std::wstring, std::string, bool));
+            MOCK_METHOD2(WriteBinaryToFile, void(std::wstring, std::string));
+            MOCK_METHOD1(ReadBinaryFromFile, std::string(std::wstring));
             MOCK_METHOD2(ReadFromFileMock, std::string(std::wstring, bool));
             MOCK_METHOD1(FileExists, bool(std::wstring));
             MOCK_METHOD1(CreateFolder, bool(std::wstring folder));
@@ -59,5 +59,19 @@ namespace UKControllerPluginTest {
             collection.AddAirfield(std::unique_ptr<AirfieldModel> (new AirfieldModel("EGLL", {})));
             EXPECT_EQ(2, collection.GetSize());
         }
+
+        TEST(AirfieldCollection, ItIteratesAirfieldsInIcaoOrder)
+        {
+            AirfieldCollection collection;
+            collection.AddAirfield(std::unique_ptr<AirfieldModel>(new AirfieldModel("EGLL", {})));
+            collection.AddAirfield(std::unique_ptr<AirfieldModel>(new AirfieldModel("EGKK", {})));
+
+            std::vector<std::string> icaos;
+            for (AirfieldCollection::const_iterator it = collection.cbegin(); it != collection.cend(); ++it) {
+                icaos.push_back(it->second->GetIcao());
+            }
+
+            EXPECT_EQ(std::vector<std::string>({ "EGKK", "EGLL" }), icaos);
+        }
     }  // namespace AirfieldOwnership
 }  // namespace UKControllerPluginTest
@@ -23,6 +23,11 @@ namespace UKControllerPluginTest {
                     PersistenceContainer container;
         };
 
+        TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesHandlerMetrics)
+        {
+            EXPECT_EQ(0, this->container.handlerMetrics->CountMetrics());
+        }
+
         TEST_F(EventHandlerCollectionBootstrapTest, BootstrapPluginCreatesTagHandler)
         {
             EXPECT_EQ(0, this->container.tagHandler->CountHandlers());
@@ -0,0 +1,102 @@
+#include "pch/pch.h"
+#include "bootstrap/ModuleBootstrapper.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Bootstrap::ModuleBootstrapper;
+
+namespace UKControllerPluginTest {
+    namespace Bootstrap {
+
+        class ModuleBootstrapperTest : public Test
+        {
+            public:
+                ModuleBootstrapper modules;
+                std::vector<std::string> bootstrapped;
+        };
+
+        TEST_F(ModuleBootstrapperTest, ItStartsWithNoModules)
+        {
+            EXPECT_EQ(0, this->modules.CountModules());
+        }
+
+        TEST_F(ModuleBootstrapperTest, ItAddsModules)
+        {
+            this->modules.AddModule("One", []() {});
+            this->modules.AddWarmedModule("Two", []() { return []() {}; });
+            EXPECT_EQ(2, this->modules.CountModules());
+        }
+
+        TEST_F(ModuleBootstrapperTest, ItBootstrapsModulesInOrder)
+        {
+            this->modules.AddModule("One", [this]() { this->bootstrapped.push_back("One"); });
+            this->modules.AddWarmedModule("Two", [this]() {
+                return [this]() { this->bootstrapped.push_back("Two"); };
+            });
+            this->modules.AddModule("Three", [this]() { this->bootstrapped.push_back("Three"); });
+            this->modules.Bootstrap();
+
+            std::vector<std::string> expected({ "One", "Two", "Three" });
+            EXPECT_EQ(expected, this->bootstrapped);
+        }
+
+        TEST_F(ModuleBootstrapperTest, ItWarmsModulesOnAnotherThread)
+        {
+            std::thread::id bootstrapThread;
+            std::thread::id warmupThread;
+            this->modules.AddWarmedModule("One", [&bootstrapThread, &warmupThread]() {
+                warmupThread = std::this_thread::get_id();
+                return [&bootstrapThread]() { bootstrapThread = std::this_thread::get_id(); };
+            });
+            this->modules.Bootstrap();
+
+            EXPECT_EQ(std::this_thread::get_id(), bootstrapThread);
+            EXPECT_NE(std::this_thread::get_id(), warmupThread);
+        }
+
+        TEST_F(ModuleBootstrapperTest, ItWarmsModulesWhilstEarlierModulesBootstrap)
+        {
+            std::promise<void> warmupStarted;
+            this->modules.AddModule("One", [&warmupStarted]() {
+                // This would block forever if the warm-up didn't start until its turn
+                warmupStarted.get_future().wait();
+            });
+            this->modules.AddWarmedModule("Two", [&warmupStarted]() {
+                warmupStarted.set_value();
+                return nullptr;
+            });
+            this->modules.Bootstrap();
+
+            EXPECT_EQ(2, this->modules.GetTimings().size());
+        }
+
+        TEST_F(ModuleBootstrapperTest, ItRethrowsWarmupExceptions)
+        {
+            this->modules.AddWarmedModule("One", []() -> ModuleBootstrapper::BootstrapFunction {
+                throw std::invalid_argument("Bad data");
+            });
+            EXPECT_THROW(this->modules.Bootstrap(), std::invalid_argument);
+        }
+
+        TEST_F(ModuleBootstrapperTest, ItTimesEachModule)
+        {
+            this->modules.AddModule("One", []() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            });
+            this->modules.AddWarmedModule("Two", []() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                return []() {};
+            });
+            this->modules.Bootstrap();
+
+            ASSERT_EQ(2, this->modules.GetTimings().size());
+            EXPECT_EQ("One", this->modules.GetTimings()[0].name);
+            EXPECT_FALSE(this->modules.GetTimings()[0].warmed);
+            EXPECT_GE(this->modules.GetTimings()[0].bootstrap, std::chrono::milliseconds(5));
+            EXPECT_EQ(std::chrono::microseconds::zero(), this->modules.GetTimings()[0].warmup);
+
+            EXPECT_EQ("Two", this->modules.GetTimings()[1].name);
+            EXPECT_TRUE(this->modules.GetTimings()[1].warmed);
+            EXPECT_GE(this->modules.GetTimings()[1].warmup, std::chrono::milliseconds(5));
+        }
+    }  // namespace Bootstrap
+}  // namespace UKControllerPluginTest
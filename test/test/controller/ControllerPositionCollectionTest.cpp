@@ -183,5 +183,126 @@ namespace UKControllerPluginTest {
             collection.AddPosition(std::move(controller));
             EXPECT_TRUE(collection.HasPosition("EGFF_APP"));
         }
+
+        TEST(ControllerPositionCollection, FetchPositionByFacilityTypeAndFrequencyMatchesAcrossKhzBoundary)
+        {
+            ControllerPositionCollection collection;
+            std::unique_ptr<ControllerPosition> controller(
+                new ControllerPosition("EGFF_APP", 125.8495, "APP", std::vector<std::string> {"EGGD, EGFF"})
+            );
+
+            ControllerPosition * controllerRaw = controller.get();
+            collection.AddPosition(std::move(controller));
+            EXPECT_EQ(*controllerRaw, collection.FetchPositionByFacilityTypeAndFrequency("EGFF", "APP", 125.8504));
+        }
+
+        TEST(ControllerPositionCollection, FetchPositionByFacilityTypeAndFrequencyReturnsFirstCallsignIfSeveralMatch)
+        {
+            ControllerPositionCollection collection;
+            std::unique_ptr<ControllerPosition> controllerSecond(
+                new ControllerPosition("LON_S_CTR", 134.900, "CTR", std::vector<std::string> {"EGKK"})
+            );
+            std::unique_ptr<ControllerPosition> controllerFirst(
+                new ControllerPosition("LON_D_CTR", 134.900, "CTR", std::vector<std::string> {"EGKK"})
+            );
+
+            ControllerPosition * controllerRaw = controllerFirst.get();
+            collection.AddPosition(std::move(controllerSecond));
+            collection.AddPosition(std::move(controllerFirst));
+            EXPECT_EQ(*controllerRaw, collection.FetchPositionByFacilityTypeAndFrequency("LON", "CTR", 134.900));
+        }
+
+        TEST(ControllerPositionCollection, FetchPositionByFacilityTypeAndFrequencyIgnoresRejectedDuplicates)
+        {
+            ControllerPositionCollection collection;
+            std::unique_ptr<ControllerPosition> controllerFirst(
+                new ControllerPosition("EGFF_APP", 125.850, "APP", std::vector<std::string> {"EGGD, EGFF"})
+            );
+            std::unique_ptr<ControllerPosition> controllerSecond(
+                new ControllerPosition("EGFF_APP", 121.200, "APP", std::vector<std::string> {"EGGD, EGFF"})
+            );
+
+            collection.AddPosition(std::move(controllerFirst));
+            collection.AddPosition(std::move(controllerSecond));
+            EXPECT_THROW(collection.FetchPositionByFacilityTypeAndFrequency("EGFF", "APP", 121.200), std::out_of_range);
+        }
+
+        TEST(ControllerPositionCollection, FetchPositionByFacilityTypeAndFrequencyMatchesCheckingEveryPosition)
+        {
+            const std::vector<std::string> types = { "DEL", "GND", "TWR", "APP", "CTR" };
+            std::vector<std::unique_ptr<ControllerPosition>> positions;
+            ControllerPositionCollection collection;
+            for (int position = 0; position < 600; position++) {
+                std::string facility = position % 5 == 4
+                    ? "LON_" + std::to_string(position)
+                    : "EG" + std::string(1, 'A' + position / 26 % 26) + std::string(1, 'A' + position % 26);
+                std::string type = types[position % 5];
+                double frequency = 118.000 + (position * 37 % 1000) * 0.025;
+
+                positions.push_back(
+                    std::make_unique<ControllerPosition>(
+                        facility + "_" + type,
+                        frequency,
+                        type,
+                        std::vector<std::string> {}
+                    )
+                );
+                collection.AddPosition(
+                    std::make_unique<ControllerPosition>(
+                        facility + "_" + type,
+                        frequency,
+                        type,
+                        std::vector<std::string> {}
+                    )
+                );
+            }
+
+            // The first callsign of all the positions that match, as found by checking each one
+            auto findLinear = [&positions](const std::string & facility, const std::string & type, double frequency) {
+                const ControllerPosition * match = nullptr;
+                for (const std::unique_ptr<ControllerPosition> & position : positions) {
+                    if (
+                        fabs(frequency - position->GetFrequency()) < 0.001 &&
+                        position->GetUnit() == facility &&
+                        position->GetType() == type &&
+                        (match == nullptr || position->GetCallsign() < match->GetCallsign())
+                    ) {
+                        match = position.get();
+                    }
+                }
+
+                return match;
+            };
+
+            for (const std::unique_ptr<ControllerPosition> & position : positions) {
+                for (double offset : { -0.0012, -0.0009, 0.0, 0.0004, 0.0009, 0.0012 }) {
+                    const ControllerPosition * expected = findLinear(
+                        position->GetUnit(),
+                        position->GetType(),
+                        position->GetFrequency() + offset
+                    );
+
+                    if (expected == nullptr) {
+                        EXPECT_THROW(
+                            collection.FetchPositionByFacilityTypeAndFrequency(
+                                position->GetUnit(),
+                                position->GetType(),
+                                position->GetFrequency() + offset
+                            ),
+                            std::out_of_range
+                        );
+                    } else {
+                        EXPECT_EQ(
+                            expected->GetCallsign(),
+                            collection.FetchPositionByFacilityTypeAndFrequency(
+                                position->GetUnit(),
+                                position->GetType(),
+                                position->GetFrequency() + offset
+                            ).GetCallsign()
+                        );
+                    }
+                }
+            }
+        }
     }  // namespace Controller
 }  // namespace UKControllerPluginTest
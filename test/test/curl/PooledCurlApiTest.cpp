@@ -0,0 +1,69 @@
+#include "pch/pch.h"
+#include "curl/CurlRequest.h"
+#include "curl/PooledCurlApi.h"
+
+using ::testing::Test;
+using UKControllerPlugin::Curl::CurlRequest;
+using UKControllerPlugin::Curl::CurlResponse;
+using UKControllerPlugin::Curl::PooledCurlApi;
+
+namespace UKControllerPluginTest {
+    namespace Curl {
+
+        /*
+            These tests use a URL with a scheme that curl doesn't support, so every request fails inside curl
+            before any network I/O happens. The requests that go over a socket are in the benchmark project.
+        */
+        class PooledCurlApiTest : public Test
+        {
+            public:
+                PooledCurlApiTest()
+                    : curl(false, 2, "")
+                {
+                }
+
+                CurlRequest Request(void) const
+                {
+                    return CurlRequest("unsupported://ukcp.test", CurlRequest::METHOD_GET);
+                }
+
+                PooledCurlApi curl;
+        };
+
+        TEST_F(PooledCurlApiTest, ItStartsWithNoIdleHandles)
+        {
+            EXPECT_EQ(0, this->curl.CountIdleHandles());
+        }
+
+        TEST_F(PooledCurlApiTest, ItDoesntUseHttp2IfNotAsked)
+        {
+            EXPECT_FALSE(this->curl.UsingHttp2());
+        }
+
+        TEST_F(PooledCurlApiTest, ItReturnsCurlErrorsAndKeepsTheHandle)
+        {
+            CurlResponse response = this->curl.MakeCurlRequest(this->Request());
+
+            EXPECT_TRUE(response.IsCurlError());
+            EXPECT_EQ(1, this->curl.CountIdleHandles());
+        }
+
+        TEST_F(PooledCurlApiTest, ItReusesTheIdleHandleForLaterRequests)
+        {
+            this->curl.MakeCurlRequest(this->Request());
+            this->curl.MakeCurlRequest(this->Request());
+            this->curl.MakeCurlRequest(this->Request());
+
+            EXPECT_EQ(1, this->curl.CountIdleHandles());
+        }
+
+        TEST_F(PooledCurlApiTest, ItOnlyKeepsTheMaximumIdleHandles)
+        {
+            PooledCurlApi noIdleHandles(false, 0, "");
+            CurlResponse response = noIdleHandles.MakeCurlRequest(this->Request());
+
+            EXPECT_TRUE(response.IsCurlError());
+            EXPECT_EQ(0, noIdleHandles.CountIdleHandles());
+        }
+    }  // namespace Curl
+}  // namespace UKControllerPluginTest
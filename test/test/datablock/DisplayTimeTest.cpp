@@ -48,6 +48,33 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(expectedTime == timeDisplay.FromTimePoint(HelperFunctions::GetTimeFromNumberString("1523")));
         }
 
+        TEST_F(DisplayTimeTest, GetTimeStringMatchesTheDateLibraryForEveryMinuteOfTheDay)
+        {
+            std::chrono::system_clock::time_point start = std::chrono::system_clock::from_time_t(1403549100);
+            for (int second = 0; second < 86400; second += 20) {
+                std::chrono::system_clock::time_point time = start + std::chrono::seconds(second);
+                EXPECT_EQ(date::format("%H:%M", time), timeDisplay.GetTimeString(time));
+            }
+        }
+
+        TEST_F(DisplayTimeTest, GetTimeStringHandlesMidnight)
+        {
+            EXPECT_EQ("00:00", timeDisplay.GetTimeString(HelperFunctions::GetTimeFromNumberString("0000")));
+            EXPECT_EQ("23:59", timeDisplay.GetTimeString(HelperFunctions::GetTimeFromNumberString("2359")));
+        }
+
+        TEST_F(DisplayTimeTest, GetTimeStringHandlesTimesBeforeTheEpoch)
+        {
+            EXPECT_EQ("23:59", timeDisplay.GetTimeString(std::chrono::system_clock::from_time_t(-1)));
+            EXPECT_EQ("18:45", timeDisplay.GetTimeString(std::chrono::system_clock::from_time_t(-18900)));
+        }
+
+        TEST_F(DisplayTimeTest, GetTimeStringReturnsTheSameStringEveryTime)
+        {
+            std::chrono::system_clock::time_point time = HelperFunctions::GetTimeFromNumberString("1523");
+            EXPECT_EQ(&timeDisplay.GetTimeString(time), &timeDisplay.GetTimeString(time + std::chrono::seconds(59)));
+        }
+
         TEST_F(DisplayTimeTest, UnknownTimeDefaultsToDashes)
         {
             EXPECT_EQ(this->timeDisplay.unknownTimeFormatDefault, this->timeDisplay.GetUnknownTimeFormat());
@@ -1,10 +1,12 @@
 #include "pch/pch.h"
 #include "dependency/DependencyLoader.h"
+#include "dependency/DependencySnapshot.h"
 #include "mock/MockWinApi.h"
 #include "api/ApiException.h"
 
 using UKControllerPluginTest::Windows::MockWinApi;
 using UKControllerPlugin::Dependency::DependencyLoader;
+using UKControllerPlugin::Dependency::DependencySnapshot;
 using UKControllerPlugin::Api::ApiException;
 using ::testing::NiceMock;
 using ::testing::Test;
@@ -34,6 +36,22 @@ namespace UKControllerPluginTest {
                 { "baz", "noot "}
             };
 
+            // A dependency list with updated_at stamps, as saved by the dependency updater
+            nlohmann::json stampedDependencyList{
+                {
+                    {"key", "DEPENDENCY_ONE"},
+                    {"local_file", "test1.json"},
+                    {"uri", "test1"},
+                    {"updated_at", 2}
+                },
+                {
+                    {"key", "DEPENDENCY_TWO"},
+                    {"local_file", "test2.json"},
+                    {"uri", "test2"},
+                    {"updated_at", 2}
+                }
+            };
+
         };
 
         TEST_F(DependencyLoaderTest, ItLoadsDependencies)
@@ -292,5 +310,205 @@ namespace UKControllerPluginTest {
             DependencyLoader loader(this->mockWindows);
             EXPECT_EQ("{}", loader.LoadDependency("DEPENDENCY_ONE", "{}"));
         }
+
+        TEST_F(DependencyLoaderTest, ItReturnsDownloadedDependenciesWithoutReadingThem)
+        {
+            nlohmann::json dependencyList{
+                {
+                    {"key", "DEPENDENCY_ONE"},
+                    {"local_file", "test1.json"},
+                    {"uri", "test1"},
+                },
+                {
+                    {"key", "DEPENDENCY_TWO"},
+                    {"local_file", "test2.json"},
+                    {"uri", "test2"},
+                }
+            };
+
+            ON_CALL(this->mockWindows, FileExists(_))
+                .WillByDefault(Return(true));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillOnce(Return(dependencyList.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test1.json"), true))
+                .Times(0);
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test2.json"), true))
+                .WillOnce(Return(this->dependency2.dump()));
+
+            DependencyLoader loader(this->mockWindows, { { "DEPENDENCY_ONE", this->dependency1 } });
+            EXPECT_EQ(this->dependency1, loader.LoadDependency("DEPENDENCY_ONE", "{}"));
+            EXPECT_EQ(this->dependency2, loader.LoadDependency("DEPENDENCY_TWO", "{}"));
+        }
+
+        TEST_F(DependencyLoaderTest, ItLoadsDependenciesFromAnUpToDateSnapshot)
+        {
+            DependencySnapshot snapshot;
+            snapshot.AddDependency("DEPENDENCY_ONE", 2, this->dependency1);
+            snapshot.AddDependency("DEPENDENCY_TWO", 2, this->dependency2);
+
+            ON_CALL(this->mockWindows, FileExists(_))
+                .WillByDefault(Return(true));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillOnce(Return(this->stampedDependencyList.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadBinaryFromFile(std::wstring(L"dependencies/dependency-snapshot.bin")))
+                .WillOnce(Return(snapshot.Serialise()));
+
+            EXPECT_CALL(this->mockWindows, WriteBinaryToFile(_, _))
+                .Times(0);
+
+            DependencyLoader loader(this->mockWindows);
+            EXPECT_EQ(this->dependency1, loader.LoadDependency("DEPENDENCY_ONE", "{}"));
+            EXPECT_EQ(this->dependency2, loader.LoadDependency("DEPENDENCY_TWO", "{}"));
+            loader.SaveSnapshot();
+        }
+
+        TEST_F(DependencyLoaderTest, ItLoadsOutOfDateSnapshotDependenciesFromFile)
+        {
+            DependencySnapshot snapshot;
+            snapshot.AddDependency("DEPENDENCY_ONE", 1, "old");
+            snapshot.AddDependency("DEPENDENCY_TWO", 2, this->dependency2);
+
+            ON_CALL(this->mockWindows, FileExists(_))
+                .WillByDefault(Return(true));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillOnce(Return(this->stampedDependencyList.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test1.json"), true))
+                .WillOnce(Return(this->dependency1.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadBinaryFromFile(std::wstring(L"dependencies/dependency-snapshot.bin")))
+                .WillOnce(Return(snapshot.Serialise()));
+
+            DependencyLoader loader(this->mockWindows);
+            EXPECT_EQ(this->dependency1, loader.LoadDependency("DEPENDENCY_ONE", "{}"));
+            EXPECT_EQ(this->dependency2, loader.LoadDependency("DEPENDENCY_TWO", "{}"));
+        }
+
+        TEST_F(DependencyLoaderTest, ItLoadsDependenciesFromFileIfSnapshotInvalid)
+        {
+            ON_CALL(this->mockWindows, FileExists(_))
+                .WillByDefault(Return(true));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillOnce(Return(this->stampedDependencyList.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test1.json"), true))
+                .WillOnce(Return(this->dependency1.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadBinaryFromFile(std::wstring(L"dependencies/dependency-snapshot.bin")))
+                .WillOnce(Return("not a snapshot"));
+
+            DependencyLoader loader(this->mockWindows);
+            EXPECT_EQ(this->dependency1, loader.LoadDependency("DEPENDENCY_ONE", "{}"));
+        }
+
+        TEST_F(DependencyLoaderTest, ItSavesASnapshotOfEveryDependencyIfOutOfDate)
+        {
+            ON_CALL(this->mockWindows, FileExists(std::wstring(L"dependencies/dependency-list.json")))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, FileExists(std::wstring(L"dependencies/test1.json")))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, FileExists(std::wstring(L"dependencies/test2.json")))
+                .WillByDefault(Return(true));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillOnce(Return(this->stampedDependencyList.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test2.json"), true))
+                .WillOnce(Return(this->dependency2.dump()));
+
+            EXPECT_CALL(this->mockWindows, ReadBinaryFromFile(_))
+                .Times(0);
+
+            std::string savedSnapshot;
+            EXPECT_CALL(this->mockWindows, WriteBinaryToFile(std::wstring(L"dependencies/dependency-snapshot.bin"), _))
+                .WillOnce(testing::SaveArg<1>(&savedSnapshot));
+
+            DependencyLoader loader(this->mockWindows, { { "DEPENDENCY_ONE", this->dependency1 } });
+            EXPECT_EQ(this->dependency1, loader.LoadDependency("DEPENDENCY_ONE", "{}"));
+            loader.SaveSnapshot();
+
+            DependencySnapshot snapshot = DependencySnapshot::Deserialise(savedSnapshot);
+            EXPECT_EQ(2, snapshot.Count());
+            EXPECT_TRUE(snapshot.HasDependency("DEPENDENCY_ONE", 2));
+            EXPECT_TRUE(snapshot.HasDependency("DEPENDENCY_TWO", 2));
+            EXPECT_EQ(this->dependency1, snapshot.GetDependency("DEPENDENCY_ONE"));
+            EXPECT_EQ(this->dependency2, snapshot.GetDependency("DEPENDENCY_TWO"));
+        }
+
+        TEST_F(DependencyLoaderTest, ItDoesntSaveASnapshotIfDependenciesHaveNoStamps)
+        {
+            nlohmann::json dependencyList{
+                {
+                    {"key", "DEPENDENCY_ONE"},
+                    {"local_file", "test1.json"},
+                    {"uri", "test1"},
+                }
+            };
+
+            ON_CALL(this->mockWindows, FileExists(_))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillByDefault(Return(dependencyList.dump()));
+
+            EXPECT_CALL(this->mockWindows, WriteBinaryToFile(_, _))
+                .Times(0);
+
+            DependencyLoader loader(this->mockWindows);
+            loader.SaveSnapshot();
+        }
+
+        TEST_F(DependencyLoaderTest, ItLoadsDependenciesFromSeveralThreadsAtOnce)
+        {
+            ON_CALL(this->mockWindows, FileExists(std::wstring(L"dependencies/dependency-list.json")))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillByDefault(Return(this->stampedDependencyList.dump()));
+
+            ON_CALL(this->mockWindows, FileExists(std::wstring(L"dependencies/test1.json")))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test1.json"), true))
+                .WillByDefault(Return(this->dependency1.dump()));
+
+            ON_CALL(this->mockWindows, FileExists(std::wstring(L"dependencies/test2.json")))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/test2.json"), true))
+                .WillByDefault(Return(this->dependency2.dump()));
+
+            DependencyLoader loader(this->mockWindows);
+            std::atomic<int> mismatches(0);
+            std::vector<std::thread> threads;
+            for (int thread = 0; thread < 4; thread++) {
+                threads.push_back(std::thread([this, &loader, &mismatches]() {
+                    for (int load = 0; load < 50; load++) {
+                        if (loader.LoadDependency("DEPENDENCY_ONE", "{}") != this->dependency1) {
+                            mismatches++;
+                        }
+
+                        if (loader.LoadDependency("DEPENDENCY_TWO", "{}") != this->dependency2) {
+                            mismatches++;
+                        }
+                    }
+                }));
+            }
+
+            for (std::thread & thread : threads) {
+                thread.join();
+            }
+
+            EXPECT_EQ(0, mismatches);
+        }
     }  // namespace Dependency
 }  // namespace UKControllerPluginTest
@@ -0,0 +1,93 @@
+#include "pch/pch.h"
+#include "dependency/DependencySnapshot.h"
+
+using UKControllerPlugin::Dependency::DependencySnapshot;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Dependency {
+
+        class DependencySnapshotTest : public Test
+        {
+            public:
+                DependencySnapshotTest()
+                {
+                    this->snapshot.AddDependency("DEPENDENCY_ONE", 1, this->dependency1);
+                    this->snapshot.AddDependency("DEPENDENCY_TWO", 2, this->dependency2);
+                }
+
+                DependencySnapshot snapshot;
+
+                nlohmann::json dependency1 = {
+                    { "foo", "bar"}
+                };
+
+                nlohmann::json dependency2 = nlohmann::json::array({ 1, 2.5, "three", nullptr });
+        };
+
+        TEST_F(DependencySnapshotTest, ItCountsDependencies)
+        {
+            EXPECT_EQ(2, this->snapshot.Count());
+        }
+
+        TEST_F(DependencySnapshotTest, ItHasDependenciesWithMatchingStamps)
+        {
+            EXPECT_TRUE(this->snapshot.HasDependency("DEPENDENCY_ONE", 1));
+            EXPECT_TRUE(this->snapshot.HasDependency("DEPENDENCY_TWO", 2));
+        }
+
+        TEST_F(DependencySnapshotTest, ItDoesntHaveDependenciesWithDifferentStamps)
+        {
+            EXPECT_FALSE(this->snapshot.HasDependency("DEPENDENCY_ONE", 2));
+        }
+
+        TEST_F(DependencySnapshotTest, ItDoesntHaveUnknownDependencies)
+        {
+            EXPECT_FALSE(this->snapshot.HasDependency("DEPENDENCY_THREE", 1));
+        }
+
+        TEST_F(DependencySnapshotTest, ItSerialisesWithAHeader)
+        {
+            std::string serialised = this->snapshot.Serialise();
+            EXPECT_EQ(DependencySnapshot::magic, serialised.substr(0, DependencySnapshot::magic.size()));
+            EXPECT_EQ(
+                DependencySnapshot::formatVersion,
+                static_cast<uint8_t>(serialised[DependencySnapshot::magic.size()])
+            );
+        }
+
+        TEST_F(DependencySnapshotTest, ItRoundTrips)
+        {
+            DependencySnapshot loaded = DependencySnapshot::Deserialise(this->snapshot.Serialise());
+            EXPECT_EQ(2, loaded.Count());
+            EXPECT_TRUE(loaded.HasDependency("DEPENDENCY_ONE", 1));
+            EXPECT_TRUE(loaded.HasDependency("DEPENDENCY_TWO", 2));
+            EXPECT_EQ(this->dependency1, loaded.GetDependency("DEPENDENCY_ONE"));
+            EXPECT_EQ(this->dependency2, loaded.GetDependency("DEPENDENCY_TWO"));
+        }
+
+        TEST_F(DependencySnapshotTest, ItThrowsOnMissingMagic)
+        {
+            EXPECT_THROW(DependencySnapshot::Deserialise("{\"foo\": \"bar\"}"), std::invalid_argument);
+        }
+
+        TEST_F(DependencySnapshotTest, ItThrowsOnEmptySnapshot)
+        {
+            EXPECT_THROW(DependencySnapshot::Deserialise(""), std::invalid_argument);
+        }
+
+        TEST_F(DependencySnapshotTest, ItThrowsOnDifferentFormatVersion)
+        {
+            std::string serialised = this->snapshot.Serialise();
+            serialised[DependencySnapshot::magic.size()] = static_cast<char>(DependencySnapshot::formatVersion + 1);
+            EXPECT_THROW(DependencySnapshot::Deserialise(serialised), std::invalid_argument);
+        }
+
+        TEST_F(DependencySnapshotTest, ItThrowsOnCorruptData)
+        {
+            std::string serialised = this->snapshot.Serialise();
+            serialised.resize(serialised.size() - 5);
+            EXPECT_THROW(DependencySnapshot::Deserialise(serialised), std::invalid_argument);
+        }
+    }  // namespace Dependency
+}  // namespace UKControllerPluginTest
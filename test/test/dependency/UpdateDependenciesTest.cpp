@@ -603,5 +603,189 @@ namespace UKControllerPluginTest {
 
             UpdateDependencies(this->mockApi, this->mockWindows);
         }
+
+        TEST_F(UpdateDependenciesTest, UpdateDependenciesReturnsDownloadedDependencies)
+        {
+            nlohmann::json existingDependencyList{
+                {
+                    {"key", "DEPENDENCY_ONE"},
+                    {"local_file", "test1.json"},
+                    {"uri", "test1"},
+                    {"updated_at", 1}
+                },
+                {
+                    {"key", "DEPENDENCY_TWO"},
+                    {"local_file", "test2.json"},
+                    {"uri", "test2"},
+                    {"updated_at", 2}
+                }
+            };
+
+            nlohmann::json dependencyList{
+                {
+                    {"key", "DEPENDENCY_ONE"},
+                    {"local_file", "test1.json"},
+                    {"uri", "test1"},
+                    {"updated_at", 2}
+                },
+                {
+                    {"key", "DEPENDENCY_TWO"},
+                    {"local_file", "test2.json"},
+                    {"uri", "test2"},
+                    {"updated_at", 2}
+                }
+            };
+
+            ON_CALL(this->mockApi, GetDependencyList())
+                .WillByDefault(Return(dependencyList));
+
+            EXPECT_CALL(this->mockApi, GetUri("test1"))
+                .WillOnce(Return(this->dependency1));
+
+            EXPECT_CALL(this->mockApi, GetUri("test2"))
+                .Times(0);
+
+            ON_CALL(this->mockWindows, FileExists(_))
+                .WillByDefault(Return(true));
+
+            ON_CALL(this->mockWindows, ReadFromFileMock(std::wstring(L"dependencies/dependency-list.json"), true))
+                .WillByDefault(Return(existingDependencyList.dump()));
+
+            std::map<std::string, nlohmann::json> expected = { { "DEPENDENCY_ONE", this->dependency1 } };
+            EXPECT_EQ(expected, UpdateDependencies(this->mockApi, this->mockWindows));
+        }
+
+        TEST_F(UpdateDependenciesTest, UpdateDependenciesDoesntReturnFailedDownloads)
+        {
+            nlohmann::json dependencyList{
+                {
+                    {"key", "DEPENDENCY_ONE"},
+                    {"local_file", "test1.json"},
+                    {"uri", "test1"},
+                    {"updated_at", 2}
+                },
+                {
+                    {"key", "DEPENDENCY_TWO"},
+                    {"local_file", "test2.json"},
+                    {"uri", "test2"},
+                    {"updated_at", 2}
+                }
+            };
+
+            ON_CALL(this->mockApi, GetDependencyList())
+                .WillByDefault(Return(dependencyList));
+
+            ON_CALL(this->mockApi, GetUri("test1"))
+                .WillByDefault(Throw(ApiException("nah")));
+
+            ON_CALL(this->mockApi, GetUri("test2"))
+                .WillByDefault(Return(this->dependency2));
+
+            nlohmann::json savedList = nlohmann::json::array({ dependencyList[1] });
+            EXPECT_CALL(
+                this->mockWindows,
+                WriteToFile(std::wstring(L"dependencies/dependency-list.json"), savedList.dump(), true)
+            )
+                .Times(1);
+
+            EXPECT_CALL(
+                this->mockWindows,
+                WriteToFile(std::wstring(L"dependencies/test2.json"), this->dependency2.dump(), true)
+            )
+                .Times(1);
+
+            std::map<std::string, nlohmann::json> expected = { { "DEPENDENCY_TWO", this->dependency2 } };
+            EXPECT_EQ(expected, UpdateDependencies(this->mockApi, this->mockWindows));
+        }
+
+        TEST_F(UpdateDependenciesTest, UpdateDependenciesDownloadsConcurrently)
+        {
+            nlohmann::json dependencyList = nlohmann::json::array();
+            for (int dependency = 0; dependency < 6; dependency++) {
+                dependencyList.push_back(
+                    {
+                        {"key", "DEPENDENCY_" + std::to_string(dependency)},
+                        {"local_file", "test" + std::to_string(dependency) + ".json"},
+                        {"uri", "test" + std::to_string(dependency)},
+                        {"updated_at", 2}
+                    }
+                );
+            }
+
+            ON_CALL(this->mockApi, GetDependencyList())
+                .WillByDefault(Return(dependencyList));
+
+            // Each download waits a little while for the others to start, recording how many are in progress
+            std::atomic<int> inProgress(0);
+            std::atomic<int> mostInProgress(0);
+            ON_CALL(this->mockApi, GetUri(_))
+                .WillByDefault(testing::Invoke([&inProgress, &mostInProgress](std::string uri) -> nlohmann::json {
+                    int current = ++inProgress;
+                    int most = mostInProgress;
+                    while (current > most && !mostInProgress.compare_exchange_weak(most, current)) {}
+
+                    std::chrono::steady_clock::time_point giveUp =
+                        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+                    while (mostInProgress < 3 && std::chrono::steady_clock::now() < giveUp) {
+                        std::this_thread::yield();
+                    }
+
+                    inProgress--;
+                    return { { "uri", uri } };
+                }));
+
+            EXPECT_CALL(this->mockWindows, WriteToFile(_, _, true))
+                .Times(6);
+
+            EXPECT_CALL(
+                this->mockWindows,
+                WriteToFile(std::wstring(L"dependencies/dependency-list.json"), dependencyList.dump(), true)
+            )
+                .Times(1);
+
+            std::map<std::string, nlohmann::json> downloaded = UpdateDependencies(
+                this->mockApi,
+                this->mockWindows,
+                3
+            );
+
+            EXPECT_EQ(3, mostInProgress);
+            EXPECT_EQ(6, downloaded.size());
+            nlohmann::json expectedDependency = { { "uri", "test4" } };
+            EXPECT_EQ(expectedDependency, downloaded.at("DEPENDENCY_4"));
+        }
+
+        TEST_F(UpdateDependenciesTest, UpdateDependenciesTreatsAnyExceptionFromADownloadAsAFailure)
+        {
+            nlohmann::json dependencyList = nlohmann::json::array();
+            for (int dependency = 0; dependency < 3; dependency++) {
+                dependencyList.push_back(
+                    {
+                        {"key", "DEPENDENCY_" + std::to_string(dependency)},
+                        {"local_file", "test" + std::to_string(dependency) + ".json"},
+                        {"uri", "test" + std::to_string(dependency)},
+                        {"updated_at", 2}
+                    }
+                );
+            }
+
+            ON_CALL(this->mockApi, GetDependencyList())
+                .WillByDefault(Return(dependencyList));
+
+            ON_CALL(this->mockApi, GetUri("test0"))
+                .WillByDefault(Throw(std::runtime_error("not an api exception")));
+
+            ON_CALL(this->mockApi, GetUri("test1"))
+                .WillByDefault(Throw(42));
+
+            ON_CALL(this->mockApi, GetUri("test2"))
+                .WillByDefault(Return(this->dependency2));
+
+            std::map<std::string, nlohmann::json> downloaded;
+            EXPECT_NO_THROW(downloaded = UpdateDependencies(this->mockApi, this->mockWindows, 3));
+
+            std::map<std::string, nlohmann::json> expected = { { "DEPENDENCY_2", this->dependency2 } };
+            EXPECT_EQ(expected, downloaded);
+        }
     }  // namespace Dependency
 }  // namespace UKControllerPluginTest
@@ -2,12 +2,16 @@
 #include "euroscope/RadarTargetEventHandlerCollection.h"
 #include "mock/MockRadarTargetEventHandlerInterface.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "performance/HandlerMetrics.h"
+#include "performance/HandlerMetricsCollection.h"
 
 using UKControllerPlugin::Euroscope::RadarTargetEventHandlerCollection;
 using UKControllerPluginTest::EventHandler::MockRadarTargetEventHandlerInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
 
 using ::testing::StrictMock;
+using ::testing::NiceMock;
 using ::testing::_;
 
 namespace UKControllerPluginTest {
@@ -83,5 +87,20 @@ namespace UKControllerPluginTest {
             collection.RegisterHandler(mockInterface);
             EXPECT_EQ(1, collection.CountHandlers());
         }
+
+        TEST(RadarTargetEventHandlerCollection, RadarTargetEventRecordsHandlerMetrics)
+        {
+            std::shared_ptr<HandlerMetricsCollection> metrics = std::make_shared<HandlerMetricsCollection>();
+            RadarTargetEventHandlerCollection collection(metrics);
+            NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            collection.RegisterHandler(std::make_shared<NiceMock<MockRadarTargetEventHandlerInterface>>());
+
+            collection.RadarTargetEvent(mockRadarTarget);
+            collection.RadarTargetEvent(mockRadarTarget);
+
+            ASSERT_EQ(1, metrics->CountMetrics());
+            EXPECT_EQ(0, metrics->GetMetricsByTotalTime()[0]->GetName().find("RadarTarget "));
+            EXPECT_EQ(2, metrics->GetMetricsByTotalTime()[0]->CountCalls());
+        }
     }  // namespace Euroscope
 }  // namespace UKControllerPluginTest
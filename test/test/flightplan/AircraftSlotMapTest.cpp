@@ -0,0 +1,106 @@
+#include "pch/pch.h"
+#include "flightplan/AircraftSlotMap.h"
+
+using UKControllerPlugin::Flightplan::AircraftId;
+using UKControllerPlugin::Flightplan::AircraftSlotMap;
+using UKControllerPlugin::Flightplan::invalidAircraftId;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Flightplan {
+
+        class AircraftSlotMapTest : public Test
+        {
+            public:
+                AircraftSlotMap<std::string> slots;
+        };
+
+        TEST_F(AircraftSlotMapTest, ItStartsEmpty)
+        {
+            EXPECT_EQ(0, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, FindReturnsNullIfNotSet)
+        {
+            EXPECT_EQ(nullptr, this->slots.Find({ 3, 0 }));
+        }
+
+        TEST_F(AircraftSlotMapTest, FindReturnsNullForInvalidId)
+        {
+            EXPECT_EQ(nullptr, this->slots.Find(invalidAircraftId));
+        }
+
+        TEST_F(AircraftSlotMapTest, ItSetsData)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            EXPECT_EQ("foo", *this->slots.Find({ 3, 0 }));
+            EXPECT_EQ(1, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, ItOverwritesData)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            this->slots.Set({ 3, 0 }, "bar");
+            EXPECT_EQ("bar", *this->slots.Find({ 3, 0 }));
+            EXPECT_EQ(1, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, ItDoesntReturnDataForAPreviousGeneration)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            EXPECT_EQ(nullptr, this->slots.Find({ 3, 1 }));
+        }
+
+        TEST_F(AircraftSlotMapTest, FirstOrNewReplacesDataFromAPreviousGeneration)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            EXPECT_EQ("", this->slots.FirstOrNew({ 3, 1 }));
+            EXPECT_EQ(1, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, FirstOrNewReturnsExistingData)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            this->slots.FirstOrNew({ 3, 0 }) += "bar";
+            EXPECT_EQ("foobar", *this->slots.Find({ 3, 0 }));
+        }
+
+        TEST_F(AircraftSlotMapTest, ItErasesData)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            this->slots.Erase({ 3, 0 });
+            EXPECT_EQ(nullptr, this->slots.Find({ 3, 0 }));
+            EXPECT_EQ(0, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, ErasingAnInvalidIdDoesNothing)
+        {
+            this->slots.Set({ 3, 0 }, "foo");
+            this->slots.Erase(invalidAircraftId);
+            this->slots.Erase({ 3, 1 });
+            EXPECT_EQ(1, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, ItErasesDataMatchingAPredicate)
+        {
+            this->slots.Set({ 0, 0 }, "foo");
+            this->slots.Set({ 1, 0 }, "bar");
+            this->slots.Set({ 2, 0 }, "foo");
+            this->slots.EraseIf([](const std::string & value) { return value == "foo"; });
+            EXPECT_EQ(nullptr, this->slots.Find({ 0, 0 }));
+            EXPECT_EQ("bar", *this->slots.Find({ 1, 0 }));
+            EXPECT_EQ(nullptr, this->slots.Find({ 2, 0 }));
+            EXPECT_EQ(1, this->slots.Count());
+        }
+
+        TEST_F(AircraftSlotMapTest, ItClearsData)
+        {
+            this->slots.Set({ 0, 0 }, "foo");
+            this->slots.Set({ 1, 0 }, "bar");
+            this->slots.Clear();
+            EXPECT_EQ(nullptr, this->slots.Find({ 0, 0 }));
+            EXPECT_EQ(nullptr, this->slots.Find({ 1, 0 }));
+            EXPECT_EQ(0, this->slots.Count());
+        }
+    }  // namespace Flightplan
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,121 @@
+#include "pch/pch.h"
+#include "flightplan/CallsignRegistry.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroScopeCRadarTargetInterface.h"
+
+using UKControllerPlugin::Flightplan::AircraftId;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::invalidAircraftId;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using ::testing::Test;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace UKControllerPluginTest {
+    namespace Flightplan {
+
+        class CallsignRegistryTest : public Test
+        {
+            public:
+                CallsignRegistryTest()
+                {
+                    ON_CALL(this->flightplan, GetCallsign())
+                        .WillByDefault(Return("BAW123"));
+                }
+
+                NiceMock<MockEuroScopeCFlightPlanInterface> flightplan;
+                NiceMock<MockEuroScopeCRadarTargetInterface> radarTarget;
+                CallsignRegistry registry;
+        };
+
+        TEST_F(CallsignRegistryTest, ItStartsEmpty)
+        {
+            EXPECT_EQ(0, this->registry.CountActive());
+            EXPECT_EQ(0, this->registry.CountSlots());
+        }
+
+        TEST_F(CallsignRegistryTest, ItHandsOutDenseIds)
+        {
+            EXPECT_EQ(0, this->registry.Intern("BAW123").index);
+            EXPECT_EQ(1, this->registry.Intern("EZY234").index);
+            EXPECT_EQ(2, this->registry.Intern("RYR345").index);
+            EXPECT_EQ(3, this->registry.CountActive());
+        }
+
+        TEST_F(CallsignRegistryTest, ItReturnsTheSameIdForTheSameCallsign)
+        {
+            AircraftId id = this->registry.Intern("BAW123");
+            this->registry.Intern("EZY234");
+            EXPECT_EQ(id, this->registry.Intern("BAW123"));
+            EXPECT_EQ(id, this->registry.Find("BAW123"));
+            EXPECT_EQ(2, this->registry.CountActive());
+        }
+
+        TEST_F(CallsignRegistryTest, FindReturnsInvalidIfNotInterned)
+        {
+            EXPECT_EQ(invalidAircraftId, this->registry.Find("BAW123"));
+            EXPECT_EQ(0, this->registry.CountActive());
+        }
+
+        TEST_F(CallsignRegistryTest, ItReturnsTheCallsignForAnId)
+        {
+            AircraftId id = this->registry.Intern("BAW123");
+            EXPECT_EQ("BAW123", this->registry.GetCallsign(id));
+        }
+
+        TEST_F(CallsignRegistryTest, ItReturnsNoCallsignForAnInvalidId)
+        {
+            EXPECT_EQ(this->registry.noCallsign, this->registry.GetCallsign(invalidAircraftId));
+        }
+
+        TEST_F(CallsignRegistryTest, ItRecyclesReleasedIds)
+        {
+            AircraftId first = this->registry.Intern("BAW123");
+            this->registry.Intern("EZY234");
+            this->registry.Release("BAW123");
+
+            AircraftId recycled = this->registry.Intern("RYR345");
+            EXPECT_EQ(first.index, recycled.index);
+            EXPECT_NE(first, recycled);
+            EXPECT_EQ(2, this->registry.CountSlots());
+            EXPECT_EQ(2, this->registry.CountActive());
+        }
+
+        TEST_F(CallsignRegistryTest, ReleasedIdsAreNoLongerCurrent)
+        {
+            AircraftId id = this->registry.Intern("BAW123");
+            EXPECT_TRUE(this->registry.IsCurrent(id));
+            this->registry.Release("BAW123");
+            EXPECT_FALSE(this->registry.IsCurrent(id));
+            EXPECT_EQ(this->registry.noCallsign, this->registry.GetCallsign(id));
+        }
+
+        TEST_F(CallsignRegistryTest, ReleasingAnUnknownCallsignDoesNothing)
+        {
+            this->registry.Intern("BAW123");
+            EXPECT_NO_THROW(this->registry.Release("EZY234"));
+            EXPECT_EQ(1, this->registry.CountActive());
+        }
+
+        TEST_F(CallsignRegistryTest, FlightplanEventInternsTheCallsign)
+        {
+            this->registry.FlightPlanEvent(this->flightplan, this->radarTarget);
+            EXPECT_NE(invalidAircraftId, this->registry.Find("BAW123"));
+        }
+
+        TEST_F(CallsignRegistryTest, FlightplanDisconnectReleasesTheCallsign)
+        {
+            this->registry.FlightPlanEvent(this->flightplan, this->radarTarget);
+            this->registry.FlightPlanDisconnectEvent(this->flightplan);
+            EXPECT_EQ(invalidAircraftId, this->registry.Find("BAW123"));
+            EXPECT_EQ(0, this->registry.CountActive());
+        }
+
+        TEST_F(CallsignRegistryTest, ControllerFlightplanDataEventDoesNothing)
+        {
+            this->registry.ControllerFlightPlanDataEvent(this->flightplan, 1);
+            EXPECT_EQ(0, this->registry.CountActive());
+        }
+    }  // namespace Flightplan
+}  // namespace UKControllerPluginTest
@@ -3,18 +3,73 @@
 #include "mock/MockFlightPlanEventHandlerInterface.h"
 #include "mock/MockEuroScopeCFlightplanInterface.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "performance/HandlerMetrics.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "flightplan/StoredFlightplan.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "flightplan/StoredFlightplanEventHandler.h"
 
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanEventHandler;
 using UKControllerPluginTest::Flightplan::MockFlightPlanEventHandlerInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
 
 using ::testing::_;
 using ::testing::StrictMock;
+using ::testing::NiceMock;
+using ::testing::Return;
 
 namespace UKControllerPluginTest {
     namespace EventHandler {
 
+        /*
+            A handler that only depends on the destination.
+        */
+        class MockDestinationDependentHandler : public MockFlightPlanEventHandlerInterface
+        {
+            public:
+                unsigned int GetFlightplanFieldDependencies(void) const override
+                {
+                    return StoredFlightplan::destinationChanged;
+                }
+        };
+
+        class FlightPlanEventHandlerCollectionChangedFieldsTest : public ::testing::Test
+        {
+            public:
+                FlightPlanEventHandlerCollectionChangedFieldsTest()
+                    : dependentHandler(std::make_shared<StrictMock<MockDestinationDependentHandler>>()),
+                    everyEventHandler(std::make_shared<StrictMock<MockFlightPlanEventHandlerInterface>>())
+                {
+                    ON_CALL(this->mockFlightPlan, GetCallsign())
+                        .WillByDefault(Return("BAW123"));
+
+                    ON_CALL(this->mockFlightPlan, GetDestination())
+                        .WillByDefault(Return("EGLL"));
+
+                    ON_CALL(this->mockFlightPlan, GetAircraftType())
+                        .WillByDefault(Return("B738"));
+
+                    this->collection.RegisterHandler(
+                        std::make_shared<StoredFlightplanEventHandler>(this->storedFlightplans)
+                    );
+                    this->collection.SetStoredFlightplans(this->storedFlightplans);
+                    this->collection.RegisterHandler(this->dependentHandler);
+                    this->collection.RegisterHandler(this->everyEventHandler);
+                }
+
+                StoredFlightplanCollection storedFlightplans;
+                NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightPlan;
+                NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+                std::shared_ptr<StrictMock<MockDestinationDependentHandler>> dependentHandler;
+                std::shared_ptr<StrictMock<MockFlightPlanEventHandlerInterface>> everyEventHandler;
+                FlightPlanEventHandlerCollection collection;
+        };
+
         TEST(FlightPlanEventHandlerCollection, TestFlightplanEventCallsTheCorrectHandlerMethod)
         {
             FlightPlanEventHandlerCollection collection;
@@ -102,5 +157,126 @@ namespace UKControllerPluginTest {
             collection.RegisterHandler(handler);
             EXPECT_EQ(1, collection.CountHandlers());
         }
+
+        TEST(FlightPlanEventHandlerCollection, FlightPlanEventRecordsHandlerMetrics)
+        {
+            std::shared_ptr<HandlerMetricsCollection> metrics = std::make_shared<HandlerMetricsCollection>();
+            FlightPlanEventHandlerCollection collection(metrics);
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightPlan;
+            NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            collection.RegisterHandler(std::make_shared<NiceMock<MockFlightPlanEventHandlerInterface>>());
+
+            collection.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+            collection.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+
+            ASSERT_EQ(1, metrics->CountMetrics());
+            EXPECT_EQ(0, metrics->GetMetricsByTotalTime()[0]->GetName().find("FlightPlan "));
+            EXPECT_EQ(2, metrics->GetMetricsByTotalTime()[0]->CountCalls());
+        }
+
+        TEST_F(FlightPlanEventHandlerCollectionChangedFieldsTest, ItPassesTheFirstEventForAFlightplanToEveryHandler)
+        {
+            EXPECT_CALL(*this->dependentHandler, FlightPlanEvent(_, _))
+                .Times(1);
+
+            EXPECT_CALL(*this->everyEventHandler, FlightPlanEvent(_, _))
+                .Times(1);
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+        }
+
+        TEST_F(FlightPlanEventHandlerCollectionChangedFieldsTest, ItSkipsHandlersIfNothingTheyDependOnHasChanged)
+        {
+            EXPECT_CALL(*this->dependentHandler, FlightPlanEvent(_, _))
+                .Times(1);
+
+            EXPECT_CALL(*this->everyEventHandler, FlightPlanEvent(_, _))
+                .Times(3);
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+
+            ON_CALL(this->mockFlightPlan, GetAircraftType())
+                .WillByDefault(Return("A320"));
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+        }
+
+        TEST_F(FlightPlanEventHandlerCollectionChangedFieldsTest, ItPassesEventsOnIfAFieldTheHandlerDependsOnChanges)
+        {
+            EXPECT_CALL(*this->dependentHandler, FlightPlanEvent(_, _))
+                .Times(2);
+
+            EXPECT_CALL(*this->everyEventHandler, FlightPlanEvent(_, _))
+                .Times(2);
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+
+            ON_CALL(this->mockFlightPlan, GetDestination())
+                .WillByDefault(Return("EGKK"));
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+        }
+
+        TEST_F(FlightPlanEventHandlerCollectionChangedFieldsTest, ItDetectsAChangeBackToAPreviousValue)
+        {
+            EXPECT_CALL(*this->dependentHandler, FlightPlanEvent(_, _))
+                .Times(3);
+
+            EXPECT_CALL(*this->everyEventHandler, FlightPlanEvent(_, _))
+                .Times(3);
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+
+            ON_CALL(this->mockFlightPlan, GetDestination())
+                .WillByDefault(Return("EGKK"));
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+
+            ON_CALL(this->mockFlightPlan, GetDestination())
+                .WillByDefault(Return("EGLL"));
+
+            this->collection.FlightPlanEvent(this->mockFlightPlan, this->mockRadarTarget);
+        }
+
+        TEST(FlightPlanEventHandlerCollection, ItPassesEveryEventOnIfTheFlightplanIsNotStored)
+        {
+            StoredFlightplanCollection storedFlightplans;
+            FlightPlanEventHandlerCollection collection;
+            collection.SetStoredFlightplans(storedFlightplans);
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightPlan;
+            NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            std::shared_ptr<StrictMock<MockDestinationDependentHandler>> handler =
+                std::make_shared<StrictMock<MockDestinationDependentHandler>>();
+            collection.RegisterHandler(handler);
+
+            EXPECT_CALL(*handler, FlightPlanEvent(_, _))
+                .Times(2);
+
+            collection.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+            collection.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+        }
+
+        TEST(FlightPlanEventHandlerCollection, ItPassesEveryEventToHandlersRegisteredBeforeTheStoredFlightplans)
+        {
+            StoredFlightplanCollection storedFlightplans;
+            FlightPlanEventHandlerCollection collection;
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightPlan;
+            NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            std::shared_ptr<StrictMock<MockDestinationDependentHandler>> handler =
+                std::make_shared<StrictMock<MockDestinationDependentHandler>>();
+            collection.RegisterHandler(handler);
+            collection.RegisterHandler(std::make_shared<StoredFlightplanEventHandler>(storedFlightplans));
+            collection.SetStoredFlightplans(storedFlightplans);
+
+            ON_CALL(mockFlightPlan, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            EXPECT_CALL(*handler, FlightPlanEvent(_, _))
+                .Times(2);
+
+            collection.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+            collection.FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+        }
     }  // namespace EventHandler
 }  // namespace UKControllerPluginTest
@@ -3,11 +3,23 @@
 #include "bootstrap/PersistenceContainer.h"
 #include "timedevent/TimedEventCollection.h"
 #include "flightplan/FlightPlanEventHandlerCollection.h"
+#include "flightplan/StoredFlightplan.h"
+#include "flightplan/StoredFlightplanCollection.h"
+#include "mock/MockFlightPlanEventHandlerInterface.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroScopeCRadarTargetInterface.h"
 
 using UKControllerPlugin::Flightplan::FlightplanStorageBootstrap;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
 using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPluginTest::Flightplan::MockFlightPlanEventHandlerInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::_;
 
 namespace UKControllerPlugin {
     namespace Flightplan {
@@ -17,6 +29,7 @@ namespace UKControllerPlugin {
             PersistenceContainer container;
             container.timedHandler = std::make_unique<TimedEventCollection>();
             container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.flightplans = std::make_unique<StoredFlightplanCollection>();
 
             FlightplanStorageBootstrap::BootstrapPlugin(container);
             EXPECT_EQ(1, container.timedHandler->CountHandlers());
@@ -31,13 +44,65 @@ namespace UKControllerPlugin {
             PersistenceContainer container;
             container.timedHandler = std::make_unique<TimedEventCollection>();
             container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.flightplans = std::make_unique<StoredFlightplanCollection>();
 
             FlightplanStorageBootstrap::BootstrapPlugin(container);
-            EXPECT_EQ(1, container.flightplanHandler->CountHandlers());
+            EXPECT_EQ(2, container.flightplanHandler->CountHandlers());
             EXPECT_EQ(
                 1,
                 container.timedHandler->CountHandlersForFrequency(FlightplanStorageBootstrap::timedEventFrequency)
             );
         }
+
+        TEST(FlightplanStorageBootstrap, BootstrapPluginCreatesCallsignRegistry)
+        {
+            PersistenceContainer container;
+            container.timedHandler = std::make_unique<TimedEventCollection>();
+            container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.flightplans = std::make_unique<StoredFlightplanCollection>();
+
+            FlightplanStorageBootstrap::BootstrapPlugin(container);
+            EXPECT_NE(nullptr, container.callsignRegistry);
+            EXPECT_EQ(0, container.callsignRegistry->CountActive());
+        }
+
+        /*
+            A handler that only depends on the origin.
+        */
+        class MockOriginDependentHandler : public MockFlightPlanEventHandlerInterface
+        {
+            public:
+                unsigned int GetFlightplanFieldDependencies(void) const override
+                {
+                    return StoredFlightplan::originChanged;
+                }
+        };
+
+        TEST(FlightplanStorageBootstrap, BootstrapPluginSkipsLaterHandlersWhenTheirFieldsHaveNotChanged)
+        {
+            PersistenceContainer container;
+            container.timedHandler = std::make_unique<TimedEventCollection>();
+            container.flightplanHandler = std::make_unique<FlightPlanEventHandlerCollection>();
+            container.flightplans = std::make_unique<StoredFlightplanCollection>();
+
+            FlightplanStorageBootstrap::BootstrapPlugin(container);
+            std::shared_ptr<NiceMock<MockOriginDependentHandler>> handler =
+                std::make_shared<NiceMock<MockOriginDependentHandler>>();
+            container.flightplanHandler->RegisterHandler(handler);
+
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockFlightPlan;
+            NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            ON_CALL(mockFlightPlan, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockFlightPlan, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            EXPECT_CALL(*handler, FlightPlanEvent(_, _))
+                .Times(1);
+
+            container.flightplanHandler->FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+            container.flightplanHandler->FlightPlanEvent(mockFlightPlan, mockRadarTarget);
+        }
     }  // namespace Flightplan
 }  // namespace UKControllerPlugin
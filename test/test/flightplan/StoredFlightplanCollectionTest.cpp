@@ -1,9 +1,13 @@
 #include "pch/pch.h"
 #include "flightplan/StoredFlightplanCollection.h"
 #include "flightplan/StoredFlightplan.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
 
 using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Flightplan::StoredFlightplanCollection;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using ::testing::NiceMock;
+using ::testing::Return;
 
 namespace UKControllerPluginTest {
     namespace Flightplan {
@@ -39,6 +43,47 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(retrievedPlan.GetDestination() == "EGNM");
         }
 
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeAddsPlanIfNotExists)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            StoredFlightplanCollection collection;
+            StoredFlightplan & plan = collection.UpdatePlan(mockEuroscope);
+
+            EXPECT_EQ(&plan, &collection.GetFlightplanForCallsign("BAW123"));
+            EXPECT_EQ("EGKK", plan.GetOrigin());
+            EXPECT_EQ(StoredFlightplan::allFieldsChanged, plan.GetChangedFields());
+        }
+
+        TEST(StoredFlightplanCollection, UpdatePlanFromEuroscopeUpdatesPlanInPlace)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            StoredFlightplanCollection collection;
+            StoredFlightplan & first = collection.UpdatePlan(mockEuroscope);
+            std::chrono::system_clock::time_point offBlock = std::chrono::system_clock::now();
+            first.SetActualOffBlockTime(offBlock);
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGLL"));
+
+            StoredFlightplan & second = collection.UpdatePlan(mockEuroscope);
+            EXPECT_EQ(&first, &second);
+            EXPECT_EQ("EGLL", second.GetOrigin());
+            EXPECT_EQ(offBlock, second.GetActualOffBlockTime());
+            EXPECT_EQ(StoredFlightplan::originChanged, second.GetChangedFields());
+        }
+
         TEST(StoredFlightplanCollection, RemovePlanByCallsignRemovesAPlan)
         {
             StoredFlightplanCollection collection;
@@ -354,5 +354,187 @@ namespace UKControllerPluginTest {
             plan.SetEstimatedDepartureTime(time);
             EXPECT_EQ(time, plan.GetEstimatedDepartureTime());
         }
+
+        TEST(StoredFlightplan, NewFlightplansHaveAllFieldsChanged)
+        {
+            StoredFlightplan plan("BAW123", "EGKK", "EDDF");
+            EXPECT_EQ(StoredFlightplan::allFieldsChanged, plan.GetChangedFields());
+        }
+
+        TEST(StoredFlightplan, FlightplansFromEuroscopeHaveAllFieldsChanged)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            StoredFlightplan plan(mockEuroscope);
+            EXPECT_EQ(StoredFlightplan::allFieldsChanged, plan.GetChangedFields());
+        }
+
+        TEST(StoredFlightplan, UpdateFromEuroscopeReportsNoChangesIfNothingChanged)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(mockEuroscope, GetDestination())
+                .WillByDefault(Return("EDDF"));
+
+            ON_CALL(mockEuroscope, GetExpectedDepartureTime())
+                .WillByDefault(Return("2301"));
+
+            StoredFlightplan plan(mockEuroscope);
+            std::chrono::system_clock::time_point eobt = plan.GetExpectedOffBlockTime();
+
+            EXPECT_EQ(StoredFlightplan::noFieldsChanged, plan.UpdateFromEuroscope(mockEuroscope));
+            EXPECT_EQ(StoredFlightplan::noFieldsChanged, plan.GetChangedFields());
+            EXPECT_FALSE(plan.HasChanged(StoredFlightplan::allFieldsChanged));
+            EXPECT_EQ(eobt, plan.GetExpectedOffBlockTime());
+        }
+
+        TEST(StoredFlightplan, UpdateFromEuroscopeUpdatesChangedFields)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetOrigin())
+                .WillByDefault(Return("EGKK"));
+
+            ON_CALL(mockEuroscope, GetDestination())
+                .WillByDefault(Return("EDDF"));
+
+            StoredFlightplan plan(mockEuroscope);
+
+            ON_CALL(mockEuroscope, GetDestination())
+                .WillByDefault(Return("EDDM"));
+
+            ON_CALL(mockEuroscope, HasAssignedSquawk())
+                .WillByDefault(Return(true));
+
+            ON_CALL(mockEuroscope, GetAssignedSquawk())
+                .WillByDefault(Return("2415"));
+
+            EXPECT_EQ(
+                StoredFlightplan::destinationChanged | StoredFlightplan::squawkChanged,
+                plan.UpdateFromEuroscope(mockEuroscope)
+            );
+            EXPECT_TRUE(plan.HasChanged(StoredFlightplan::destinationChanged));
+            EXPECT_TRUE(plan.HasChanged(StoredFlightplan::squawkChanged));
+            EXPECT_FALSE(plan.HasChanged(StoredFlightplan::originChanged));
+            EXPECT_FALSE(plan.HasChanged(StoredFlightplan::expectedOffBlockTimeChanged));
+            EXPECT_EQ("EGKK", plan.GetOrigin());
+            EXPECT_EQ("EDDM", plan.GetDestination());
+            EXPECT_EQ("2415", plan.GetPreviouslyAssignedSquawk());
+        }
+
+        TEST(StoredFlightplan, UpdateFromEuroscopeReportsChangesToFieldsThatHandlersDependOn)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetRawRouteString())
+                .WillByDefault(Return("LAM UL612 BPK"));
+
+            ON_CALL(mockEuroscope, GetSidName())
+                .WillByDefault(Return("LAM6M"));
+
+            ON_CALL(mockEuroscope, GetAircraftType())
+                .WillByDefault(Return("B738"));
+
+            ON_CALL(mockEuroscope, GetIcaoWakeCategory())
+                .WillByDefault(Return("M"));
+
+            ON_CALL(mockEuroscope, GetCruiseLevel())
+                .WillByDefault(Return(35000));
+
+            StoredFlightplan plan(mockEuroscope);
+            EXPECT_EQ(StoredFlightplan::noFieldsChanged, plan.UpdateFromEuroscope(mockEuroscope));
+
+            ON_CALL(mockEuroscope, GetRawRouteString())
+                .WillByDefault(Return("DVR UL9 KONAN"));
+
+            ON_CALL(mockEuroscope, GetSidName())
+                .WillByDefault(Return("DVR1X"));
+
+            ON_CALL(mockEuroscope, GetAircraftType())
+                .WillByDefault(Return("B744"));
+
+            ON_CALL(mockEuroscope, GetIcaoWakeCategory())
+                .WillByDefault(Return("H"));
+
+            ON_CALL(mockEuroscope, GetCruiseLevel())
+                .WillByDefault(Return(37000));
+
+            EXPECT_EQ(
+                StoredFlightplan::routeChanged | StoredFlightplan::sidChanged |
+                    StoredFlightplan::aircraftTypeChanged | StoredFlightplan::wakeCategoryChanged |
+                    StoredFlightplan::cruiseLevelChanged,
+                plan.UpdateFromEuroscope(mockEuroscope)
+            );
+            EXPECT_FALSE(plan.HasChanged(StoredFlightplan::originChanged | StoredFlightplan::destinationChanged));
+        }
+
+        TEST(StoredFlightplan, AssignmentCopiesTheFieldsUsedToDetectChanges)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetAircraftType())
+                .WillByDefault(Return("B738"));
+
+            ON_CALL(mockEuroscope, GetCruiseLevel())
+                .WillByDefault(Return(35000));
+
+            StoredFlightplan original(mockEuroscope);
+            StoredFlightplan copy("BAW123", "", "");
+            copy = original;
+
+            EXPECT_EQ(StoredFlightplan::noFieldsChanged, copy.UpdateFromEuroscope(mockEuroscope));
+        }
+
+        TEST(StoredFlightplan, UpdateFromEuroscopeUpdatesExpectedOffBlockTime)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetExpectedDepartureTime())
+                .WillByDefault(Return("2301"));
+
+            StoredFlightplan plan(mockEuroscope);
+
+            ON_CALL(mockEuroscope, GetExpectedDepartureTime())
+                .WillByDefault(Return("1015"));
+
+            EXPECT_EQ(StoredFlightplan::expectedOffBlockTimeChanged, plan.UpdateFromEuroscope(mockEuroscope));
+            EXPECT_EQ(
+                HelperFunctions::GetTimeFromNumberString("1000"),
+                plan.GetExpectedOffBlockTime()
+            );
+        }
+
+        TEST(StoredFlightplan, UpdateFromEuroscopeClearsExpectedOffBlockTime)
+        {
+            NiceMock<MockEuroScopeCFlightPlanInterface> mockEuroscope;
+            ON_CALL(mockEuroscope, GetCallsign())
+                .WillByDefault(Return("BAW123"));
+
+            ON_CALL(mockEuroscope, GetExpectedDepartureTime())
+                .WillByDefault(Return("2301"));
+
+            StoredFlightplan plan(mockEuroscope);
+
+            ON_CALL(mockEuroscope, GetExpectedDepartureTime())
+                .WillByDefault(Return(""));
+
+            EXPECT_EQ(StoredFlightplan::expectedOffBlockTimeChanged, plan.UpdateFromEuroscope(mockEuroscope));
+            EXPECT_EQ((std::chrono::system_clock::time_point::max)(), plan.GetExpectedOffBlockTime());
+        }
     }  // namespace Flightplan
 }  // namespace UKControllerPluginTest
@@ -9,8 +9,12 @@
 #include "mock/MockEuroScopeCFlightplanInterface.h"
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
 #include "tag/TagData.h"
+#include "flightplan/CallsignRegistry.h"
+#include "flightplan/StoredFlightplan.h"
 
 using UKControllerPlugin::Tag::TagData;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 using UKControllerPlugin::Handoff::HandoffEventHandler;
 using UKControllerPlugin::Handoff::HandoffCollection;
 using UKControllerPlugin::Handoff::CachedHandoff;
@@ -31,7 +35,7 @@ namespace UKControllerPluginTest {
         {
             public:
                 HandoffEventHandlerTest()
-                    : handler(handoffs, activeCallsigns), position1("LON_S_CTR", 129.420, "CTR", {}),
+                    : handler(handoffs, activeCallsigns, aircraft), position1("LON_S_CTR", 129.420, "CTR", {}),
                     position2("LON_SC_CTR", 132.6, "CTR", {}),
                     tagData(
                         mockFlightplan,
@@ -69,6 +73,7 @@ namespace UKControllerPluginTest {
                 NiceMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
                 HandoffCollection handoffs;
                 ActiveCallsignCollection activeCallsigns;
+                CallsignRegistry aircraft;
                 TagData tagData;
                 HandoffEventHandler handler;
         };
@@ -78,6 +83,14 @@ namespace UKControllerPluginTest {
             EXPECT_EQ("Departure Handoff Next Controller", this->handler.GetTagItemDescription(0));
         }
 
+        TEST_F(HandoffEventHandlerTest, TestItDependsOnTheOriginAndSid)
+        {
+            EXPECT_EQ(
+                StoredFlightplan::originChanged | StoredFlightplan::sidChanged,
+                this->handler.GetFlightplanFieldDependencies()
+            );
+        }
+
         TEST_F(HandoffEventHandlerTest, TestItReturnsCachedTagItem)
         {
             this->handler.AddCachedItem("BAW123", CachedHandoff("123.456", "LON_S_CTR"));
@@ -165,6 +178,14 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(this->handler.DEFAULT_TAG_VALUE, this->handler.GetCachedItem("BAW123"));
         }
 
+        TEST_F(HandoffEventHandlerTest, TestItDoesntReturnCachedItemsForARecycledAircraft)
+        {
+            this->handler.AddCachedItem("BAW123", CachedHandoff("132.600", "LON_SC_CTR"));
+            this->aircraft.Release("BAW123");
+            this->aircraft.Intern("EZY234");
+            EXPECT_EQ(this->handler.DEFAULT_TAG_VALUE, this->handler.GetCachedItem("EZY234"));
+        }
+
         TEST_F(HandoffEventHandlerTest, TestItDoesntClearCacheOnFlightplanControllerDataChange)
         {
             this->handler.AddCachedItem("BAW123", CachedHandoff("132.600", "LON_SC_CTR"));
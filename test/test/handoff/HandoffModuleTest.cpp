@@ -10,6 +10,7 @@ using UKControllerPlugin::Handoff::BootstrapPlugin;
 using UKControllerPluginTest::Dependency::MockDependencyLoader;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
 using UKControllerPlugin::Tag::TagItemCollection;
 using UKControllerPlugin::Controller::ActiveCallsignCollection;
 using ::testing::Test;
@@ -26,6 +27,7 @@ namespace UKControllerPluginTest {
                     this->container.tagHandler.reset(new TagItemCollection);
                     this->container.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
                     this->container.activeCallsigns.reset(new ActiveCallsignCollection);
+                    this->container.callsignRegistry = std::make_shared<CallsignRegistry>();
                 }
 
                 PersistenceContainer container;
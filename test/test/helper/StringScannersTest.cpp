@@ -0,0 +1,101 @@
+#include "pch/pch.h"
+#include "helper/StringScanners.h"
+
+using UKControllerPlugin::Helper::IsAsciiLetter;
+using UKControllerPlugin::Helper::IsCallsignCharacter;
+using UKControllerPlugin::Helper::IsCircuitRoute;
+using UKControllerPlugin::Helper::ScanCommandArgument;
+using UKControllerPlugin::Helper::ScanQnh;
+using UKControllerPlugin::Helper::StartsWithIgnoringCase;
+
+namespace UKControllerPluginTest {
+    namespace Helper {
+
+        TEST(StringScannersTest, ScanQnhReturnsTheQnh)
+        {
+            EXPECT_EQ("1013", ScanQnh("EGLL 261250Z 24012KT 9999 FEW035 14/07 Q1013 NOSIG"));
+        }
+
+        TEST(StringScannersTest, ScanQnhReturnsQnhAtEndOfMetar)
+        {
+            EXPECT_EQ("0987", ScanQnh("EGKK 05010KT Q0987"));
+        }
+
+        TEST(StringScannersTest, ScanQnhSkipsThingsThatLookLikeQnhs)
+        {
+            EXPECT_EQ("1002", ScanQnh("EGKK 05010KT Q10 Q10105 QUIET Q1002"));
+        }
+
+        TEST(StringScannersTest, ScanQnhReturnsEmptyIfNotSeparatedBySpaces)
+        {
+            EXPECT_EQ("", ScanQnh("EGKK 05010KTQ1010 Q1010SCT010"));
+        }
+
+        TEST(StringScannersTest, ScanQnhReturnsEmptyIfTooShortAtEnd)
+        {
+            EXPECT_EQ("", ScanQnh("EGKK 05010KT Q101"));
+        }
+
+        TEST(StringScannersTest, ScanQnhReturnsEmptyIfNoQnh)
+        {
+            EXPECT_EQ("", ScanQnh("EGKK 05010KT SCT010"));
+            EXPECT_EQ("", ScanQnh(""));
+        }
+
+        TEST(StringScannersTest, IsCircuitRouteMatchesCircuits)
+        {
+            EXPECT_TRUE(IsCircuitRoute("CIRCUIT"));
+            EXPECT_TRUE(IsCircuitRoute("CIRCUITS"));
+            EXPECT_TRUE(IsCircuitRoute("VFR CIRCUITS"));
+            EXPECT_TRUE(IsCircuitRoute("vfr Circuits LOCAL"));
+        }
+
+        TEST(StringScannersTest, IsCircuitRouteDoesntMatchOtherRoutes)
+        {
+            EXPECT_FALSE(IsCircuitRoute(""));
+            EXPECT_FALSE(IsCircuitRoute("CIRC"));
+            EXPECT_FALSE(IsCircuitRoute("VFRCIRCUITS"));
+            EXPECT_FALSE(IsCircuitRoute("CHEW VALLEY FROME VFR CIRCUITS"));
+        }
+
+        TEST(StringScannersTest, StartsWithIgnoringCaseComparesThePrefix)
+        {
+            EXPECT_TRUE(StartsWithIgnoringCase("Hello World", "HELLO"));
+            EXPECT_TRUE(StartsWithIgnoringCase("Hello", ""));
+            EXPECT_FALSE(StartsWithIgnoringCase("Hell", "HELLO"));
+            EXPECT_FALSE(StartsWithIgnoringCase("Jello", "HELLO"));
+        }
+
+        TEST(StringScannersTest, ScanCommandArgumentReturnsTheArgument)
+        {
+            EXPECT_EQ("EGKK_APP", ScanCommandArgument(".ukcp owned EGKK_APP", ".ukcp owned ", IsCallsignCharacter, 20));
+        }
+
+        TEST(StringScannersTest, ScanCommandArgumentStopsAtTheMaximumLength)
+        {
+            EXPECT_EQ("EGKK", ScanCommandArgument(".ukcp owner EGKKX", ".ukcp owner ", IsAsciiLetter, 4));
+        }
+
+        TEST(StringScannersTest, ScanCommandArgumentStopsAtDisallowedCharacters)
+        {
+            EXPECT_EQ("EGK", ScanCommandArgument(".ukcp owner EGK1", ".ukcp owner ", IsAsciiLetter, 4));
+        }
+
+        TEST(StringScannersTest, ScanCommandArgumentReturnsEmptyIfPrefixDoesntMatch)
+        {
+            EXPECT_EQ("", ScanCommandArgument("ilikepie", ".ukcp owner ", IsAsciiLetter, 4));
+            EXPECT_EQ("", ScanCommandArgument(".ukcp own", ".ukcp owner ", IsAsciiLetter, 4));
+        }
+
+        TEST(StringScannersTest, IsCallsignCharacterAllowsCallsignCharacters)
+        {
+            EXPECT_TRUE(IsCallsignCharacter('A'));
+            EXPECT_TRUE(IsCallsignCharacter('z'));
+            EXPECT_TRUE(IsCallsignCharacter('9'));
+            EXPECT_TRUE(IsCallsignCharacter('_'));
+            EXPECT_TRUE(IsCallsignCharacter('-'));
+            EXPECT_FALSE(IsCallsignCharacter(' '));
+            EXPECT_FALSE(IsCallsignCharacter('.'));
+        }
+    }  // namespace Helper
+}  // namespace UKControllerPluginTest
@@ -1,14 +1,16 @@
 #include "pch/pch.h"
 #include "historytrail/AircraftHistoryTrail.h"
+#include "historytrail/HistoryTrailRepository.h"
 
 using UKControllerPlugin::HistoryTrail::AircraftHistoryTrail;
+using UKControllerPlugin::HistoryTrail::HistoryTrailRepository;
 
 namespace UKControllerPluginTest {
     namespace HistoryTrail {
 
         TEST(HistoryTrail, AddItemAddsItemQueueEmpty)
         {
-            AircraftHistoryTrail history("test");
+            HistoryTrailRepository repository(1);
 
             // Create a fake position
             EuroScopePlugIn::CPosition positionTest;
@@ -16,18 +18,18 @@ namespace UKControllerPluginTest {
             positionTest.m_Longitude = 2;
 
             // Add to the history trail, then get the trail to check values.
-            history.AddItem(positionTest);
-            std::deque<EuroScopePlugIn::CPosition> trail = history.GetTrail();
+            repository.AddPosition("test", positionTest);
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
 
             // Check the trail.
-            EXPECT_EQ(1, trail.size());
-            EXPECT_EQ(1, trail.front().m_Latitude);
-            EXPECT_EQ(2, trail.front().m_Longitude);
+            EXPECT_EQ(1, trail.Size());
+            EXPECT_EQ(1, trail.GetPosition(0).m_Latitude);
+            EXPECT_EQ(2, trail.GetPosition(0).m_Longitude);
         }
 
         TEST(HistoryTrail, AddItemAddsItemIfQueueNotFull)
         {
-            AircraftHistoryTrail history("test");
+            HistoryTrailRepository repository(1);
 
             // Create a fake position
             EuroScopePlugIn::CPosition positionTest;
@@ -35,18 +37,18 @@ namespace UKControllerPluginTest {
             positionTest.m_Longitude = 2;
 
             // Add to the history trail, then get the trail to check values.
-            history.AddItem(positionTest);
-            std::deque<EuroScopePlugIn::CPosition> trail = history.GetTrail();
+            repository.AddPosition("test", positionTest);
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
 
             // Check the trail.
-            EXPECT_EQ(1, trail.size());
-            EXPECT_EQ(1, trail.front().m_Latitude);
-            EXPECT_EQ(2, trail.front().m_Longitude);
+            EXPECT_EQ(1, trail.Size());
+            EXPECT_EQ(1, trail.GetPosition(0).m_Latitude);
+            EXPECT_EQ(2, trail.GetPosition(0).m_Longitude);
         }
 
         TEST(HistoryTrail, AddItemAddsItemIfQueueNotFullBoundary)
         {
-            AircraftHistoryTrail history("test");
+            HistoryTrailRepository repository(1);
 
             // Create a fake position
             EuroScopePlugIn::CPosition positionTest;
@@ -54,19 +56,32 @@ namespace UKControllerPluginTest {
             positionTest.m_Longitude = 2;
 
             // Add to the history trail, then get the trail to check values.
-            history.AddItem(positionTest);
-            std::deque<EuroScopePlugIn::CPosition> trail = history.GetTrail();
+            repository.AddPosition("test", positionTest);
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
 
             // Check the trail.
-            EXPECT_EQ(1, trail.size());
-            EXPECT_EQ(1, trail.front().m_Latitude);
-            EXPECT_EQ(2, trail.front().m_Longitude);
+            EXPECT_EQ(1, trail.Size());
+            EXPECT_EQ(1, trail.GetPosition(0).m_Latitude);
+            EXPECT_EQ(2, trail.GetPosition(0).m_Longitude);
         }
 
+        TEST(HistoryTrail, ItHasACallsign)
+        {
+            HistoryTrailRepository repository(1);
+            repository.RegisterAircraft("test");
+            EXPECT_EQ("test", repository.GetAircraft("test").GetCallsign());
+        }
+
+        TEST(HistoryTrail, ItStartsEmpty)
+        {
+            HistoryTrailRepository repository(1);
+            repository.RegisterAircraft("test");
+            EXPECT_EQ(0, repository.GetAircraft("test").Size());
+        }
 
         TEST(HistoryTrail, AddItemTrailItemsMaintainOrder)
         {
-            AircraftHistoryTrail history("test");
+            HistoryTrailRepository repository(1);
 
             // Create a fake position
             EuroScopePlugIn::CPosition positionTestFirst;
@@ -78,26 +93,25 @@ namespace UKControllerPluginTest {
             positionTestSecond.m_Longitude = 4;
 
             // Add to the history trail, then get the trail to check values.
-            history.AddItem(positionTestFirst);
-            history.AddItem(positionTestSecond);
-            std::deque<EuroScopePlugIn::CPosition> trail = history.GetTrail();
+            repository.AddPosition("test", positionTestFirst);
+            repository.AddPosition("test", positionTestSecond);
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
 
             // Check the trail.
-            EXPECT_EQ(2, trail.size());
+            EXPECT_EQ(2, trail.Size());
 
             // First item
-            EXPECT_EQ(1, trail.back().m_Latitude);
-            EXPECT_EQ(2, trail.back().m_Longitude);
+            EXPECT_EQ(1, trail.GetLatitude(1));
+            EXPECT_EQ(2, trail.GetLongitude(1));
 
             // Second item
-            trail.pop_back();
-            EXPECT_EQ(3, trail.back().m_Latitude);
-            EXPECT_EQ(4, trail.back().m_Longitude);
+            EXPECT_EQ(3, trail.GetLatitude(0));
+            EXPECT_EQ(4, trail.GetLongitude(0));
         }
 
         TEST(HistoryTrail, AddItemTrailRemovesLastItemIfFull)
         {
-            AircraftHistoryTrail history("test");
+            HistoryTrailRepository repository(1);
 
             // Create a fake position
             EuroScopePlugIn::CPosition positionTestFirst;
@@ -109,20 +123,106 @@ namespace UKControllerPluginTest {
             positionTestSecond.m_Longitude = 4;
 
             // Fill up the trail with the first value
-            for (unsigned int i = 0; i < history.maxSize; i++) {
-                history.AddItem(positionTestFirst);
+            for (unsigned int i = 0; i < AircraftHistoryTrail::maxSize; i++) {
+                repository.AddPosition("test", positionTestFirst);
             }
 
             // Add a second value to test with
-            history.AddItem(positionTestSecond);
-            std::deque<EuroScopePlugIn::CPosition> trail = history.GetTrail();
+            repository.AddPosition("test", positionTestSecond);
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
 
             // Check the trail.
-            EXPECT_EQ(history.maxSize, trail.size());
+            EXPECT_EQ(AircraftHistoryTrail::maxSize, trail.Size());
 
             // First item
-            EXPECT_EQ(3, trail.front().m_Latitude);
-            EXPECT_EQ(4, trail.front().m_Longitude);
+            EXPECT_EQ(3, trail.GetPosition(0).m_Latitude);
+            EXPECT_EQ(4, trail.GetPosition(0).m_Longitude);
+
+            // Oldest item
+            EXPECT_EQ(1, trail.GetPosition(AircraftHistoryTrail::maxSize - 1).m_Latitude);
+            EXPECT_EQ(2, trail.GetPosition(AircraftHistoryTrail::maxSize - 1).m_Longitude);
+        }
+
+        TEST(HistoryTrail, AddItemKeepsOrderWhenTheRingWrapsAround)
+        {
+            HistoryTrailRepository repository(1);
+
+            EuroScopePlugIn::CPosition position;
+            for (unsigned int i = 0; i < AircraftHistoryTrail::maxSize + 10; i++) {
+                position.m_Latitude = i;
+                position.m_Longitude = i * 2;
+                repository.AddPosition("test", position);
+            }
+
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
+            for (unsigned int age = 0; age < AircraftHistoryTrail::maxSize; age++) {
+                EXPECT_EQ(AircraftHistoryTrail::maxSize + 9 - age, trail.GetLatitude(age));
+                EXPECT_EQ((AircraftHistoryTrail::maxSize + 9 - age) * 2, trail.GetLongitude(age));
+            }
+        }
+
+        TEST(HistoryTrail, CopyPositionsCopiesNewestFirst)
+        {
+            HistoryTrailRepository repository(1);
+
+            EuroScopePlugIn::CPosition position;
+            for (unsigned int i = 0; i < 5; i++) {
+                position.m_Latitude = i;
+                position.m_Longitude = i * 2;
+                repository.AddPosition("test", position);
+            }
+
+            double latitudes[AircraftHistoryTrail::maxSize];
+            double longitudes[AircraftHistoryTrail::maxSize];
+            EXPECT_EQ(3, repository.GetAircraft("test").CopyPositions(latitudes, longitudes, 3));
+            EXPECT_EQ(4, latitudes[0]);
+            EXPECT_EQ(3, latitudes[1]);
+            EXPECT_EQ(2, latitudes[2]);
+            EXPECT_EQ(8, longitudes[0]);
+            EXPECT_EQ(4, longitudes[2]);
+        }
+
+        TEST(HistoryTrail, CopyPositionsOnlyCopiesWhatIsInTheTrail)
+        {
+            HistoryTrailRepository repository(1);
+
+            EuroScopePlugIn::CPosition position;
+            position.m_Latitude = 1;
+            position.m_Longitude = 2;
+            repository.AddPosition("test", position);
+
+            double latitudes[AircraftHistoryTrail::maxSize];
+            double longitudes[AircraftHistoryTrail::maxSize];
+            EXPECT_EQ(
+                1,
+                repository.GetAircraft("test").CopyPositions(latitudes, longitudes, AircraftHistoryTrail::maxSize)
+            );
+            EXPECT_EQ(1, latitudes[0]);
+            EXPECT_EQ(2, longitudes[0]);
+        }
+
+        TEST(HistoryTrail, CopyPositionsUnwrapsTheRing)
+        {
+            HistoryTrailRepository repository(1);
+
+            EuroScopePlugIn::CPosition position;
+            for (unsigned int i = 0; i < AircraftHistoryTrail::maxSize + 10; i++) {
+                position.m_Latitude = i;
+                position.m_Longitude = i * 2;
+                repository.AddPosition("test", position);
+            }
+
+            double latitudes[AircraftHistoryTrail::maxSize];
+            double longitudes[AircraftHistoryTrail::maxSize];
+            AircraftHistoryTrail trail = repository.GetAircraft("test");
+            EXPECT_EQ(
+                AircraftHistoryTrail::maxSize,
+                trail.CopyPositions(latitudes, longitudes, AircraftHistoryTrail::maxSize)
+            );
+            for (unsigned int age = 0; age < AircraftHistoryTrail::maxSize; age++) {
+                EXPECT_EQ(trail.GetLatitude(age), latitudes[age]);
+                EXPECT_EQ(trail.GetLongitude(age), longitudes[age]);
+            }
         }
     }  // namespace HistoryTrail
 }  // namespace UKControllerPluginTest
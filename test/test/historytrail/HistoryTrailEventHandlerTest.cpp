@@ -17,7 +17,7 @@ namespace UKControllerPluginTest {
          {
              StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
              EXPECT_CALL(radarTarget, GetCallsign())
-                 .Times(3)
+                 .Times(1)
                  .WillRepeatedly(Return("Test"));
 
              EXPECT_CALL(radarTarget, GetPosition())
@@ -35,7 +35,7 @@ namespace UKControllerPluginTest {
          {
              StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
              EXPECT_CALL(radarTarget, GetCallsign())
-                 .Times(5)
+                 .Times(2)
                  .WillRepeatedly(Return("Test"));
 
              EXPECT_CALL(radarTarget, GetPosition())
@@ -47,13 +47,15 @@ namespace UKControllerPluginTest {
 
              handler.RadarTargetPositionUpdateEvent(radarTarget);
              handler.RadarTargetPositionUpdateEvent(radarTarget);
+             EXPECT_EQ(1, repo.CountAircraft());
+             EXPECT_EQ(2, repo.GetAircraft("Test").Size());
          }
 
          TEST(HistoryTrailEventHandler, OnFlightplanDisconnectRemovesAircraft)
          {
              StrictMock<MockEuroScopeCRadarTargetInterface> radarTarget;
              EXPECT_CALL(radarTarget, GetCallsign())
-                 .Times(3)
+                 .Times(1)
                  .WillRepeatedly(Return("Test"));
 
              EXPECT_CALL(radarTarget, GetPosition())
@@ -152,6 +152,64 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(color.GetB(), 20);
         }
 
+        TEST_F(HistoryTrailRendererTest, AsrLoadedEventBuildsFadingDotColours)
+        {
+            EXPECT_CALL(mockUserSettingProvider, GetKey(_))
+                .WillRepeatedly(Return(""));
+
+            renderer.AsrLoadedEvent(userSetting);
+            EXPECT_EQ(Gdiplus::Color::MakeARGB(255, 255, 130, 20), renderer.GetDotColour(0));
+            EXPECT_EQ(Gdiplus::Color::MakeARGB(255, 255, 130, 20), renderer.GetDotColour(1));
+            EXPECT_EQ(
+                Gdiplus::Color::MakeARGB(255 - renderer.GetAlphaPerDot(), 255, 130, 20),
+                renderer.GetDotColour(2)
+            );
+            EXPECT_EQ(
+                Gdiplus::Color::MakeARGB(255 - 14 * renderer.GetAlphaPerDot(), 255, 130, 20),
+                renderer.GetDotColour(15)
+            );
+            EXPECT_THROW(renderer.GetDotColour(16), std::out_of_range);
+        }
+
+        TEST_F(HistoryTrailRendererTest, AsrLoadedEventBuildsFixedDotColoursIfNotFading)
+        {
+            EXPECT_CALL(mockUserSettingProvider, GetKey(_))
+                .WillRepeatedly(Return(""));
+
+            EXPECT_CALL(mockUserSettingProvider, GetKey(renderer.fadingUserSettingKey))
+                .Times(1)
+                .WillOnce(Return("0"));
+
+            renderer.AsrLoadedEvent(userSetting);
+            EXPECT_EQ(Gdiplus::Color::MakeARGB(255, 255, 130, 20), renderer.GetDotColour(0));
+            EXPECT_EQ(Gdiplus::Color::MakeARGB(255, 255, 130, 20), renderer.GetDotColour(15));
+        }
+
+        TEST_F(HistoryTrailRendererTest, AsrLoadedEventBuildsDegradingDotSizes)
+        {
+            EXPECT_CALL(mockUserSettingProvider, GetKey(_))
+                .WillRepeatedly(Return(""));
+
+            renderer.AsrLoadedEvent(userSetting);
+            float reducePerDot = (4.0f / 15) / 2;
+            EXPECT_FLOAT_EQ(4.0f - reducePerDot, renderer.GetDotSize(0));
+            EXPECT_FLOAT_EQ(4.0f - 16 * reducePerDot, renderer.GetDotSize(15));
+        }
+
+        TEST_F(HistoryTrailRendererTest, AsrLoadedEventBuildsFixedDotSizesIfNotDegrading)
+        {
+            EXPECT_CALL(mockUserSettingProvider, GetKey(_))
+                .WillRepeatedly(Return(""));
+
+            EXPECT_CALL(mockUserSettingProvider, GetKey(renderer.degradingUserSettingKey))
+                .Times(1)
+                .WillOnce(Return("0"));
+
+            renderer.AsrLoadedEvent(userSetting);
+            EXPECT_FLOAT_EQ(4.0f, renderer.GetDotSize(0));
+            EXPECT_FLOAT_EQ(4.0f, renderer.GetDotSize(15));
+        }
+
         TEST_F(HistoryTrailRendererTest, AsrLoadedEventSetsMinAltitudeNoSetting)
         {
             EXPECT_CALL(mockUserSettingProvider, GetKey(_))
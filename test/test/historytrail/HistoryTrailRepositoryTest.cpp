@@ -12,6 +12,19 @@ namespace HistoryTrail {
     class HistoryTrailRepositoryTest : public Test
     {
         public:
+            HistoryTrailRepositoryTest()
+                : repository(2)
+            {
+            }
+
+            EuroScopePlugIn::CPosition MakePosition(double latitude, double longitude)
+            {
+                EuroScopePlugIn::CPosition position;
+                position.m_Latitude = latitude;
+                position.m_Longitude = longitude;
+                return position;
+            }
+
             HistoryTrailRepository repository;
     };
 
@@ -22,22 +35,97 @@ namespace HistoryTrail {
 
     TEST_F(HistoryTrailRepositoryTest, ItCanRegisterAnAircraft)
     {
-        repository.RegisterAircraft(std::make_shared<AircraftHistoryTrail>("test"));
+        repository.RegisterAircraft("test");
         EXPECT_TRUE(repository.HasAircraft("test"));
+        EXPECT_EQ(1, repository.CountAircraft());
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, ItDoesntRegisterAnAircraftTwice)
+    {
+        repository.RegisterAircraft("test");
+        repository.RegisterAircraft("test");
+        EXPECT_EQ(1, repository.CountAircraft());
     }
 
     TEST_F(HistoryTrailRepositoryTest, ItCanUnregisterAnAircraft)
     {
-        repository.RegisterAircraft(std::make_shared<AircraftHistoryTrail>("test"));
+        repository.RegisterAircraft("test");
         repository.UnregisterAircraft("test");
         EXPECT_FALSE(repository.HasAircraft("test"));
+        EXPECT_EQ(0, repository.CountAircraft());
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, UnregisteringAnUnknownAircraftDoesNothing)
+    {
+        repository.RegisterAircraft("test");
+        repository.UnregisterAircraft("test2");
+        EXPECT_EQ(1, repository.CountAircraft());
     }
 
     TEST_F(HistoryTrailRepositoryTest, ItCanReturnAircraft)
     {
-        std::shared_ptr<AircraftHistoryTrail> trail = std::make_shared<AircraftHistoryTrail>("test");
-        repository.RegisterAircraft(trail);
-        EXPECT_EQ(trail, repository.GetAircraft("test"));
+        repository.RegisterAircraft("test");
+        EXPECT_EQ("test", repository.GetAircraft("test").GetCallsign());
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, ItThrowsIfAircraftNotKnown)
+    {
+        EXPECT_THROW(repository.GetAircraft("test"), std::invalid_argument);
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, AddingAPositionRegistersTheAircraft)
+    {
+        repository.AddPosition("test", this->MakePosition(1, 2));
+        EXPECT_TRUE(repository.HasAircraft("test"));
+        EXPECT_EQ(1, repository.GetAircraft("test").Size());
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, ItReturnsTrailsBySlot)
+    {
+        repository.AddPosition("test", this->MakePosition(1, 2));
+        repository.AddPosition("test2", this->MakePosition(3, 4));
+        EXPECT_EQ("test", repository.GetTrail(0).GetCallsign());
+        EXPECT_EQ("test2", repository.GetTrail(1).GetCallsign());
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, UnregisteringKeepsTheOtherTrailsIntact)
+    {
+        repository.AddPosition("test", this->MakePosition(1, 2));
+        repository.AddPosition("test2", this->MakePosition(3, 4));
+        repository.AddPosition("test2", this->MakePosition(5, 6));
+        repository.UnregisterAircraft("test");
+
+        AircraftHistoryTrail trail = repository.GetTrail(0);
+        EXPECT_EQ("test2", trail.GetCallsign());
+        EXPECT_EQ(2, trail.Size());
+        EXPECT_EQ(5, trail.GetLatitude(0));
+        EXPECT_EQ(6, trail.GetLongitude(0));
+        EXPECT_EQ(3, trail.GetLatitude(1));
+        EXPECT_EQ(4, trail.GetLongitude(1));
+        EXPECT_EQ("test2", repository.GetAircraft("test2").GetCallsign());
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, ItGrowsWhenFull)
+    {
+        repository.AddPosition("test", this->MakePosition(1, 2));
+        repository.AddPosition("test2", this->MakePosition(3, 4));
+        repository.AddPosition("test3", this->MakePosition(5, 6));
+
+        EXPECT_EQ(4, repository.GetCapacity());
+        EXPECT_EQ(3, repository.CountAircraft());
+        EXPECT_EQ(1, repository.GetAircraft("test").GetLatitude(0));
+        EXPECT_EQ(5, repository.GetAircraft("test3").GetLatitude(0));
+    }
+
+    TEST_F(HistoryTrailRepositoryTest, ItReusesSlotsAfterUnregistering)
+    {
+        repository.AddPosition("test", this->MakePosition(1, 2));
+        repository.AddPosition("test2", this->MakePosition(3, 4));
+        repository.UnregisterAircraft("test");
+        repository.AddPosition("test3", this->MakePosition(5, 6));
+
+        EXPECT_EQ(2, repository.GetCapacity());
+        EXPECT_EQ(1, repository.GetAircraft("test3").Size());
     }
 }  // namespace HistoryTrail
 }  // namespace UKControllerPluginTest
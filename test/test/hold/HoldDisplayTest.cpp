@@ -16,6 +16,7 @@
 #include "hold/HoldingAircraft.h"
 #include "hold/CompareHoldingAircraft.h"
 #include "hold/HoldingData.h"
+#include "hold/HoldingSnapshot.h"
 #include "hold/PublishedHoldCollection.h"
 #include "hold/DeemedSeparatedHold.h"
 
@@ -26,6 +27,7 @@ using UKControllerPlugin::Hold::HoldManager;
 using UKControllerPlugin::Hold::CompareHoldingAircraft;
 using UKControllerPlugin::Hold::HoldingAircraft;
 using UKControllerPlugin::Hold::HoldingData;
+using UKControllerPlugin::Hold::HoldingSnapshot;
 using UKControllerPlugin::Hold::PublishedHoldCollection;
 using UKControllerPlugin::Euroscope::UserSetting;
 using UKControllerPlugin::Dialog::DialogData;
@@ -53,8 +55,8 @@ namespace UKControllerPluginTest {
                 HoldDisplayTest()
                     : dialogManager(mockDialogProvider),
                       userSetting(mockUserSettingProvider), navaid({ 2, "TIMBA", EuroScopePlugIn::CPosition()}),
-                      holdManager(mockApi, mockTaskRunner),
-                      display(mockPlugin, holdManager, navaid, publishedHolds, dialogManager)
+                      holdManager(mockApi, mockTaskRunner), holdingSnapshot(holdManager, mockPlugin),
+                      display(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot)
                 {
                     this->dialogManager.AddDialog(this->holdDialogData);
                     this->navaid.coordinates.LoadFromStrings("E000.15.42.000", "N050.56.44.000");
@@ -82,6 +84,7 @@ namespace UKControllerPluginTest {
                 UserSetting userSetting;
                 Navaid navaid;
                 HoldManager holdManager;
+                HoldingSnapshot holdingSnapshot;
                 HoldDisplay display;
         };
 
@@ -116,7 +119,7 @@ namespace UKControllerPluginTest {
         {
             this->publishedHolds.Add({1, "TIMBA", "TIMBA", 2000, 3000});
 
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             ON_CALL(this->mockUserSettingProvider, GetKey("holdTIMBAMinLevel"))
                 .WillByDefault(Return(""));
 
@@ -145,7 +148,7 @@ namespace UKControllerPluginTest {
         TEST_F(HoldDisplayTest, ItLoadsMaximumLevelFromPublishedHoldIfNotInAsr)
         {
             this->publishedHolds.Add({1, "TIMBA", "TIMBA", 2000, 3000});
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             ON_CALL(this->mockUserSettingProvider, GetKey("holdTIMBAMaxLevel"))
                 .WillByDefault(Return(""));
 
@@ -763,7 +766,7 @@ namespace UKControllerPluginTest {
                     15000,
                 }
             );
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             display2.SetMinimumLevel(7000);
             display2.SetMaximumLevel(15000);
 
@@ -841,7 +844,7 @@ namespace UKControllerPluginTest {
                     15000,
                 }
             );
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             display2.SetMinimumLevel(7000);
             display2.SetMaximumLevel(15000);
 
@@ -920,7 +923,7 @@ namespace UKControllerPluginTest {
                     15000,
                 }
             );
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             display2.SetMinimumLevel(7000);
             display2.SetMaximumLevel(15000);
 
@@ -999,7 +1002,7 @@ namespace UKControllerPluginTest {
                     15000,
                 }
             );
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             display2.SetMinimumLevel(7000);
             display2.SetMaximumLevel(15000);
 
@@ -1086,7 +1089,7 @@ namespace UKControllerPluginTest {
                     15000,
                 }
             );
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             display2.SetMinimumLevel(7000);
             display2.SetMaximumLevel(15000);
 
@@ -1166,7 +1169,7 @@ namespace UKControllerPluginTest {
                     15000,
                 }
             );
-            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager);
+            HoldDisplay display2(mockPlugin, holdManager, navaid, publishedHolds, dialogManager, holdingSnapshot);
             display2.SetMinimumLevel(7000);
             display2.SetMaximumLevel(15000);
 
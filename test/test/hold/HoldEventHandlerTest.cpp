@@ -17,6 +17,7 @@
 
 using UKControllerPlugin::Tag::TagData;
 using UKControllerPlugin::Navaids::NavaidCollection;
+using UKControllerPlugin::Hold::HoldingAircraft;
 using UKControllerPlugin::Hold::HoldingData;
 using UKControllerPlugin::Hold::HoldManager;
 using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
@@ -79,7 +80,7 @@ namespace UKControllerPluginTest {
                     this->manager.AssignAircraftToHold("BAW123", "TIMBA", false);
                 }
 
-                void CreateFlightplanRadarTargetPair(
+                std::shared_ptr<NiceMock<MockEuroScopeCRadarTargetInterface>> CreateFlightplanRadarTargetPair(
                     std::string callsign,
                     EuroScopePlugIn::CPosition position
                 ) {
@@ -96,6 +97,7 @@ namespace UKControllerPluginTest {
                         .WillByDefault(Return(position));
 
                     this->mockPlugin.AddAllFlightplansItem({ flightplan, radarTarget });
+                    return radarTarget;
                 }
 
                 double fontSize = 24.1;
@@ -420,5 +422,82 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(0, this->manager.GetAircraftForHold("MAY").size());
             EXPECT_EQ(expectedProximityHolds, this->manager.GetHoldingAircraft("RYR123")->GetProximityHolds());
         }
+
+        TEST_F(HoldEventHandlerTest, TimedEventLeavesProximityHoldsAloneIfAircraftStaysNearby)
+        {
+            // Aircraft is at SAM
+            this->CreateFlightplanRadarTargetPair(
+                "RYR123",
+                ParseSectorFileCoordinates("N050.57.18.900", "W001.20.42.200")
+            );
+
+            EXPECT_CALL(this->mockPlugin, MarkFlightplanDirty("RYR123"))
+                .Times(1);
+
+            this->handler.TimedEventTrigger();
+            std::shared_ptr<HoldingAircraft> aircraft = this->manager.GetHoldingAircraft("RYR123");
+            this->handler.TimedEventTrigger();
+
+            EXPECT_EQ(aircraft, this->manager.GetHoldingAircraft("RYR123"));
+            EXPECT_EQ(std::set<std::string>({ "SAM" }), aircraft->GetProximityHolds());
+            EXPECT_EQ(1, this->manager.GetAircraftForHold("SAM").size());
+        }
+
+        TEST_F(HoldEventHandlerTest, TimedEventMovesProximityHoldsAsAircraftFlies)
+        {
+            // Aircraft starts at SAM
+            std::shared_ptr<NiceMock<MockEuroScopeCRadarTargetInterface>> radarTarget =
+                this->CreateFlightplanRadarTargetPair(
+                    "RYR123",
+                    ParseSectorFileCoordinates("N050.57.18.900", "W001.20.42.200")
+                );
+
+            EXPECT_CALL(this->mockPlugin, MarkFlightplanDirty("RYR123"))
+                .Times(2);
+
+            this->handler.TimedEventTrigger();
+
+            // Then flies to OLEVI
+            ON_CALL(*radarTarget, GetPosition())
+                .WillByDefault(Return(ParseSectorFileCoordinates("N051.11.17.400", "E000.06.11.300")));
+            this->handler.TimedEventTrigger();
+
+            std::set<std::string> expectedProximityHolds({ "MAY", "OLEVI" });
+            EXPECT_EQ(0, this->manager.GetAircraftForHold("SAM").size());
+            EXPECT_EQ(expectedProximityHolds, this->manager.GetHoldingAircraft("RYR123")->GetProximityHolds());
+        }
+
+        TEST_F(HoldEventHandlerTest, TimedEventDoesNotMarkFlightplansDirtyIfNotNearAnyHold)
+        {
+            this->CreateFlightplanRadarTargetPair(
+                "RYR123",
+                ParseSectorFileCoordinates("N055.00.00.000", "W004.00.00.000")
+            );
+
+            EXPECT_CALL(this->mockPlugin, MarkFlightplanDirty(_))
+                .Times(0);
+
+            this->handler.TimedEventTrigger();
+            EXPECT_EQ(this->manager.invalidAircraft, this->manager.GetHoldingAircraft("RYR123"));
+        }
+
+        TEST_F(HoldEventHandlerTest, TimedEventRemovesAircraftFromManagerWhenItLeavesAllHolds)
+        {
+            // Aircraft starts at SAM
+            std::shared_ptr<NiceMock<MockEuroScopeCRadarTargetInterface>> radarTarget =
+                this->CreateFlightplanRadarTargetPair(
+                    "RYR123",
+                    ParseSectorFileCoordinates("N050.57.18.900", "W001.20.42.200")
+                );
+            this->handler.TimedEventTrigger();
+
+            // Then flies off somewhere far away
+            ON_CALL(*radarTarget, GetPosition())
+                .WillByDefault(Return(ParseSectorFileCoordinates("N055.00.00.000", "W004.00.00.000")));
+            this->handler.TimedEventTrigger();
+
+            EXPECT_EQ(0, this->manager.GetAircraftForHold("SAM").size());
+            EXPECT_EQ(this->manager.invalidAircraft, this->manager.GetHoldingAircraft("RYR123"));
+        }
     }  // namespace Hold
 }  // namespace UKControllerPluginTest
@@ -152,6 +152,16 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(0, this->manager.GetAircraftForHold("LAM").size());
         }
 
+        TEST_F(HoldManagerTest, GetAllHoldingAircraftReturnsAssignedAndProximityAircraft)
+        {
+            this->manager.AddAircraftToProximityHold("BAW123", "WILLO");
+            this->manager.AddAircraftToProximityHold("EZY234", "WILLO");
+
+            EXPECT_EQ(2, this->manager.GetAllHoldingAircraft().size());
+            EXPECT_EQ(1, this->manager.GetAllHoldingAircraft().count("BAW123"));
+            EXPECT_EQ(1, this->manager.GetAllHoldingAircraft().count("EZY234"));
+        }
+
         TEST_F(HoldManagerTest, UnassigningAircraftFromHoldHandlesIfNotHolding)
         {
             EXPECT_CALL(this->mockApi, UnassignAircraftHold(_))
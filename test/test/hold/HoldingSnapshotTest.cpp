@@ -0,0 +1,137 @@
+#include "pch/pch.h"
+#include "hold/HoldingSnapshot.h"
+#include "hold/HoldManager.h"
+#include "hold/HoldingAircraft.h"
+#include "mock/MockApiInterface.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+#include "mock/MockEuroScopeCFlightplanInterface.h"
+#include "mock/MockEuroScopeCRadarTargetInterface.h"
+#include "mock/MockTaskRunnerInterface.h"
+
+using UKControllerPlugin::Hold::HoldingAircraftSnapshot;
+using UKControllerPlugin::Hold::HoldingSnapshot;
+using UKControllerPlugin::Hold::HoldManager;
+using UKControllerPluginTest::Api::MockApiInterface;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
+using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
+using UKControllerPluginTest::TaskManager::MockTaskRunnerInterface;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Hold {
+
+        class HoldingSnapshotTest : public Test
+        {
+            public:
+                HoldingSnapshotTest()
+                    : holdManager(mockApi, mockTaskRunner), snapshot(holdManager, mockPlugin)
+                {
+                    this->position.m_Latitude = 51.06722;
+                    this->position.m_Longitude = 0.43944;
+
+                    ON_CALL(*this->radarTarget, GetPosition())
+                        .WillByDefault(Return(this->position));
+                    ON_CALL(*this->radarTarget, GetFlightLevel())
+                        .WillByDefault(Return(8100));
+                    ON_CALL(*this->radarTarget, GetVerticalSpeed())
+                        .WillByDefault(Return(-400));
+                    ON_CALL(*this->flightplan, GetClearedAltitude())
+                        .WillByDefault(Return(8000));
+
+                    ON_CALL(this->mockPlugin, GetRadarTargetForCallsign("BAW123"))
+                        .WillByDefault(Return(this->radarTarget));
+                    ON_CALL(this->mockPlugin, GetFlightplanForCallsign("BAW123"))
+                        .WillByDefault(Return(this->flightplan));
+                    ON_CALL(this->mockPlugin, GetRadarTargetForCallsign("EZY234"))
+                        .WillByDefault(Return(this->radarTarget));
+
+                    this->holdManager.AssignAircraftToHold("BAW123", "TIMBA", false);
+                }
+
+                EuroScopePlugIn::CPosition position;
+                std::shared_ptr<NiceMock<MockEuroScopeCRadarTargetInterface>> radarTarget =
+                    std::make_shared<NiceMock<MockEuroScopeCRadarTargetInterface>>();
+                std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>> flightplan =
+                    std::make_shared<NiceMock<MockEuroScopeCFlightPlanInterface>>();
+                NiceMock<MockApiInterface> mockApi;
+                NiceMock<MockTaskRunnerInterface> mockTaskRunner;
+                NiceMock<MockEuroscopePluginLoopbackInterface> mockPlugin;
+                HoldManager holdManager;
+                HoldingSnapshot snapshot;
+        };
+
+        TEST_F(HoldingSnapshotTest, ItStartsEmpty)
+        {
+            EXPECT_EQ(0, this->snapshot.Count());
+            EXPECT_EQ(nullptr, this->snapshot.GetAircraft("BAW123"));
+        }
+
+        TEST_F(HoldingSnapshotTest, ItTakesTheRadarTargetAndFlightplanOfHoldingAircraft)
+        {
+            this->snapshot.Refresh();
+
+            const HoldingAircraftSnapshot * aircraft = this->snapshot.GetAircraft("BAW123");
+            ASSERT_NE(nullptr, aircraft);
+            EXPECT_EQ(1, this->snapshot.Count());
+            EXPECT_EQ(this->position.m_Latitude, aircraft->position.m_Latitude);
+            EXPECT_EQ(this->position.m_Longitude, aircraft->position.m_Longitude);
+            EXPECT_EQ(8100, aircraft->flightLevel);
+            EXPECT_EQ(-400, aircraft->verticalSpeed);
+            EXPECT_TRUE(aircraft->hasFlightplan);
+            EXPECT_EQ(8000, aircraft->clearedAltitude);
+        }
+
+        TEST_F(HoldingSnapshotTest, ItTakesAircraftWithoutAFlightplan)
+        {
+            this->holdManager.AddAircraftToProximityHold("EZY234", "TIMBA");
+            this->snapshot.Refresh();
+
+            const HoldingAircraftSnapshot * aircraft = this->snapshot.GetAircraft("EZY234");
+            ASSERT_NE(nullptr, aircraft);
+            EXPECT_FALSE(aircraft->hasFlightplan);
+            EXPECT_EQ(0, aircraft->clearedAltitude);
+        }
+
+        TEST_F(HoldingSnapshotTest, ItSkipsAircraftWithoutARadarTarget)
+        {
+            this->holdManager.AddAircraftToProximityHold("VIR25A", "TIMBA");
+            this->snapshot.Refresh();
+
+            EXPECT_EQ(1, this->snapshot.Count());
+            EXPECT_EQ(nullptr, this->snapshot.GetAircraft("VIR25A"));
+        }
+
+        TEST_F(HoldingSnapshotTest, ItRemovesAircraftThatAreNoLongerHolding)
+        {
+            this->snapshot.Refresh();
+            this->holdManager.UnassignAircraftFromHold("BAW123", false);
+            this->snapshot.Refresh();
+
+            EXPECT_EQ(0, this->snapshot.Count());
+            EXPECT_EQ(nullptr, this->snapshot.GetAircraft("BAW123"));
+        }
+
+        TEST_F(HoldingSnapshotTest, ItRemovesAircraftThatLoseTheirRadarTarget)
+        {
+            this->snapshot.Refresh();
+            ON_CALL(this->mockPlugin, GetRadarTargetForCallsign("BAW123"))
+                .WillByDefault(Return(nullptr));
+            this->snapshot.Refresh();
+
+            EXPECT_EQ(nullptr, this->snapshot.GetAircraft("BAW123"));
+        }
+
+        TEST_F(HoldingSnapshotTest, ItUpdatesAircraftOnRefresh)
+        {
+            this->snapshot.Refresh();
+            ON_CALL(*this->radarTarget, GetFlightLevel())
+                .WillByDefault(Return(9000));
+            this->snapshot.Refresh();
+
+            EXPECT_EQ(9000, this->snapshot.GetAircraft("BAW123")->flightLevel);
+        }
+    }  // namespace Hold
+}  // namespace UKControllerPluginTest
@@ -6,6 +6,7 @@ using ::testing::Test;
 using UKControllerPlugin::Hold::PublishedHoldCollection;
 using UKControllerPlugin::Hold::HoldingData;
 using UKControllerPlugin::Hold::CompareHolds;
+using UKControllerPlugin::Hold::DeemedSeparatedHold;
 
 namespace UKControllerPluginTest {
     namespace Hold {
@@ -18,6 +19,26 @@ namespace UKControllerPluginTest {
                 HoldingData hold2 = { 2, "WILLO", "WILLO", 8000, 15000, 209, "left" };
                 HoldingData hold3 = { 3, "WILLO", "WILLO", 8000, 9000, 209, "right" };
                 PublishedHoldCollection collection;
+
+                /*
+                    A hold that is deemed separated from the given hold ids at the given distance
+                */
+                HoldingData MakeDeemedSeparatedHold(
+                    unsigned int identifier,
+                    std::string fix,
+                    unsigned int minimum,
+                    unsigned int maximum,
+                    std::vector<std::pair<unsigned int, unsigned int>> separatedFrom
+                ) {
+                    std::set<std::unique_ptr<DeemedSeparatedHold>> deemedSeparated;
+                    for (const std::pair<unsigned int, unsigned int>& separated : separatedFrom) {
+                        deemedSeparated.insert(
+                            std::make_unique<DeemedSeparatedHold>(separated.first, separated.second)
+                        );
+                    }
+
+                    return { identifier, fix, fix, minimum, maximum, 209, "left", {}, std::move(deemedSeparated) };
+                }
         };
 
         TEST_F(PublishedHoldCollectionTest, ItStartsEmpty)
@@ -90,5 +111,98 @@ namespace UKControllerPluginTest {
 
             EXPECT_EQ(this->collection.noHold, this->collection.GetById(999));
         }
+
+        TEST_F(PublishedHoldCollectionTest, GetByIdReturnsFirstHoldIfDuplicateAdded)
+        {
+            this->collection.Add(std::move(this->hold1));
+            this->collection.Add(std::move(this->hold1Copy));
+
+            EXPECT_EQ(1, this->collection.GetById(1).identifier);
+            EXPECT_EQ("TIMBA", this->collection.GetById(1).fix);
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceReturnsNotSeparatedIfNoHolds)
+        {
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("TIMBA", "WILLO", 8000)
+            );
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceReturnsDistanceWhereHoldsOverlap)
+        {
+            this->collection.Add(this->MakeDeemedSeparatedHold(1, "TIMBA", 7000, 12000, { { 2, 7 } }));
+            this->collection.Add(this->MakeDeemedSeparatedHold(2, "WILLO", 9000, 15000, {}));
+
+            EXPECT_EQ(7, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 9000));
+            EXPECT_EQ(7, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 12000));
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("TIMBA", "WILLO", 8000)
+            );
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("TIMBA", "WILLO", 13000)
+            );
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceOnlyAppliesFromTheHoldThatIsSeparated)
+        {
+            this->collection.Add(this->MakeDeemedSeparatedHold(1, "TIMBA", 7000, 12000, { { 2, 7 } }));
+            this->collection.Add(this->MakeDeemedSeparatedHold(2, "WILLO", 9000, 15000, {}));
+
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("WILLO", "TIMBA", 10000)
+            );
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceHandlesSeparatedHoldBeingAddedFirst)
+        {
+            this->collection.Add(this->MakeDeemedSeparatedHold(2, "WILLO", 9000, 15000, {}));
+            this->collection.Add(this->MakeDeemedSeparatedHold(1, "TIMBA", 7000, 12000, { { 2, 7 } }));
+
+            EXPECT_EQ(7, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 10000));
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceHandlesSeparatedHoldBeingAddedLast)
+        {
+            this->collection.Add(this->MakeDeemedSeparatedHold(1, "TIMBA", 7000, 12000, { { 2, 7 } }));
+            this->collection.Add(this->MakeDeemedSeparatedHold(3, "LAM", 7000, 12000, { { 2, 5 } }));
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("TIMBA", "WILLO", 10000)
+            );
+
+            this->collection.Add(this->MakeDeemedSeparatedHold(2, "WILLO", 9000, 15000, {}));
+            EXPECT_EQ(7, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 10000));
+            EXPECT_EQ(5, this->collection.GetVslInsertDistance("LAM", "WILLO", 10000));
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceReturnsShortestDistanceIfSeveralHoldsApply)
+        {
+            this->collection.Add(this->MakeDeemedSeparatedHold(1, "TIMBA", 7000, 12000, { { 2, 7 }, { 3, 10 } }));
+            this->collection.Add(this->MakeDeemedSeparatedHold(2, "WILLO", 9000, 15000, {}));
+            this->collection.Add(this->MakeDeemedSeparatedHold(3, "WILLO", 7000, 10000, {}));
+
+            EXPECT_EQ(10, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 8000));
+            EXPECT_EQ(7, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 9000));
+            EXPECT_EQ(7, this->collection.GetVslInsertDistance("TIMBA", "WILLO", 11000));
+        }
+
+        TEST_F(PublishedHoldCollectionTest, GetVslInsertDistanceIgnoresHoldsThatDontOverlap)
+        {
+            this->collection.Add(this->MakeDeemedSeparatedHold(1, "TIMBA", 7000, 8000, { { 2, 7 } }));
+            this->collection.Add(this->MakeDeemedSeparatedHold(2, "WILLO", 9000, 15000, {}));
+
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("TIMBA", "WILLO", 8000)
+            );
+            EXPECT_EQ(
+                this->collection.notDeemedSeparated,
+                this->collection.GetVslInsertDistance("TIMBA", "WILLO", 9000)
+            );
+        }
     }  // namespace Hold
 }  // namespace UKControllerPluginTest
@@ -25,6 +25,14 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE("C2" == cache.GetIntentionCodeForAircraft("BAW123"));
         }
 
+        TEST(IntentionCodeCache, GetIntentionCodeForCallsignReturnsTheCachedCodeWithoutCopying)
+        {
+            IntentionCodeCache cache;
+            cache.RegisterAircraft("BAW123", IntentionCodeData("C2", 0, true));
+            EXPECT_EQ(&cache.GetIntentionCodeForAircraft("BAW123"), &cache.GetIntentionCodeForAircraft("BAW123"));
+            EXPECT_EQ(&cache.defaultCode, &cache.GetIntentionCodeForAircraft("EZY123"));
+        }
+
         TEST(IntentionCodeCache, StartsEmpty)
         {
             IntentionCodeCache cache;
@@ -10,6 +10,7 @@
 #include "intention/SectorExitRepositoryFactory.h"
 #include "bootstrap/PersistenceContainer.h"
 #include "tag/TagData.h"
+#include "flightplan/StoredFlightplan.h"
 
 using UKControllerPlugin::Tag::TagData;
 using UKControllerPlugin::IntentionCode::IntentionCodeGenerator;
@@ -22,6 +23,7 @@ using UKControllerPluginTest::Euroscope::MockEuroscopeExtractedRouteInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCControllerInterface;
 using UKControllerPlugin::IntentionCode::SectorExitRepositoryFactory;
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 using ::testing::StrictMock;
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -56,6 +58,15 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE("UKCP Intention Code" == this->handler->GetTagItemDescription(0));
         }
 
+        TEST_F(IntentionCodeEventHandlerTest, ItDependsOnTheAirportsRouteAndCruiseLevel)
+        {
+            EXPECT_EQ(
+                StoredFlightplan::originChanged | StoredFlightplan::destinationChanged |
+                    StoredFlightplan::routeChanged | StoredFlightplan::cruiseLevelChanged,
+                this->handler->GetFlightplanFieldDependencies()
+            );
+        }
+
         TEST_F(IntentionCodeEventHandlerTest, GetTagItemDataGeneratesIntentionCodeIfNonePresent)
         {
             StrictMock<MockEuroscopeExtractedRouteInterface> route;
@@ -77,7 +88,7 @@ namespace UKControllerPluginTest {
                 .WillOnce(Return(ByRef(route)));
 
             EXPECT_CALL(flightplan, GetCallsign())
-                .Times(3)
+                .Times(1)
                 .WillRepeatedly(Return("BAW123"));
 
             EXPECT_CALL(flightplan, GetOrigin())
@@ -117,7 +128,7 @@ namespace UKControllerPluginTest {
                 .WillRepeatedly(Return(ByRef(route)));
 
             EXPECT_CALL(flightplan, GetCallsign())
-                .Times(6)
+                .Times(2)
                 .WillRepeatedly(Return("BAW123"));
 
             EXPECT_CALL(flightplan, GetOrigin())
@@ -160,7 +171,7 @@ namespace UKControllerPluginTest {
                 .WillRepeatedly(Return(ByRef(route)));
 
             EXPECT_CALL(flightplan, GetCallsign())
-                .Times(7)
+                .Times(3)
                 .WillRepeatedly(Return("BAW123"));
 
             EXPECT_CALL(flightplan, GetOrigin())
@@ -204,7 +215,7 @@ namespace UKControllerPluginTest {
                 .WillRepeatedly(Return(ByRef(route)));
 
             EXPECT_CALL(flightplan, GetCallsign())
-                .Times(7)
+                .Times(3)
                 .WillRepeatedly(Return("BAW123"));
 
             EXPECT_CALL(flightplan, GetOrigin())
@@ -132,5 +132,15 @@ namespace UKControllerPluginTest {
         {
             EXPECT_NO_THROW(this->msl.SetMinStackLevel("nope", 8000));
         }
+
+        TEST_F(MinStackManagerTest, ItProcessesTheQnhFromAMetar)
+        {
+            EXPECT_EQ(987, this->msl.ProcessMetar("EGLL 261250Z 24012KT 9999 FEW035 14/07 Q0987 NOSIG"));
+        }
+
+        TEST_F(MinStackManagerTest, ItReturnsZeroIfNoQnhInMetar)
+        {
+            EXPECT_EQ(0, this->msl.ProcessMetar("EGLL 261250Z 24012KT 9999 FEW035 14/07"));
+        }
     }  // namespace MinStack
 }  // namespace UKControllerPluginTest
@@ -2,9 +2,11 @@
 #include "pch/pch.h"
 #include "navaids/Navaid.h"
 #include "navaids/NavaidCollection.h"
+#include "sectorfile/SectorFileCoordinates.h"
 
 using UKControllerPlugin::Navaids::Navaid;
 using UKControllerPlugin::Navaids::NavaidCollection;
+using UKControllerPlugin::SectorFile::ParseSectorFileCoordinates;
 using ::testing::Test;
 
 namespace UKControllerPluginTest {
@@ -18,6 +20,12 @@ namespace UKControllerPluginTest {
                 NavaidCollection collection;
         };
 
+        TEST_F(NavaidCollectionTest, ItCannotBeCopied)
+        {
+            EXPECT_FALSE(std::is_copy_constructible<NavaidCollection>::value);
+            EXPECT_FALSE(std::is_copy_assignable<NavaidCollection>::value);
+        }
+
         TEST_F(NavaidCollectionTest, ItStartsEmpty)
         {
             EXPECT_EQ(0, this->collection.Count());
@@ -50,5 +58,83 @@ namespace UKControllerPluginTest {
             this->collection.AddNavaid(navaid1);
             EXPECT_EQ(this->collection.invalidNavaid, this->collection.GetByIdentifier("WILLO"));
         }
+
+        TEST_F(NavaidCollectionTest, FindWithinDistanceFindsNothingIfNoNavaids)
+        {
+            std::vector<const Navaid *> found;
+            this->collection.FindWithinDistance(
+                ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000"),
+                12.0,
+                found
+            );
+            EXPECT_TRUE(found.empty());
+        }
+
+        TEST_F(NavaidCollectionTest, FindWithinDistanceFindsNearbyNavaids)
+        {
+            this->collection.AddNavaid(
+                { 1, "TIMBA", ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000") }
+            );
+            this->collection.AddNavaid(
+                { 2, "MAY", ParseSectorFileCoordinates("N051.01.02.000", "E000.06.58.000") }
+            );
+            this->collection.AddNavaid(
+                { 3, "SAM", ParseSectorFileCoordinates("N050.57.18.900", "W001.20.42.200") }
+            );
+
+            std::vector<const Navaid *> found;
+            this->collection.FindWithinDistance(
+                ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000"),
+                12.0,
+                found
+            );
+
+            std::set<std::string> foundIdentifiers;
+            for (const Navaid * navaid : found) {
+                foundIdentifiers.insert(navaid->identifier);
+            }
+            EXPECT_EQ(std::set<std::string>({ "MAY", "TIMBA" }), foundIdentifiers);
+        }
+
+        TEST_F(NavaidCollectionTest, FindWithinDistanceFindsNavaidsInNeighbouringCells)
+        {
+            // Either side of the meridian and a grid line of latitude
+            this->collection.AddNavaid(
+                { 1, "WEST", ParseSectorFileCoordinates("N051.00.00.000", "W000.05.00.000") }
+            );
+            this->collection.AddNavaid(
+                { 2, "SOUTH", ParseSectorFileCoordinates("N050.55.00.000", "E000.05.00.000") }
+            );
+
+            std::vector<const Navaid *> found;
+            this->collection.FindWithinDistance(
+                ParseSectorFileCoordinates("N051.00.00.000", "E000.05.00.000"),
+                12.0,
+                found
+            );
+            EXPECT_EQ(2, found.size());
+        }
+
+        TEST_F(NavaidCollectionTest, FindWithinDistanceReplacesPreviousResults)
+        {
+            this->collection.AddNavaid(
+                { 1, "TIMBA", ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000") }
+            );
+
+            std::vector<const Navaid *> found;
+            this->collection.FindWithinDistance(
+                ParseSectorFileCoordinates("N050.56.44.000", "E000.15.42.000"),
+                12.0,
+                found
+            );
+            EXPECT_EQ(1, found.size());
+
+            this->collection.FindWithinDistance(
+                ParseSectorFileCoordinates("N055.00.00.000", "W004.00.00.000"),
+                12.0,
+                found
+            );
+            EXPECT_TRUE(found.empty());
+        }
     }  // namespace Navaids
 }  // namespace UKControllerPluginTest
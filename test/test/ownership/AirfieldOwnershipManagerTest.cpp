@@ -193,6 +193,117 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE("EGGD" == this->manager.GetOwnedAirfields("EGGD_TWR").begin()->GetIcao());
         }
 
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionSetsOwnerOfAffectedAirfields)
+        {
+            this->airfields.AddAirfield(std::make_unique<AirfieldModel>(
+                "EGFF",
+                std::vector<std::string>({ "EGFF_TWR", "EGFF_APP", "LON_W_CTR" })
+            ));
+            ControllerPosition controller("EGGD_APP", 125.650, "APP", { "EGGD" });
+            ActiveCallsign active("EGGD_APP", "Testy McTestface", controller);
+            this->activeCallsigns.AddCallsign(active);
+
+            this->manager.RefreshOwnersForPosition(controller);
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active));
+            EXPECT_FALSE(this->manager.AirfieldHasOwner("EGFF"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionSetsOwnerOfEveryAirfieldPositionCovers)
+        {
+            this->airfields.AddAirfield(std::make_unique<AirfieldModel>(
+                "EGFF",
+                std::vector<std::string>({ "EGFF_TWR", "EGFF_APP", "LON_W_CTR" })
+            ));
+            ControllerPosition controller("LON_W_CTR", 126.020, "CTR", { "EGGD", "EGFF" });
+            ActiveCallsign active("LON_W_CTR", "Testy McTestface", controller);
+            this->activeCallsigns.AddCallsign(active);
+
+            this->manager.RefreshOwnersForPosition(controller);
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active));
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGFF", active));
+            EXPECT_EQ(2, this->manager.GetOwnedAirfields("LON_W_CTR").size());
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionHandsOwnershipBackOnLogoff)
+        {
+            ControllerPosition controller1("EGGD_APP", 125.650, "APP", { "EGGD" });
+            ActiveCallsign active1("EGGD_APP", "Testy McTestface", controller1);
+            ControllerPosition controller2("EGGD_TWR", 133.850, "TWR", { "EGGD" });
+            ActiveCallsign active2("EGGD_TWR", "Testy McTestface 2", controller2);
+
+            this->activeCallsigns.AddCallsign(active1);
+            this->manager.RefreshOwnersForPosition(controller1);
+            this->activeCallsigns.AddCallsign(active2);
+            this->manager.RefreshOwnersForPosition(controller2);
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active2));
+            EXPECT_EQ(0, this->manager.GetOwnedAirfields("EGGD_APP").size());
+
+            this->activeCallsigns.RemoveCallsign(active2);
+            this->manager.RefreshOwnersForPosition(controller2);
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active1));
+            EXPECT_EQ(1, this->manager.GetOwnedAirfields("EGGD_APP").size());
+
+            this->activeCallsigns.RemoveCallsign(active1);
+            this->manager.RefreshOwnersForPosition(controller1);
+            EXPECT_FALSE(this->manager.AirfieldHasOwner("EGGD"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionHandlesSeveralControllersOnAPosition)
+        {
+            ControllerPosition controller("EGGD_APP", 125.650, "APP", { "EGGD" });
+            ActiveCallsign active1("EGGD_APP", "Testy McTestface", controller);
+            ActiveCallsign active2("EGGD_1_APP", "Testy McTestface 2", controller);
+
+            this->activeCallsigns.AddCallsign(active1);
+            this->manager.RefreshOwnersForPosition(controller);
+            this->activeCallsigns.AddCallsign(active2);
+            this->manager.RefreshOwnersForPosition(controller);
+            this->activeCallsigns.RemoveCallsign(active1);
+            this->manager.RefreshOwnersForPosition(controller);
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active2));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionIgnoresPositionsNotInAnyOwnershipOrder)
+        {
+            ControllerPosition controller("EGKK_APP", 126.825, "APP", { "EGKK" });
+            this->activeCallsigns.AddCallsign(ActiveCallsign("EGKK_APP", "Testy McTestface", controller));
+
+            EXPECT_NO_THROW(this->manager.RefreshOwnersForPosition(controller));
+            EXPECT_FALSE(this->manager.AirfieldHasOwner("EGGD"));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, RefreshOwnersForPositionPicksUpAirfieldsAddedLater)
+        {
+            ControllerPosition controller("EGFF_APP", 125.850, "APP", { "EGGD", "EGFF" });
+            ActiveCallsign active("EGFF_APP", "Testy McTestface", controller);
+            this->activeCallsigns.AddCallsign(active);
+            this->manager.RefreshOwnersForPosition(controller);
+
+            this->airfields.AddAirfield(std::make_unique<AirfieldModel>(
+                "EGFF",
+                std::vector<std::string>({ "EGFF_TWR", "EGFF_APP", "LON_W_CTR" })
+            ));
+            this->manager.RefreshOwnersForPosition(controller);
+
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGGD", active));
+            EXPECT_TRUE(this->manager.AirfieldOwnedBy("EGFF", active));
+        }
+
+        TEST_F(AirfieldOwnershipManagerTest, FlushClearsOwnedAirfields)
+        {
+            ControllerPosition controller("EGGD_APP", 125.650, "APP", { "EGGD" });
+            ActiveCallsign active("EGGD_APP", "Testy McTestface", controller);
+            this->activeCallsigns.AddCallsign(active);
+            this->manager.RefreshOwnersForPosition(controller);
+
+            this->manager.Flush();
+
+            EXPECT_EQ(0, this->manager.GetOwnedAirfields("EGGD_APP").size());
+        }
+
         TEST_F(AirfieldOwnershipManagerTest, ItHasANoOwnerObject)
         {
             EXPECT_TRUE("" == this->manager.notFoundCallsign.GetCallsign());
@@ -0,0 +1,74 @@
+#include "pch/pch.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "performance/HandlerMetrics.h"
+
+using UKControllerPlugin::Performance::HandlerMetrics;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Performance {
+
+        class HandlerMetricsCollectionTest : public Test
+        {
+            public:
+                HandlerMetricsCollection collection;
+        };
+
+        TEST_F(HandlerMetricsCollectionTest, ItStartsEmpty)
+        {
+            EXPECT_EQ(0, this->collection.CountMetrics());
+        }
+
+        TEST_F(HandlerMetricsCollectionTest, ItRegistersMetrics)
+        {
+            std::shared_ptr<HandlerMetrics> metrics = this->collection.Register("test");
+            EXPECT_EQ(1, this->collection.CountMetrics());
+            EXPECT_EQ("test", metrics->GetName());
+            EXPECT_EQ(metrics, this->collection.GetMetrics("test"));
+        }
+
+        TEST_F(HandlerMetricsCollectionTest, ItReturnsExistingMetricsWithTheSameName)
+        {
+            std::shared_ptr<HandlerMetrics> metrics = this->collection.Register("test");
+            EXPECT_EQ(metrics, this->collection.Register("test"));
+            EXPECT_EQ(1, this->collection.CountMetrics());
+        }
+
+        TEST_F(HandlerMetricsCollectionTest, ItReturnsNullptrForUnknownMetrics)
+        {
+            EXPECT_EQ(nullptr, this->collection.GetMetrics("test"));
+        }
+
+        TEST_F(HandlerMetricsCollectionTest, ItSortsMetricsByTotalTime)
+        {
+            this->collection.Register("fast")->Record(std::chrono::microseconds(1));
+            this->collection.Register("slow")->Record(std::chrono::microseconds(100));
+            this->collection.Register("medium")->Record(std::chrono::microseconds(10));
+
+            std::vector<std::shared_ptr<const HandlerMetrics>> sorted = this->collection.GetMetricsByTotalTime();
+            ASSERT_EQ(3, sorted.size());
+            EXPECT_EQ("slow", sorted[0]->GetName());
+            EXPECT_EQ("medium", sorted[1]->GetName());
+            EXPECT_EQ("fast", sorted[2]->GetName());
+        }
+
+        TEST_F(HandlerMetricsCollectionTest, ItResetsAllMetrics)
+        {
+            this->collection.Register("one")->Record(std::chrono::microseconds(1));
+            this->collection.Register("two")->Record(std::chrono::microseconds(1));
+            this->collection.Reset();
+
+            EXPECT_EQ(0, this->collection.GetMetrics("one")->CountCalls());
+            EXPECT_EQ(0, this->collection.GetMetrics("two")->CountCalls());
+        }
+
+        TEST_F(HandlerMetricsCollectionTest, ItMakesHandlerNamesReadable)
+        {
+            std::string name = HandlerMetricsCollection::NameFromType(typeid(HandlerMetricsCollection));
+            EXPECT_NE(std::string::npos, name.find("HandlerMetricsCollection"));
+            EXPECT_EQ(std::string::npos, name.find("class "));
+            EXPECT_NE(0, name.find("UKControllerPlugin::"));
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPluginTest
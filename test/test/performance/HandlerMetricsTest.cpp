@@ -0,0 +1,112 @@
+#include "pch/pch.h"
+#include "performance/HandlerMetrics.h"
+
+using UKControllerPlugin::Performance::HandlerMetrics;
+using ::testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Performance {
+
+        class HandlerMetricsTest : public Test
+        {
+            public:
+                HandlerMetricsTest()
+                    : metrics("Wake::WakeCategoryEventHandler")
+                {
+
+                }
+
+                HandlerMetrics metrics;
+        };
+
+        TEST_F(HandlerMetricsTest, ItHasAName)
+        {
+            EXPECT_EQ("Wake::WakeCategoryEventHandler", this->metrics.GetName());
+        }
+
+        TEST_F(HandlerMetricsTest, ItStartsEmpty)
+        {
+            EXPECT_EQ(0, this->metrics.CountCalls());
+            EXPECT_EQ(std::chrono::nanoseconds::zero(), this->metrics.GetTotalTime());
+            EXPECT_EQ(std::chrono::nanoseconds::zero(), this->metrics.GetMaxTime());
+            EXPECT_EQ(std::chrono::nanoseconds::zero(), this->metrics.GetAverageTime());
+            EXPECT_EQ(std::chrono::nanoseconds::zero(), this->metrics.GetPercentileUpperBound(0.9));
+            EXPECT_EQ(16, this->metrics.GetHistogram().size());
+        }
+
+        TEST_F(HandlerMetricsTest, ItRecordsCalls)
+        {
+            this->metrics.Record(std::chrono::microseconds(3));
+            this->metrics.Record(std::chrono::microseconds(5));
+            this->metrics.Record(std::chrono::microseconds(1));
+
+            EXPECT_EQ(3, this->metrics.CountCalls());
+            EXPECT_EQ(std::chrono::microseconds(9), this->metrics.GetTotalTime());
+            EXPECT_EQ(std::chrono::microseconds(5), this->metrics.GetMaxTime());
+            EXPECT_EQ(std::chrono::microseconds(3), this->metrics.GetAverageTime());
+        }
+
+        TEST_F(HandlerMetricsTest, ItBucketsDurationsOnALogScale)
+        {
+            EXPECT_EQ(0, HandlerMetrics::BucketForDuration(std::chrono::nanoseconds(999)));
+            EXPECT_EQ(1, HandlerMetrics::BucketForDuration(std::chrono::microseconds(1)));
+            EXPECT_EQ(2, HandlerMetrics::BucketForDuration(std::chrono::microseconds(2)));
+            EXPECT_EQ(2, HandlerMetrics::BucketForDuration(std::chrono::microseconds(3)));
+            EXPECT_EQ(3, HandlerMetrics::BucketForDuration(std::chrono::microseconds(4)));
+            EXPECT_EQ(10, HandlerMetrics::BucketForDuration(std::chrono::milliseconds(1)));
+        }
+
+        TEST_F(HandlerMetricsTest, ItPutsSlowCallsInTheLastBucket)
+        {
+            EXPECT_EQ(
+                HandlerMetrics::histogramBuckets - 1,
+                HandlerMetrics::BucketForDuration(std::chrono::seconds(10))
+            );
+        }
+
+        TEST_F(HandlerMetricsTest, ItRecordsCallsInTheHistogram)
+        {
+            this->metrics.Record(std::chrono::nanoseconds(500));
+            this->metrics.Record(std::chrono::microseconds(3));
+            this->metrics.Record(std::chrono::microseconds(2));
+
+            EXPECT_EQ(1, this->metrics.GetHistogram()[0]);
+            EXPECT_EQ(0, this->metrics.GetHistogram()[1]);
+            EXPECT_EQ(2, this->metrics.GetHistogram()[2]);
+        }
+
+        TEST_F(HandlerMetricsTest, ItReturnsPercentileUpperBounds)
+        {
+            for (int i = 0; i < 99; i++) {
+                this->metrics.Record(std::chrono::nanoseconds(500));
+            }
+            this->metrics.Record(std::chrono::microseconds(100));
+
+            EXPECT_EQ(std::chrono::microseconds(1), this->metrics.GetPercentileUpperBound(0.5));
+            EXPECT_EQ(std::chrono::microseconds(1), this->metrics.GetPercentileUpperBound(0.9));
+            EXPECT_EQ(std::chrono::microseconds(100), this->metrics.GetPercentileUpperBound(1.0));
+        }
+
+        TEST_F(HandlerMetricsTest, ItProducesASummary)
+        {
+            this->metrics.Record(std::chrono::microseconds(1500));
+            this->metrics.Record(std::chrono::microseconds(500));
+
+            EXPECT_EQ(
+                "Wake::WakeCategoryEventHandler: 2 calls, 2ms total, 1000us avg, 1500us p99, 1500us max",
+                this->metrics.GetSummary()
+            );
+        }
+
+        TEST_F(HandlerMetricsTest, ItResets)
+        {
+            this->metrics.Record(std::chrono::microseconds(3));
+            this->metrics.Reset();
+
+            EXPECT_EQ(0, this->metrics.CountCalls());
+            EXPECT_EQ(std::chrono::nanoseconds::zero(), this->metrics.GetTotalTime());
+            EXPECT_EQ(std::chrono::nanoseconds::zero(), this->metrics.GetMaxTime());
+            EXPECT_EQ(0, this->metrics.GetHistogram()[2]);
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,50 @@
+#include "pch/pch.h"
+#include "performance/PerformanceModule.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "bootstrap/PersistenceContainer.h"
+#include "command/CommandHandlerCollection.h"
+#include "timedevent/TimedEventCollection.h"
+#include "message/UserMessager.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+
+using UKControllerPlugin::Bootstrap::PersistenceContainer;
+using UKControllerPlugin::Command::CommandHandlerCollection;
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPlugin::Performance::BootstrapPlugin;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using UKControllerPlugin::TimedEvent::TimedEventCollection;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using ::testing::Test;
+using ::testing::NiceMock;
+
+namespace UKControllerPluginTest {
+    namespace Performance {
+
+        class PerformanceModuleTest : public Test
+        {
+            public:
+                PerformanceModuleTest()
+                {
+                    container.handlerMetrics = std::make_shared<HandlerMetricsCollection>();
+                    container.commandHandlers = std::make_unique<CommandHandlerCollection>();
+                    container.timedHandler = std::make_unique<TimedEventCollection>();
+                    container.userMessager = std::make_unique<UserMessager>(this->plugin);
+                }
+
+                NiceMock<MockEuroscopePluginLoopbackInterface> plugin;
+                PersistenceContainer container;
+        };
+
+        TEST_F(PerformanceModuleTest, ItRegistersTheCommandHandler)
+        {
+            BootstrapPlugin(this->container);
+            EXPECT_EQ(1, this->container.commandHandlers->CountHandlers());
+        }
+
+        TEST_F(PerformanceModuleTest, ItRegistersTheLogReport)
+        {
+            BootstrapPlugin(this->container);
+            EXPECT_EQ(1, this->container.timedHandler->CountHandlersForFrequency(300));
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,62 @@
+#include "pch/pch.h"
+#include "performance/PerformanceReportMessage.h"
+
+using UKControllerPlugin::Performance::PerformanceReportMessage;
+using testing::Test;
+
+namespace UKControllerPluginTest {
+    namespace Performance {
+
+        class PerformanceReportMessageTest : public Test
+        {
+            public:
+                PerformanceReportMessageTest()
+                    : message("Tag 101 IntentionCode::IntentionCodeEventHandler: 1 calls")
+                {
+
+                }
+
+                PerformanceReportMessage message;
+        };
+
+        TEST_F(PerformanceReportMessageTest, ItHasAMessageHandler)
+        {
+            EXPECT_EQ("UKCP_Perf", message.MessageHandler());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItHasASender)
+        {
+            EXPECT_EQ("UKCP", message.MessageSender());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItShowsTheHandler)
+        {
+            EXPECT_TRUE(message.MessageShowHandler());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItDoesntMarkItAsUnread)
+        {
+            EXPECT_FALSE(message.MessageMarkUnread());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItOverridesBusy)
+        {
+            EXPECT_TRUE(message.MessageOverrideBusy());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItDoesntFlashTheHandler)
+        {
+            EXPECT_FALSE(message.MessageFlashHandler());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItDoesntRequireConfirmation)
+        {
+            EXPECT_FALSE(message.MessageRequiresConfirm());
+        }
+
+        TEST_F(PerformanceReportMessageTest, ItHasAMessage)
+        {
+            EXPECT_EQ("Tag 101 IntentionCode::IntentionCodeEventHandler: 1 calls", message.MessageString());
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPluginTest
@@ -0,0 +1,107 @@
+#include "pch/pch.h"
+#include "performance/PerformanceReporter.h"
+#include "performance/HandlerMetrics.h"
+#include "performance/HandlerMetricsCollection.h"
+#include "message/UserMessager.h"
+#include "mock/MockEuroscopePluginLoopbackInterface.h"
+
+using UKControllerPlugin::Performance::PerformanceReporter;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
+using UKControllerPlugin::Message::UserMessager;
+using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
+using ::testing::Test;
+using ::testing::NiceMock;
+using ::testing::StrictMock;
+using ::testing::_;
+using ::testing::HasSubstr;
+
+namespace UKControllerPluginTest {
+    namespace Performance {
+
+        class PerformanceReporterTest : public Test
+        {
+            public:
+                PerformanceReporterTest()
+                    : messager(plugin), reporter(metrics, messager)
+                {
+
+                }
+
+                HandlerMetricsCollection metrics;
+                StrictMock<MockEuroscopePluginLoopbackInterface> plugin;
+                UserMessager messager;
+                PerformanceReporter reporter;
+        };
+
+        TEST_F(PerformanceReporterTest, ItHasACommand)
+        {
+            EXPECT_EQ(".ukcp perf", this->reporter.command);
+        }
+
+        TEST_F(PerformanceReporterTest, ItDoesntProcessOtherCommands)
+        {
+            EXPECT_FALSE(this->reporter.ProcessCommand(".ukcp about"));
+        }
+
+        TEST_F(PerformanceReporterTest, ItReportsHandlersThatHaveBeenCalledMostExpensiveFirst)
+        {
+            this->metrics.Register("fast")->Record(std::chrono::microseconds(1));
+            this->metrics.Register("never");
+            this->metrics.Register("slow")->Record(std::chrono::microseconds(100));
+
+            std::vector<std::string> report = this->reporter.GetReport(10);
+            ASSERT_EQ(2, report.size());
+            EXPECT_EQ(0, report[0].find("slow: "));
+            EXPECT_EQ(0, report[1].find("fast: "));
+        }
+
+        TEST_F(PerformanceReporterTest, ItLimitsTheReportLength)
+        {
+            this->metrics.Register("fast")->Record(std::chrono::microseconds(1));
+            this->metrics.Register("slow")->Record(std::chrono::microseconds(100));
+
+            std::vector<std::string> report = this->reporter.GetReport(1);
+            ASSERT_EQ(1, report.size());
+            EXPECT_EQ(0, report[0].find("slow: "));
+        }
+
+        TEST_F(PerformanceReporterTest, ItSendsTheReportToTheUser)
+        {
+            this->metrics.Register("fast")->Record(std::chrono::microseconds(1));
+            this->metrics.Register("slow")->Record(std::chrono::microseconds(100));
+
+            EXPECT_CALL(
+                this->plugin,
+                ChatAreaMessage("UKCP_Perf", "UKCP", HasSubstr("slow: 1 calls"), true, false, true, false, false)
+            )
+                .Times(1);
+
+            EXPECT_CALL(
+                this->plugin,
+                ChatAreaMessage("UKCP_Perf", "UKCP", HasSubstr("fast: 1 calls"), true, false, true, false, false)
+            )
+                .Times(1);
+
+            EXPECT_TRUE(this->reporter.ProcessCommand(".ukcp perf"));
+        }
+
+        TEST_F(PerformanceReporterTest, ItTellsTheUserIfNothingHasBeenRecorded)
+        {
+            this->metrics.Register("never");
+
+            EXPECT_CALL(
+                this->plugin,
+                ChatAreaMessage("UKCP_Perf", "UKCP", "No handler metrics recorded yet", true, false, true, false, false)
+            )
+                .Times(1);
+
+            EXPECT_TRUE(this->reporter.ProcessCommand(".ukcp perf"));
+        }
+
+        TEST_F(PerformanceReporterTest, ItDoesntMessageTheUserOnTimedEvents)
+        {
+            this->metrics.Register("slow")->Record(std::chrono::microseconds(100));
+            EXPECT_NO_THROW(this->reporter.TimedEventTrigger());
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPluginTest
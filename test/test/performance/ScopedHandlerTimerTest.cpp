@@ -0,0 +1,35 @@
+#include "pch/pch.h"
+#include "performance/ScopedHandlerTimer.h"
+#include "performance/HandlerMetrics.h"
+
+using UKControllerPlugin::Performance::HandlerMetrics;
+using UKControllerPlugin::Performance::ScopedHandlerTimer;
+
+namespace UKControllerPluginTest {
+    namespace Performance {
+
+        TEST(ScopedHandlerTimerTest, ItRecordsACallWhenItGoesOutOfScope)
+        {
+            HandlerMetrics metrics("test");
+            {
+                ScopedHandlerTimer timer(metrics);
+                EXPECT_EQ(0, metrics.CountCalls());
+            }
+
+            EXPECT_EQ(1, metrics.CountCalls());
+        }
+
+        TEST(ScopedHandlerTimerTest, ItRecordsACallIfAnExceptionIsThrown)
+        {
+            HandlerMetrics metrics("test");
+            try {
+                ScopedHandlerTimer timer(metrics);
+                throw std::runtime_error("oops");
+            } catch (std::runtime_error) {
+                // Nothing to do
+            }
+
+            EXPECT_EQ(1, metrics.CountCalls());
+        }
+    }  // namespace Performance
+}  // namespace UKControllerPluginTest
@@ -1,10 +1,12 @@
 #pragma once
 #include "pch/pch.h"
 #include "sectorfile/SectorFileCoordinates.h"
+#include "helper/RegexSectorFileCoordinates.h"
 
 using UKControllerPlugin::SectorFile::GetInvalidPosition;
 using UKControllerPlugin::SectorFile::PositionIsInvalid;
 using UKControllerPlugin::SectorFile::ParseSectorFileCoordinates;
+using UKControllerPlugin::SectorFile::ParseSectorFileCoordinateBuffer;
 using testing::Test;
 
 namespace UKControllerPluginTest {
@@ -132,5 +134,108 @@ namespace UKControllerPluginTest {
         {
             EXPECT_FALSE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000", "W001.15.59.888")));
         }
+
+        TEST_F(SectorFileCoordinatesTest, ItReturnsInvalidPositionIfCoordinatesHaveNonDigits)
+        {
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N05A.42.32.000", "W001.15.59.888")));
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000", "W001.15.59.88/")));
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N050:42.32.000", "W001.15.59.888")));
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000", "W001.15.59.8\xB8")));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItReturnsInvalidPositionIfHemispheresAreWrong)
+        {
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("E050.42.32.000", "W001.15.59.888")));
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000", "S001.15.59.888")));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItReturnsInvalidPositionIfCoordinatesHaveExtraCharacters)
+        {
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000 ", "W001.15.59.888")));
+            EXPECT_TRUE(PositionIsInvalid(ParseSectorFileCoordinates("N050.42.32.000", "W001.15.59.8888")));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesTheLimitsOfLatitudeAndLongitude)
+        {
+            EuroScopePlugIn::CPosition position = ParseSectorFileCoordinates("S090.00.00.000", "E180.00.00.000");
+            EXPECT_EQ(-90.0, position.m_Latitude);
+            EXPECT_EQ(180.0, position.m_Longitude);
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesThousandthsOfSeconds)
+        {
+            EXPECT_EQ(
+                51.0 + 28.0 / 60.0 + 39.123 / 3600.0,
+                ParseSectorFileCoordinates("N051.28.39.123", "W000.27.41.000").m_Latitude
+            );
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItParsesABufferOfCoordinates)
+        {
+            std::vector<EuroScopePlugIn::CPosition> positions = ParseSectorFileCoordinateBuffer(
+                "N051.28.39.000 W000.27.41.000\r\n  S050.56.44.000\tE000.15.42.000\n"
+            );
+
+            ASSERT_EQ(2, positions.size());
+            EXPECT_EQ(
+                ParseSectorFileCoordinates("N051.28.39.000", "W000.27.41.000").m_Latitude,
+                positions[0].m_Latitude
+            );
+            EXPECT_EQ(
+                ParseSectorFileCoordinates("N051.28.39.000", "W000.27.41.000").m_Longitude,
+                positions[0].m_Longitude
+            );
+            EXPECT_NEAR(-50.94556, positions[1].m_Latitude, 0.00001);
+            EXPECT_NEAR(0.26167, positions[1].m_Longitude, 0.00001);
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItReturnsInvalidPositionsForBadPairsInABuffer)
+        {
+            std::vector<EuroScopePlugIn::CPosition> positions = ParseSectorFileCoordinateBuffer(
+                "N051.28.39.000 W000.27.41.000 N091.00.00.000 W000.27.41.000 N051.28.39.000"
+            );
+
+            ASSERT_EQ(3, positions.size());
+            EXPECT_FALSE(PositionIsInvalid(positions[0]));
+            EXPECT_TRUE(PositionIsInvalid(positions[1]));
+            EXPECT_TRUE(PositionIsInvalid(positions[2]));
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItReturnsNothingForAnEmptyBuffer)
+        {
+            EXPECT_TRUE(ParseSectorFileCoordinateBuffer(" \r\n ").empty());
+        }
+
+        TEST_F(SectorFileCoordinatesTest, ItValidatesTheSameAsTheRegex)
+        {
+            // Swap single characters of a coordinate for other characters, so every position gets tried
+            const std::string latitude = "N051.28.39.123";
+            const std::string longitude = "W180.00.00.000";
+            const std::string replacements = "NSEW,.09 :/A\xB0";
+            for (size_t index = 0; index < latitude.size(); index++) {
+                for (char replacement : replacements) {
+                    std::string badLatitude = latitude;
+                    badLatitude[index] = replacement;
+                    std::string badLongitude = longitude;
+                    badLongitude[index] = replacement;
+
+                    EuroScopePlugIn::CPosition expected = ParseSectorFileCoordinatesWithRegex(
+                        badLatitude,
+                        badLongitude
+                    );
+                    EuroScopePlugIn::CPosition actual = ParseSectorFileCoordinates(badLatitude, badLongitude);
+                    EXPECT_EQ(expected.m_Latitude, actual.m_Latitude) << badLatitude << " " << badLongitude;
+                    EXPECT_EQ(expected.m_Longitude, actual.m_Longitude) << badLatitude << " " << badLongitude;
+
+                    expected = ParseSectorFileCoordinatesWithRegex(badLatitude, longitude);
+                    actual = ParseSectorFileCoordinates(badLatitude, longitude);
+                    EXPECT_EQ(expected.m_Latitude, actual.m_Latitude) << badLatitude;
+
+                    expected = ParseSectorFileCoordinatesWithRegex(latitude, badLongitude);
+                    actual = ParseSectorFileCoordinates(latitude, badLongitude);
+                    EXPECT_EQ(expected.m_Longitude, actual.m_Longitude) << badLongitude;
+                }
+            }
+        }
     }  // namespace SectorFile
 }  // namespace UKControllerPluginTest
@@ -62,6 +62,16 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(1, this->handler.Count());
         }
 
+        TEST_F(ApiSquawkAllocationHandlerTest, ItAddsSeveralEventsAtOnce)
+        {
+            std::vector<ApiSquawkAllocation> events;
+            events.push_back({ "BAW123", "0123" });
+            events.push_back({ "EZY12AX", "0124" });
+            events.push_back({ "BAW123", "0123" });
+            this->handler.AddAllocationsToQueue(events);
+            EXPECT_EQ(2, this->handler.Count());
+        }
+
         TEST_F(ApiSquawkAllocationHandlerTest, ItDoesntAddDuplicateEvents)
         {
             ApiSquawkAllocation event{ "BAW123", "0123" };
@@ -50,6 +50,39 @@ using ::testing::Throw;
 namespace UKControllerPluginTest {
     namespace Squawk {
 
+        /*
+            Keeps hold of tasks until told to run them, so that requests can build up into a batch.
+        */
+        class DeferredTaskRunner : public UKControllerPlugin::TaskManager::TaskRunnerInterface
+        {
+            public:
+                size_t CountThreads(void) const override
+                {
+                    return 0;
+                }
+
+                void QueueAsynchronousTask(std::function<void(void)> task) override
+                {
+                    this->tasks.push_back(task);
+                }
+
+                void QueueInteractiveTask(std::function<void(void)> task) override
+                {
+                    this->tasks.push_back(task);
+                }
+
+                void RunTasks(void)
+                {
+                    std::vector<std::function<void(void)>> toRun;
+                    toRun.swap(this->tasks);
+                    for (const std::function<void(void)> & task : toRun) {
+                        task();
+                    }
+                }
+
+                std::vector<std::function<void(void)>> tasks;
+        };
+
         class SquawkGeneratorTest : public ::testing::Test
         {
             public:
@@ -76,7 +109,8 @@ namespace UKControllerPluginTest {
                         *this->assignmentRules,
                         this->activeCallsigns,
                         this->flightplans,
-                        this->squawkAllocationHandler
+                        this->squawkAllocationHandler,
+                        std::chrono::milliseconds(0)
                     );
 
                     this->controller = std::unique_ptr<ControllerPosition>(
@@ -190,6 +224,7 @@ namespace UKControllerPluginTest {
                 .WillOnce(Return(allocation));
 
             this->generator->RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget);
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -233,6 +268,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             this->generator->RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget);
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -275,6 +311,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             this->generator->RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget);
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -315,6 +352,7 @@ namespace UKControllerPluginTest {
             EXPECT_TRUE(
                 this->generator->RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
             );
+            this->generator->TimedEventTrigger();
         }
 
         TEST_F(SquawkGeneratorTest, LocalSquawkReturnsFalseOnNoActionRequestAlreadyHappening)
@@ -397,6 +435,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             this->generator->RequestLocalSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget);
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -447,6 +486,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             this->generator->RequestLocalSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget);
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -490,6 +530,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             EXPECT_TRUE(this->generator->RequestLocalSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+            this->generator->TimedEventTrigger();
         }
 
         TEST_F(SquawkGeneratorTest, LocalSquawkReturnsFalseOnNoAction)
@@ -602,6 +643,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             EXPECT_TRUE(this->generator->ForceGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -675,6 +717,7 @@ namespace UKControllerPluginTest {
                 .WillByDefault(Return(this->mockFlightplan));
 
             EXPECT_TRUE(this->generator->ForceLocalSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget));
+            this->generator->TimedEventTrigger();
             EXPECT_TRUE(allocation == this->squawkAllocationHandler->First());
             EXPECT_EQ(1, this->squawkAllocationHandler->Count());
         }
@@ -836,5 +879,294 @@ namespace UKControllerPluginTest {
                 this->generator->AssignCircuitSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
             );
         }
+
+        TEST_F(SquawkGeneratorTest, ItBatchesRequestsMadeBeforeTheBatchIsSent)
+        {
+            DeferredTaskRunner deferredRunner;
+            SquawkGenerator batchingGenerator(
+                this->api,
+                &deferredRunner,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler,
+                std::chrono::milliseconds(0)
+            );
+
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel)
+                .WillByDefault(Return(1));
+
+            std::vector<std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>>> aircraft;
+            for (int flightplan = 0; flightplan < 6; flightplan++) {
+                std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>> mockFlightplan =
+                    std::make_shared<NiceMock<MockEuroScopeCFlightPlanInterface>>();
+                std::string callsign = "BAW" + std::to_string(flightplan);
+
+                ON_CALL(*mockFlightplan, GetCallsign())
+                    .WillByDefault(Return(callsign));
+
+                ON_CALL(*mockFlightplan, IsTrackedByUser())
+                    .WillByDefault(Return(true));
+
+                ON_CALL(*mockFlightplan, HasAssignedSquawk())
+                    .WillByDefault(Return(false));
+
+                ON_CALL(*mockFlightplan, GetDistanceFromOrigin)
+                    .WillByDefault(Return(1.0));
+
+                ON_CALL(*mockFlightplan, GetOrigin())
+                    .WillByDefault(Return("EGKK"));
+
+                ON_CALL(*mockFlightplan, GetDestination())
+                    .WillByDefault(Return("EGPF"));
+
+                ON_CALL(this->pluginLoopback, GetFlightplanForCallsign(callsign))
+                    .WillByDefault(Return(mockFlightplan));
+
+                // Half of them already have an assignment on the API
+                if (flightplan % 2 == 0) {
+                    EXPECT_CALL(this->api, GetAssignedSquawk(callsign))
+                        .Times(1)
+                        .WillOnce(Return(ApiSquawkAllocation{ callsign, "452" + std::to_string(flightplan) }));
+                } else {
+                    EXPECT_CALL(this->api, GetAssignedSquawk(callsign))
+                        .Times(1)
+                        .WillOnce(Throw(ApiNotFoundException("Not found")));
+                    EXPECT_CALL(this->api, CreateGeneralSquawkAssignment(callsign, "EGKK", "EGPF"))
+                        .Times(1)
+                        .WillOnce(Return(ApiSquawkAllocation{ callsign, "452" + std::to_string(flightplan) }));
+                }
+
+                aircraft.push_back(mockFlightplan);
+                EXPECT_TRUE(batchingGenerator.RequestGeneralSquawkForAircraft(*mockFlightplan, *this->mockRadarTarget));
+            }
+
+            EXPECT_EQ(0, deferredRunner.tasks.size());
+            batchingGenerator.TimedEventTrigger();
+            EXPECT_EQ(6, deferredRunner.tasks.size());
+            EXPECT_EQ(0, this->squawkAllocationHandler->Count());
+
+            deferredRunner.RunTasks();
+            EXPECT_EQ(6, this->squawkAllocationHandler->Count());
+        }
+
+        TEST_F(SquawkGeneratorTest, ItRunsEachRequestInABatchAsATask)
+        {
+            DeferredTaskRunner deferredRunner;
+            SquawkGenerator batchingGenerator(
+                this->api,
+                &deferredRunner,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler,
+                std::chrono::milliseconds(0)
+            );
+
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel)
+                .WillByDefault(Return(1));
+
+            std::vector<std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>>> aircraft;
+            for (int flightplan = 0; flightplan < 3; flightplan++) {
+                std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>> mockFlightplan =
+                    std::make_shared<NiceMock<MockEuroScopeCFlightPlanInterface>>();
+                std::string callsign = "BAW" + std::to_string(flightplan);
+
+                ON_CALL(*mockFlightplan, GetCallsign())
+                    .WillByDefault(Return(callsign));
+
+                ON_CALL(*mockFlightplan, IsTrackedByUser())
+                    .WillByDefault(Return(true));
+
+                ON_CALL(*mockFlightplan, HasAssignedSquawk())
+                    .WillByDefault(Return(false));
+
+                ON_CALL(*mockFlightplan, GetDistanceFromOrigin)
+                    .WillByDefault(Return(1.0));
+
+                EXPECT_CALL(this->api, GetAssignedSquawk(callsign))
+                    .Times(1)
+                    .WillOnce(Return(ApiSquawkAllocation{ callsign, "452" + std::to_string(flightplan) }));
+
+                aircraft.push_back(mockFlightplan);
+                EXPECT_TRUE(batchingGenerator.RequestGeneralSquawkForAircraft(*mockFlightplan, *this->mockRadarTarget));
+            }
+
+            batchingGenerator.TimedEventTrigger();
+            EXPECT_EQ(3, deferredRunner.tasks.size());
+
+            // Nothing is handed over until the last request in the batch has finished
+            deferredRunner.tasks[0]();
+            deferredRunner.tasks[1]();
+            EXPECT_EQ(0, this->squawkAllocationHandler->Count());
+            deferredRunner.tasks[2]();
+            EXPECT_EQ(3, this->squawkAllocationHandler->Count());
+        }
+
+        TEST_F(SquawkGeneratorTest, ItDoesntSendTheBatchUntilTheWindowHasPassed)
+        {
+            DeferredTaskRunner deferredRunner;
+            SquawkGenerator batchingGenerator(
+                this->api,
+                &deferredRunner,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler,
+                std::chrono::minutes(5)
+            );
+
+            ON_CALL(*this->mockFlightplan, GetCallsign())
+                .WillByDefault(Return("BAW1252"));
+
+            ON_CALL(*this->mockFlightplan, IsTrackedByUser())
+                .WillByDefault(Return(true));
+
+            ON_CALL(*this->mockFlightplan, HasAssignedSquawk())
+                .WillByDefault(Return(false));
+
+            ON_CALL(*this->mockFlightplan, GetDistanceFromOrigin)
+                .WillByDefault(Return(1.0));
+
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel)
+                .WillByDefault(Return(1));
+
+            EXPECT_CALL(this->api, GetAssignedSquawk(_))
+                .Times(0);
+
+            EXPECT_TRUE(
+                batchingGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
+            );
+            batchingGenerator.TimedEventTrigger();
+            EXPECT_EQ(0, deferredRunner.tasks.size());
+        }
+
+        TEST_F(SquawkGeneratorTest, ItDoesntQueueTasksIfThereAreNoRequests)
+        {
+            DeferredTaskRunner deferredRunner;
+            SquawkGenerator batchingGenerator(
+                this->api,
+                &deferredRunner,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler,
+                std::chrono::milliseconds(0)
+            );
+
+            batchingGenerator.TimedEventTrigger();
+            EXPECT_EQ(0, deferredRunner.tasks.size());
+        }
+
+        TEST_F(SquawkGeneratorTest, ItHandsOverTheBatchEvenIfARequestThrows)
+        {
+            DeferredTaskRunner deferredRunner;
+            SquawkGenerator batchingGenerator(
+                this->api,
+                &deferredRunner,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler,
+                std::chrono::milliseconds(0)
+            );
+
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel)
+                .WillByDefault(Return(1));
+
+            std::vector<std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>>> aircraft;
+            for (int flightplan = 0; flightplan < 3; flightplan++) {
+                std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>> mockFlightplan =
+                    std::make_shared<NiceMock<MockEuroScopeCFlightPlanInterface>>();
+                std::string callsign = "BAW" + std::to_string(flightplan);
+
+                ON_CALL(*mockFlightplan, GetCallsign())
+                    .WillByDefault(Return(callsign));
+
+                ON_CALL(*mockFlightplan, IsTrackedByUser())
+                    .WillByDefault(Return(true));
+
+                ON_CALL(*mockFlightplan, HasAssignedSquawk())
+                    .WillByDefault(Return(false));
+
+                ON_CALL(*mockFlightplan, GetDistanceFromOrigin)
+                    .WillByDefault(Return(1.0));
+
+                aircraft.push_back(mockFlightplan);
+            }
+
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW0"))
+                .Times(1)
+                .WillOnce(Throw(std::runtime_error("not an api exception")));
+
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW1"))
+                .Times(1)
+                .WillOnce(Throw(42));
+
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW2"))
+                .Times(1)
+                .WillOnce(Return(ApiSquawkAllocation{ "BAW2", "4522" }));
+
+            for (const std::shared_ptr<NiceMock<MockEuroScopeCFlightPlanInterface>> & mockFlightplan : aircraft) {
+                EXPECT_TRUE(batchingGenerator.RequestGeneralSquawkForAircraft(*mockFlightplan, *this->mockRadarTarget));
+            }
+
+            batchingGenerator.TimedEventTrigger();
+            EXPECT_NO_THROW(deferredRunner.RunTasks());
+            EXPECT_EQ(1, this->squawkAllocationHandler->Count());
+
+            // The requests that threw are no longer in progress, so they can be made again
+            EXPECT_TRUE(batchingGenerator.RequestGeneralSquawkForAircraft(*aircraft[0], *this->mockRadarTarget));
+        }
+
+        TEST_F(SquawkGeneratorTest, ItStartsANewBatchOnceTheLastHasBeenProcessed)
+        {
+            DeferredTaskRunner deferredRunner;
+            SquawkGenerator batchingGenerator(
+                this->api,
+                &deferredRunner,
+                *this->assignmentRules,
+                this->activeCallsigns,
+                this->flightplans,
+                this->squawkAllocationHandler,
+                std::chrono::milliseconds(0)
+            );
+
+            ON_CALL(*this->mockFlightplan, GetCallsign())
+                .WillByDefault(Return("BAW1252"));
+
+            ON_CALL(*this->mockFlightplan, IsTrackedByUser())
+                .WillByDefault(Return(true));
+
+            ON_CALL(*this->mockFlightplan, HasAssignedSquawk())
+                .WillByDefault(Return(false));
+
+            ON_CALL(*this->mockFlightplan, GetDistanceFromOrigin)
+                .WillByDefault(Return(1.0));
+
+            ON_CALL(*this->mockRadarTarget, GetFlightLevel)
+                .WillByDefault(Return(1));
+
+            EXPECT_CALL(this->api, GetAssignedSquawk("BAW1252"))
+                .Times(2)
+                .WillRepeatedly(Return(ApiSquawkAllocation{ "BAW1252", "1423" }));
+
+            EXPECT_TRUE(
+                batchingGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
+            );
+            EXPECT_FALSE(
+                batchingGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
+            );
+            batchingGenerator.TimedEventTrigger();
+            deferredRunner.RunTasks();
+
+            EXPECT_TRUE(
+                batchingGenerator.RequestGeneralSquawkForAircraft(*this->mockFlightplan, *this->mockRadarTarget)
+            );
+            EXPECT_EQ(0, deferredRunner.tasks.size());
+            batchingGenerator.TimedEventTrigger();
+            EXPECT_EQ(1, deferredRunner.tasks.size());
+            deferredRunner.RunTasks();
+        }
     }  // namespace Squawk
 }  // namespace UKControllerPluginTest
@@ -51,6 +51,15 @@ namespace UKControllerPluginModuleTest {
             );
         }
 
+        TEST_F(SquawkModuleTest, BootstrapPluginRegistersGeneratorForTimedEvents)
+        {
+            SquawkModule::BootstrapPlugin(container, false, false);
+            EXPECT_EQ(
+                1,
+                this->container.timedHandler->CountHandlersForFrequency(SquawkModule::batchCheckFrequency)
+            );
+        }
+
         TEST_F(SquawkModuleTest, BootstrapPluginRegistersEventHandlerForTimedEvents)
         {
             SquawkModule::BootstrapPlugin(container, false, false);
@@ -109,5 +109,18 @@ namespace UKControllerPluginTest {
             tagData.SetItemString("thisdataistoolongforthetagitem");
             EXPECT_EQ(tagData.invalidItemText, tagData.GetItemString());
         }
+
+        TEST_F(TagDataTest, ItSetsItemStringFromAStringView)
+        {
+            std::string_view view("EGLLEGKK", 4);
+            tagData.SetItemString(view);
+            EXPECT_EQ("EGLL", tagData.GetItemString());
+        }
+
+        TEST_F(TagDataTest, ItSetsItemStringAtMaximumLength)
+        {
+            tagData.SetItemString("fifteencharsabc");
+            EXPECT_EQ("fifteencharsabc", tagData.GetItemString());
+        }
     }  // namespace Tag
 }  // namespace UKControllerPluginTest
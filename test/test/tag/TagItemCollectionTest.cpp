@@ -7,6 +7,8 @@
 #include "euroscope/EuroScopeCRadarTargetInterface.h"
 #include "mock/MockEuroscopePluginLoopbackInterface.h"
 #include "tag/TagData.h"
+#include "performance/HandlerMetrics.h"
+#include "performance/HandlerMetricsCollection.h"
 
 using testing::Test;
 using UKControllerPlugin::Tag::TagData;
@@ -17,6 +19,7 @@ using UKControllerPlugin::Euroscope::EuroScopeCRadarTargetInterface;
 using UKControllerPluginTest::Euroscope::MockEuroscopePluginLoopbackInterface;
 using UKControllerPlugin::Tag::TagItemCollection;
 using ::testing::StrictMock;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
 
 namespace UKControllerPluginTest {
     namespace Tag {
@@ -98,6 +101,36 @@ namespace UKControllerPluginTest {
             EXPECT_EQ(collection.errorTagItemText, tagData.GetItemString());
         }
 
+        TEST_F(TagItemCollectionTest, TagItemUpdateReturnsErrorIfNotRegisteredButLowerThanAnotherItem)
+        {
+            TagItemCollection collection;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            TagData tagData(
+                mockFlightplan,
+                mockRadarTarget,
+                1,
+                EuroScopePlugIn::TAG_DATA_CORRELATED,
+                itemString,
+                &euroscopeColourCode,
+                &tagColour,
+                &fontSize
+            );
+
+            collection.RegisterTagItem(5, std::make_shared<FakeTagItem>("testdesc", "testdata"));
+            collection.TagItemUpdate(tagData);
+            EXPECT_EQ(collection.errorTagItemText, tagData.GetItemString());
+        }
+
+        TEST_F(TagItemCollectionTest, RegisterTagItemThrowsExceptionIfIdNegative)
+        {
+            TagItemCollection collection;
+            EXPECT_THROW(
+                collection.RegisterTagItem(-1, std::make_shared<FakeTagItem>("testdesc", "testdata")),
+                std::invalid_argument
+            );
+        }
+
         TEST_F(TagItemCollectionTest, TagItemUpdateSetsTagItemData)
         {
             TagItemCollection collection;
@@ -149,5 +182,39 @@ namespace UKControllerPluginTest {
             collection.RegisterTagItem(5, std::make_shared<FakeTagItem>("testdesc", "testdata"));
             EXPECT_TRUE(collection.HasHandlerForItemId(5));
         }
+
+        TEST_F(TagItemCollectionTest, TagItemUpdateRecordsMetricsPerItemId)
+        {
+            std::shared_ptr<HandlerMetricsCollection> metrics = std::make_shared<HandlerMetricsCollection>();
+            TagItemCollection collection(metrics);
+            std::shared_ptr<FakeTagItem> tagItem = std::make_shared<FakeTagItem>("testdesc", "testdata");
+            collection.RegisterTagItem(1, tagItem);
+            collection.RegisterTagItem(2, tagItem);
+
+            StrictMock<MockEuroScopeCFlightPlanInterface> mockFlightplan;
+            StrictMock<MockEuroScopeCRadarTargetInterface> mockRadarTarget;
+            TagData tagData(
+                mockFlightplan,
+                mockRadarTarget,
+                1,
+                EuroScopePlugIn::TAG_DATA_CORRELATED,
+                itemString,
+                &euroscopeColourCode,
+                &tagColour,
+                &fontSize
+            );
+            collection.TagItemUpdate(tagData);
+
+            ASSERT_EQ(2, metrics->CountMetrics());
+            std::vector<std::shared_ptr<const UKControllerPlugin::Performance::HandlerMetrics>> sorted =
+                metrics->GetMetricsByTotalTime();
+            unsigned long long calls = 0;
+            for (auto metric = sorted.cbegin(); metric != sorted.cend(); ++metric) {
+                if ((*metric)->GetName().find("Tag 1 ") == 0) {
+                    calls = (*metric)->CountCalls();
+                }
+            }
+            EXPECT_EQ(1, calls);
+        }
     }  // namespace Tag
 }  // namespace UKControllerPluginTest
@@ -0,0 +1,105 @@
+#include "pch/pch.h"
+#include "task/LockFreeQueue.h"
+
+using ::testing::Test;
+using UKControllerPlugin::TaskManager::LockFreeQueue;
+
+namespace UKControllerPluginTest {
+    namespace TaskManager {
+
+        class LockFreeQueueTest : public Test
+        {
+            public:
+                LockFreeQueue<std::string> queue;
+        };
+
+        TEST_F(LockFreeQueueTest, ItStartsEmpty)
+        {
+            std::string value;
+            EXPECT_TRUE(this->queue.Empty());
+            EXPECT_FALSE(this->queue.TryPop(value));
+        }
+
+        TEST_F(LockFreeQueueTest, ItIsNotEmptyOncePushed)
+        {
+            this->queue.Push("one");
+            EXPECT_FALSE(this->queue.Empty());
+        }
+
+        TEST_F(LockFreeQueueTest, ItPopsInTheOrderPushed)
+        {
+            this->queue.Push("one");
+            this->queue.Push("two");
+            this->queue.Push("three");
+
+            std::string value;
+            EXPECT_TRUE(this->queue.TryPop(value));
+            EXPECT_EQ("one", value);
+            EXPECT_TRUE(this->queue.TryPop(value));
+            EXPECT_EQ("two", value);
+            EXPECT_TRUE(this->queue.TryPop(value));
+            EXPECT_EQ("three", value);
+            EXPECT_FALSE(this->queue.TryPop(value));
+            EXPECT_TRUE(this->queue.Empty());
+        }
+
+        TEST_F(LockFreeQueueTest, ItDrainsEverything)
+        {
+            this->queue.Push("one");
+            this->queue.Push("two");
+
+            std::vector<std::string> drained;
+            EXPECT_EQ(2, this->queue.Drain([&drained](std::string value) { drained.push_back(value); }));
+            EXPECT_EQ(std::vector<std::string>({ "one", "two" }), drained);
+            EXPECT_TRUE(this->queue.Empty());
+        }
+
+        TEST_F(LockFreeQueueTest, ItDrainsNothingIfEmpty)
+        {
+            EXPECT_EQ(0, this->queue.Drain([](std::string value) {}));
+        }
+
+        TEST_F(LockFreeQueueTest, ItCanBeDestroyedWithItemsLeft)
+        {
+            std::unique_ptr<LockFreeQueue<std::string>> leftovers = std::make_unique<LockFreeQueue<std::string>>();
+            leftovers->Push("one");
+            leftovers->Push("two");
+            EXPECT_NO_THROW(leftovers.reset());
+        }
+
+        TEST_F(LockFreeQueueTest, ItKeepsEachProducersOrderWithManyProducers)
+        {
+            const int producers = 4;
+            const int itemsPerProducer = 20000;
+            LockFreeQueue<std::pair<int, int>> items;
+
+            std::vector<std::thread> threads;
+            for (int producer = 0; producer < producers; producer++) {
+                threads.push_back(std::thread([&items, producer, itemsPerProducer]() {
+                    for (int item = 0; item < itemsPerProducer; item++) {
+                        items.Push({ producer, item });
+                    }
+                }));
+            }
+
+            // Drain whilst the producers are still going
+            std::vector<int> nextItem(producers, 0);
+            int received = 0;
+            bool inOrder = true;
+            while (received < producers * itemsPerProducer) {
+                received += items.Drain([&nextItem, &inOrder](std::pair<int, int> item) {
+                    inOrder = inOrder && item.second == nextItem[item.first];
+                    nextItem[item.first]++;
+                });
+            }
+
+            for (std::thread & thread : threads) {
+                thread.join();
+            }
+
+            EXPECT_TRUE(inOrder);
+            EXPECT_EQ(std::vector<int>(producers, itemsPerProducer), nextItem);
+            EXPECT_TRUE(items.Empty());
+        }
+    }  // namespace TaskManager
+}  // namespace UKControllerPluginTest
@@ -1,10 +1,115 @@
 #include "pch/pch.h"
 #include "task/TaskRunner.h"
+#include <future>
 
 using UKControllerPlugin::TaskManager::TaskRunner;
+using UKControllerPlugin::TaskManager::TaskQueueMetrics;
 
 namespace UKControllerPluginTest {
     namespace TaskManager {
 
+        class TaskRunnerTest : public ::testing::Test
+        {
+            public:
+                /*
+                    Block the only thread until released, so that tasks can be queued up behind it.
+                */
+                void BlockRunner(TaskRunner & runner)
+                {
+                    std::promise<void> started;
+                    runner.QueueAsynchronousTask([this, &started]() {
+                        started.set_value();
+                        this->release.get_future().wait();
+                    });
+                    started.get_future().wait();
+                }
+
+                std::promise<void> release;
+        };
+
+        TEST_F(TaskRunnerTest, ItCreatesThreads)
+        {
+            TaskRunner runner(3);
+            EXPECT_EQ(3, runner.CountThreads());
+        }
+
+        TEST_F(TaskRunnerTest, ItRunsAsynchronousTasks)
+        {
+            std::promise<int> result;
+            TaskRunner runner(1);
+            runner.QueueAsynchronousTask([&result]() { result.set_value(5); });
+
+            EXPECT_EQ(5, result.get_future().get());
+        }
+
+        TEST_F(TaskRunnerTest, ItRunsInteractiveTasks)
+        {
+            std::promise<int> result;
+            TaskRunner runner(1);
+            runner.QueueInteractiveTask([&result]() { result.set_value(5); });
+
+            EXPECT_EQ(5, result.get_future().get());
+        }
+
+        TEST_F(TaskRunnerTest, ItRunsInteractiveTasksBeforeBackgroundTasks)
+        {
+            std::vector<std::string> order;
+            std::promise<void> finished;
+            TaskRunner runner(1);
+            this->BlockRunner(runner);
+
+            runner.QueueAsynchronousTask([&order]() { order.push_back("background1"); });
+            runner.QueueAsynchronousTask([&order, &finished]() {
+                order.push_back("background2");
+                finished.set_value();
+            });
+            runner.QueueInteractiveTask([&order]() { order.push_back("interactive1"); });
+            runner.QueueInteractiveTask([&order]() { order.push_back("interactive2"); });
+            this->release.set_value();
+            finished.get_future().wait();
+
+            std::vector<std::string> expected = { "interactive1", "interactive2", "background1", "background2" };
+            EXPECT_EQ(expected, order);
+        }
+
+        TEST_F(TaskRunnerTest, ItRecordsQueueMetrics)
+        {
+            std::promise<void> finished;
+            TaskRunner runner(1);
+            this->BlockRunner(runner);
+
+            runner.QueueAsynchronousTask([]() {});
+            runner.QueueAsynchronousTask([]() {});
+            runner.QueueInteractiveTask([&finished]() { finished.set_value(); });
+
+            TaskQueueMetrics background = runner.GetBackgroundMetrics();
+            EXPECT_EQ(3, background.tasksQueued);
+            EXPECT_EQ(1, background.tasksStarted);
+            EXPECT_EQ(2, background.depth);
+            EXPECT_EQ(2, background.maxDepth);
+
+            TaskQueueMetrics interactive = runner.GetInteractiveMetrics();
+            EXPECT_EQ(1, interactive.tasksQueued);
+            EXPECT_EQ(0, interactive.tasksStarted);
+            EXPECT_EQ(1, interactive.depth);
+
+            this->release.set_value();
+            finished.get_future().wait();
+            interactive = runner.GetInteractiveMetrics();
+            EXPECT_EQ(1, interactive.tasksStarted);
+            EXPECT_EQ(0, interactive.depth);
+            EXPECT_LE(interactive.maxWait, interactive.totalWait);
+        }
+
+        TEST_F(TaskRunnerTest, ItKeepsRunningAfterATaskThrows)
+        {
+            std::promise<int> result;
+            TaskRunner runner(1);
+            runner.QueueAsynchronousTask([]() { throw std::invalid_argument("bad"); });
+            runner.QueueAsynchronousTask([]() { throw 1; });
+            runner.QueueAsynchronousTask([&result]() { result.set_value(5); });
+
+            EXPECT_EQ(5, result.get_future().get());
+        }
     }  // namespace TaskManager
 }  // namespace UKControllerPluginTest
@@ -1,10 +1,14 @@
 #include "pch/pch.h"
 #include "timedevent/TimedEventCollection.h"
 #include "mock/MockAbstractTimedEvent.h"
+#include "performance/HandlerMetrics.h"
+#include "performance/HandlerMetricsCollection.h"
 
 using UKControllerPlugin::TimedEvent::TimedEventCollection;
 using UKControllerPluginTest::EventHandler::MockAbstractTimedEvent;
 using ::testing::StrictMock;
+using ::testing::NiceMock;
+using UKControllerPlugin::Performance::HandlerMetricsCollection;
 
 namespace UKControllerPluginTest {
     namespace EventHandler {
@@ -93,5 +97,20 @@ namespace UKControllerPluginTest {
             collection.RegisterEvent(std::make_shared<MockAbstractTimedEvent>(), 30);
             EXPECT_EQ(0, collection.CountHandlersForFrequency(11));
         }
+
+        TEST(TimedEventCollection, TickRecordsEventMetrics)
+        {
+            std::shared_ptr<HandlerMetricsCollection> metrics = std::make_shared<HandlerMetricsCollection>();
+            TimedEventCollection collection(metrics);
+            collection.RegisterEvent(std::make_shared<NiceMock<MockAbstractTimedEvent>>(), 10);
+
+            collection.Tick(10);
+            collection.Tick(15);
+            collection.Tick(20);
+
+            ASSERT_EQ(1, metrics->CountMetrics());
+            EXPECT_EQ(0, metrics->GetMetricsByTotalTime()[0]->GetName().find("Timed "));
+            EXPECT_EQ(2, metrics->GetMetricsByTotalTime()[0]->CountCalls());
+        }
     }  // namespace EventHandler
 }  // namespace UKControllerPluginTest
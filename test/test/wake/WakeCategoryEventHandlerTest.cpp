@@ -4,12 +4,16 @@
 #include "mock/MockEuroScopeCRadarTargetInterface.h"
 #include "mock/MockEuroScopeCFlightplanInterface.h"
 #include "tag/TagData.h"
+#include "flightplan/CallsignRegistry.h"
+#include "flightplan/StoredFlightplan.h"
 
 using UKControllerPlugin::Wake::WakeCategoryMapper;
 using UKControllerPlugin::Wake::WakeCategoryEventHandler;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCFlightPlanInterface;
 using UKControllerPluginTest::Euroscope::MockEuroScopeCRadarTargetInterface;
 using UKControllerPlugin::Tag::TagData;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
+using UKControllerPlugin::Flightplan::StoredFlightplan;
 
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -92,7 +96,11 @@ namespace UKControllerPluginTest {
                     ON_CALL(this->flightplanLongType, GetAircraftType())
                         .WillByDefault(Return("123456789012345678"));
 
-                    handler = std::make_shared<WakeCategoryEventHandler>(this->mapper, this->recatMapper);
+                    handler = std::make_shared<WakeCategoryEventHandler>(
+                        this->mapper,
+                        this->recatMapper,
+                        this->aircraft
+                    );
                 }
 
                 double fontSize = 24.1;
@@ -110,9 +118,18 @@ namespace UKControllerPluginTest {
                 TagData tagDataUnknownType;
                 WakeCategoryMapper mapper;
                 WakeCategoryMapper recatMapper;
+                CallsignRegistry aircraft;
                 std::shared_ptr<WakeCategoryEventHandler> handler;
         };
 
+        TEST_F(WakeCategoryEventHandlerTest, TestItDependsOnTheAircraftTypeAndWakeCategory)
+        {
+            EXPECT_EQ(
+                StoredFlightplan::aircraftTypeChanged | StoredFlightplan::wakeCategoryChanged,
+                handler->GetFlightplanFieldDependencies()
+            );
+        }
+
         TEST_F(WakeCategoryEventHandlerTest, TestItHasATagItemNameForCombined)
         {
             EXPECT_TRUE("Aircraft Type / UK Wake Category" == handler->GetTagItemDescription(105));
@@ -7,6 +7,7 @@
 using UKControllerPlugin::Bootstrap::PersistenceContainer;
 using UKControllerPluginTest::Dependency::MockDependencyLoader;
 using UKControllerPlugin::Flightplan::FlightPlanEventHandlerCollection;
+using UKControllerPlugin::Flightplan::CallsignRegistry;
 using UKControllerPlugin::Tag::TagItemCollection;
 using UKControllerPlugin::Wake::BootstrapPlugin;
 using ::testing::Test;
@@ -22,6 +23,7 @@ namespace UKControllerPluginTest {
                 {
                     container.flightplanHandler.reset(new FlightPlanEventHandlerCollection);
                     container.tagHandler.reset(new TagItemCollection);
+                    container.callsignRegistry = std::make_shared<CallsignRegistry>();
                 }
 
                 PersistenceContainer container;